@@ -0,0 +1,47 @@
+# Name:     inst_stats1.pl
+# Author:   agent
+# Date:     10/18/2026
+# Purpose:  Verifies that the instance statistics stored in a scored CDD file report the same
+#           coverage as recalculating them, both before and after coverage points are excluded.
+
+require "../verilog/regress_subs.pl";
+
+# Initialize the diagnostic environment
+&initialize( "inst_stats1", 0, @ARGV );
+
+# Simulate and get coverage information
+if( $SIMULATOR eq "IV" ) {
+  system( "iverilog -DDUMP inst_stats1.v; ./a.out" ) && die;
+} elsif( $SIMULATOR eq "CVER" ) {
+  system( "cver -q +define+DUMP inst_stats1.v" ) && die;
+} elsif( $SIMULATOR eq "VCS" ) {
+  system( "vcs +define+DUMP inst_stats1.v; ./simv" ) && die;
+} elsif( $SIMULATOR eq "VERIWELL" ) {
+  system( "veriwell +define+DUMP inst_stats1.v" ) && die;
+}
+
+# Perform diagnostic running code here
+&runScoreCommand( "-t main -vcd inst_stats1.vcd -v inst_stats1.v -o inst_stats1.cdd" );
+
+# Remove the stored instance statistics from a copy so that the report recalculates them
+&runCommand( "grep -v '^16 ' inst_stats1.cdd > inst_stats1.1.cdd" );
+
+# Exclude a line and a signal of one instance in another copy (which stores updated statistics) and
+# remove the stored instance statistics from a copy of that
+&runCommand( "cp inst_stats1.cdd inst_stats1.2.cdd" );
+&runExcludeCommand( "L22 T13 inst_stats1.2.cdd" );
+&runCommand( "grep -v '^16 ' inst_stats1.2.cdd > inst_stats1.3.cdd" );
+
+# Generate instance summary reports from the stored and the recalculated statistics
+&runReportCommand( "-m ltcfm -d s -i -o inst_stats1.rptI inst_stats1.cdd" );
+&runReportCommand( "-m ltcfm -d s -i -o inst_stats1.1.rptI inst_stats1.1.cdd" );
+&runReportCommand( "-m ltcfm -d s -i -o inst_stats1.2.rptI inst_stats1.2.cdd" );
+&runReportCommand( "-m ltcfm -d s -i -o inst_stats1.3.rptI inst_stats1.3.cdd" );
+
+# Perform the file comparison checks
+&checkTest( "inst_stats1",   1, 0 );
+&checkTest( "inst_stats1.1", 1, 0 );
+&checkTest( "inst_stats1.2", 1, 0 );
+&checkTest( "inst_stats1.3", 1, 0 );
+
+exit 0;
@@ -66,6 +66,12 @@ if( $DUMPTYPE eq "VCD" ) {
 &runReportCommand( "-d v -e -m ltcfamr -i -o merge10.8.rptI merge10.8.cdd" );
 &checkTest( "merge10.8", 1, $check_type );
 
+# Perform the same merge as merge10.1 in parallel and make sure that the results are identical
+&runMergeCommand( "-er first -j 3 -o merge10.9.cdd merge10a.cdd merge10b.cdd merge10c.cdd merge10d.cdd merge10e.cdd merge10f.cdd merge10g.cdd merge10h.cdd" );
+&runReportCommand( "-d v -e -m ltcfamr -o merge10.9.rptM merge10.9.cdd" );
+&runReportCommand( "-d v -e -m ltcfamr -i -o merge10.9.rptI merge10.9.cdd" );
+&checkTest( "merge10.9", 1, $check_type );
+
 # Remove intermediate CDD files
 &checkTest( "merge10a", 1, 6 );
 &checkTest( "merge10b", 1, 6 );
@@ -0,0 +1,20 @@
+# Name:     merge_err3.pl
+# Author:   agent
+# Date:     10/18/2026
+# Purpose:  Verifies that an error is displayed when two CDD files with the same root instance were created
+#           from different designs.
+
+require "../verilog/regress_subs.pl";
+
+# This should always be called first
+&initialize( "merge_err3", 1, @ARGV );
+
+system( "$MAKE DIAG=merge_err1a TOP=${TOPDIR}merge_err1a.v diagrun" ) && die;
+system( "$MAKE DIAG=merge_err1b TOP=${TOPDIR}merge_err1b.v diagrun" ) && die;
+&runMergeCommand( "-o merge_err3.cdd merge_err1a.cdd merge_err1b.cdd 2> merge_err3.err" );
+system( "cat merge_err3.err" ) && die;
+
+# Perform diagnostic check
+&checkTest( "merge_err3", 1, 1 );
+
+exit 0;
@@ -0,0 +1,20 @@
+# Name:     share_insts1.pl
+# Author:   agent
+# Date:     10/18/2026
+# Purpose:  Verifies that the -share-insts score option writes the same CDD as sizing
+#           every instance, both for identically and differently parameterized instances.
+
+require "../verilog/regress_subs.pl";
+
+# Initialize the diagnostic environment
+&initialize( "share_insts1", 0, @ARGV );
+
+# Parse the design with and without the shared instance layout
+&runScoreCommand( "-t main -v share_insts1.v -o share_insts1.cdd" );
+&runScoreCommand( "-t main -v share_insts1.v -o share_insts1.1.cdd -share-insts" );
+
+# Both CDD files must match the same design
+&checkTest( "share_insts1", 1, 0 );
+&checkTest( "share_insts1.1", 1, 0 );
+
+exit 0;
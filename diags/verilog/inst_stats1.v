@@ -0,0 +1,57 @@
+/*
+ Name:        inst_stats1.v
+ Author:      agent
+ Date:        10/18/2026
+ Purpose:     See perl script for details.
+*/
+
+module main;
+
+reg       clock;
+reg [1:0] d;
+wire[1:0] a, b;
+
+foo f1( clock, 1'b1, d, a );
+foo f2( clock, 1'b0, d, b );
+
+initial begin
+`ifdef DUMP
+        $dumpfile( "inst_stats1.vcd" );
+        $dumpvars( 0, main );
+`endif
+        d = 2'b00;
+        #9;
+        d = 2'b01;
+        #10;
+        d = 2'b10;
+        #10;
+        $finish;
+end
+
+initial begin
+        clock = 1'b0;
+        forever #2 clock = ~clock;
+end
+
+endmodule
+
+//-----------------------------------------
+
+module foo( clock, en, d, q );
+
+input        clock;
+input        en;
+input  [1:0] d;
+output [1:0] q;
+
+reg [1:0] q;
+reg [1:0] mem[0:3];
+
+always @(posedge clock)
+  if( en )
+    begin
+     q      <= d;
+     mem[d] <= d;
+    end
+
+endmodule
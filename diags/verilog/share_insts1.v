@@ -0,0 +1,63 @@
+/*
+ Name:        share_insts1.v
+ Author:      agent
+ Date:        10/18/2026
+ Purpose:     Verifies that sharing the sized layout of identically parameterized
+              instances (-share-insts) writes the same CDD as sizing each instance.
+*/
+
+module main;
+
+wire [3:0] a0, a1, a2;
+wire [7:0] b0;
+wire [1:0] c0, c1;
+
+foo #(4)           f0( a0 );
+foo #(4)           f1( a1 );
+foo #(.WIDTH(4))   f2( a2 );
+foo #(8)           f3( b0 );
+foo #(2, 1)        f4( c0 );
+foo #(.WIDTH(2))   f5( c1 );
+
+genvar i;
+generate
+  for( i=0; i<3; i=i+1 ) begin : g
+    wire [5:0] d;
+    foo #(6) fg( d );
+  end
+endgenerate
+
+initial begin
+`ifdef DUMP
+        $dumpfile( "share_insts1.vcd" );
+        $dumpvars( 0, main );
+`endif
+        #10;
+        $finish;
+end
+
+endmodule
+
+//-----------------------------------------
+
+module foo( x );
+
+parameter WIDTH = 1;
+parameter INIT  = 0;
+
+output [WIDTH-1:0] x;
+
+reg [WIDTH-1:0] x;
+
+reg [WIDTH-1:0] y;
+
+always @(y)
+  x = y + INIT;
+
+initial begin
+        y = {WIDTH{1'b0}};
+        #5;
+        y = {WIDTH{1'b1}};
+end
+
+endmodule
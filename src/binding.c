@@ -98,6 +98,8 @@ extern unsigned int curr_db;
 extern funit_link*  funit_head;
 extern char         user_msg[USER_MSG_LENGTH];
 extern bool         debug_mode;
+extern bool         flag_display_sim_stats;
+extern int64        largest_malloc_size;
 
 
 /*!
@@ -138,6 +140,8 @@ void bind_add(
   eb->exp            = exp;
   eb->fsm            = NULL;
   eb->staticf        = staticf;
+  eb->sig_depth      = 0;
+  eb->sig_index      = -1;
   eb->next           = NULL;
   
   /* Add new signal/expression binding to linked list */
@@ -152,6 +156,28 @@ void bind_add(
   
 }
 
+/*!
+ Adds the specified signal and expression to the bindings linked list, recording where the signal that the
+ expression was bound to was located when the CDD file was written.  This allows the binding to be performed
+ without searching for the signal by name.
+*/
+void bind_add_indexed(
+  const char*  name,       /*!< Signal scope to bind */
+  expression*  exp,        /*!< Expression to bind */
+  func_unit*   funit,      /*!< Pointer to functional unit containing specified expression */
+  unsigned int sig_depth,  /*!< Number of parent functional units above funit that contain the bound signal */
+  int          sig_index   /*!< Index of the bound signal in the signal array of its functional unit */
+) { PROFILE(BIND_ADD_INDEXED);
+
+  bind_add( 0, name, exp, funit, FALSE );
+
+  eb_tail->sig_depth = sig_depth;
+  eb_tail->sig_index = sig_index;
+
+  PROFILE_END;
+
+}
+
 /*!
  Searches the expression binding list for the entry that matches the given exp and curr_funit
  parameters.  When the entry is found, the FSM expression is added to the exp_bind structure
@@ -403,6 +429,121 @@ static bool bind_param(
 }
 #endif /* RUNLIB */
 
+/*!
+ \throws anonymous expression_set_value
+
+ Links the given expression and signal together after the signal to bind to has been found.
+*/
+static void bind_signal_link(
+  vsignal*    found_sig,       /*!< Pointer to signal to bind to specified expression */
+  expression* exp,             /*!< Pointer to expression to bind */
+  func_unit*  funit_exp,       /*!< Pointer to functional unit containing expression */
+  bool        cdd_reading,     /*!< If set to TRUE, specifies that we are binding after reading a design from a CDD file (instead of the design files) */
+  bool        clear_assigned   /*!< If set to TRUE, clears signal assigned bit */
+) { PROFILE(BIND_SIGNAL_LINK);
+
+#ifndef RUNLIB
+  statement* stmt;  /* Pointer to root statement for the given expression */
+#endif /* RUNLIB */
+
+  /* Bind signal and expression if we are not clearing or this is an MBA */
+  if( !clear_assigned ) {
+
+    /* Add expression to signal expression list */
+    exp_link_add( exp, &(found_sig->exps), &(found_sig->exp_size) );
+
+    /* Set expression to point at signal */
+    exp->sig = found_sig;
+
+    /* If this is a port assignment, we need to link the expression and signal together immediately */
+    if( exp->op == EXP_OP_PASSIGN ) {
+      vector_dealloc( exp->value );
+      exp->suppl.part.owns_vec = 0;
+      exp->value = found_sig->value;
+    }
+
+    if( ((exp->op == EXP_OP_SIG)            ||
+         (exp->op == EXP_OP_SBIT_SEL)       ||
+         (exp->op == EXP_OP_MBIT_SEL)       ||
+         (exp->op == EXP_OP_MBIT_POS)       ||
+         (exp->op == EXP_OP_MBIT_NEG)       ||
+         (exp->op == EXP_OP_PARAM)          ||
+         (exp->op == EXP_OP_PARAM_SBIT)     ||
+         (exp->op == EXP_OP_PARAM_MBIT)     ||
+         (exp->op == EXP_OP_PARAM_MBIT_POS) ||
+         (exp->op == EXP_OP_PARAM_MBIT_NEG) ||
+         (exp->op == EXP_OP_TRIGGER)) &&
+        (cdd_reading || (found_sig->suppl.part.type == SSUPPL_TYPE_GENVAR)) ) {
+      expression_set_value( exp, found_sig, funit_exp );
+    }
+
+#ifndef RUNLIB
+    /*
+     Create a non-blocking assignment handler for the given expression if the attached signal is a memory
+     and the expression is assignable on the LHS of a non-blocking assignment operator.  Only perform this
+     if we are reading from the CDD file and binding.
+    */
+    if( cdd_reading && (found_sig->suppl.part.type == SSUPPL_TYPE_MEM) ) {
+      expression* nba_exp;
+      if( (nba_exp = expression_is_nba_lhs( exp )) != NULL ) {
+        expression_create_nba( exp, found_sig, nba_exp->right->value );
+      }
+    }
+#endif /* RUNLIB */
+
+  }
+
+#ifndef RUNLIB
+  if( !cdd_reading ) {
+
+    /* Check to see if this signal should be assigned by Covered or the dumpfile */
+    if( clear_assigned ) {
+      found_sig->suppl.part.assigned = 0;
+    }
+
+    if( !clear_assigned &&
+        ((exp->op == EXP_OP_SIG)      ||
+         (exp->op == EXP_OP_SBIT_SEL) ||
+         (exp->op == EXP_OP_MBIT_SEL) ||
+         (exp->op == EXP_OP_MBIT_POS) ||
+         (exp->op == EXP_OP_MBIT_NEG)) &&
+        !ovl_is_assertion_module( funit_exp ) ) {
+      expression_set_assigned( exp );
+    }
+
+    /* Set signed bits */
+    if( !clear_assigned ) {
+      expression_set_signed( exp );
+    }
+
+    /*
+     If the signal is found for the given expression but the signal is marked as "must be assigned" but is also marked as
+     "won't be assigned", we need to remove all statement blocks that contain this signal from coverage consideration.
+    */
+    if( (found_sig->suppl.part.assigned == 0) && (found_sig->suppl.part.mba == 1) ) {
+      unsigned int i;
+      for( i=0; i<found_sig->exp_size; i++ ) {
+        if( (stmt = expression_get_root_statement( found_sig->exps[i] )) != NULL ) {
+#ifdef DEBUG_MODE
+          if( debug_mode ) {
+            unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Removing statement block %d, line %d because it needed to be assigned but would not be",
+                                        stmt->exp->id, stmt->exp->line );
+            assert( rv < USER_MSG_LENGTH );
+            print_output( user_msg, DEBUG, __FILE__, __LINE__ );
+          }
+#endif /* DEBUG_MODE */
+          stmt_blk_add_to_remove_list( stmt );
+        }
+      }
+    }
+
+  }
+#endif /* RUNLIB */
+
+  PROFILE_END;
+
+}
+
 /*!
  \return Returns TRUE if bind occurred successfully; otherwise, returns FALSE.
 
@@ -428,7 +569,6 @@ bool bind_signal(
   bool         retval = TRUE;  /* Return value for this function */
   vsignal*     found_sig;      /* Pointer to found signal in design for the given name */
   func_unit*   found_funit;    /* Pointer to found functional unit containing given signal */
-  statement*   stmt;           /* Pointer to root statement for the given expression */
   unsigned int rv;             /* Return value from snprintf calls */
 
   /* Skip signal binding if the name is not local and we are binding locally */
@@ -496,101 +636,7 @@ bool bind_signal(
     }
 
     if( retval ) {
-
-      /* Bind signal and expression if we are not clearing or this is an MBA */
-      if( !clear_assigned ) {
-
-        /* Add expression to signal expression list */
-        exp_link_add( exp, &(found_sig->exps), &(found_sig->exp_size) );
-
-        /* Set expression to point at signal */
-        exp->sig = found_sig;
-
-        /* If this is a port assignment, we need to link the expression and signal together immediately */
-        if( exp->op == EXP_OP_PASSIGN ) {
-          vector_dealloc( exp->value );
-          exp->suppl.part.owns_vec = 0;
-          exp->value = found_sig->value;
-        }
-
-        if( ((exp->op == EXP_OP_SIG)            ||
-             (exp->op == EXP_OP_SBIT_SEL)       ||
-             (exp->op == EXP_OP_MBIT_SEL)       ||
-             (exp->op == EXP_OP_MBIT_POS)       ||
-             (exp->op == EXP_OP_MBIT_NEG)       ||
-             (exp->op == EXP_OP_PARAM)          ||
-             (exp->op == EXP_OP_PARAM_SBIT)     ||
-             (exp->op == EXP_OP_PARAM_MBIT)     ||
-             (exp->op == EXP_OP_PARAM_MBIT_POS) ||
-             (exp->op == EXP_OP_PARAM_MBIT_NEG) ||
-             (exp->op == EXP_OP_TRIGGER)) &&
-            (cdd_reading || (found_sig->suppl.part.type == SSUPPL_TYPE_GENVAR)) ) {
-          expression_set_value( exp, found_sig, funit_exp );
-        }
-
-#ifndef RUNLIB
-        /*
-         Create a non-blocking assignment handler for the given expression if the attached signal is a memory
-         and the expression is assignable on the LHS of a non-blocking assignment operator.  Only perform this
-         if we are reading from the CDD file and binding.
-        */
-        if( cdd_reading && (found_sig->suppl.part.type == SSUPPL_TYPE_MEM) ) {
-          expression* nba_exp;
-          if( (nba_exp = expression_is_nba_lhs( exp )) != NULL ) {
-            expression_create_nba( exp, found_sig, nba_exp->right->value );
-          }
-        }
-#endif /* RUNLIB */
-
-      }
-
-#ifndef RUNLIB
-      if( !cdd_reading ) {
-
-        /* Check to see if this signal should be assigned by Covered or the dumpfile */
-        if( clear_assigned ) {
-          found_sig->suppl.part.assigned = 0;
-        }
-
-        if( !clear_assigned &&
-            ((exp->op == EXP_OP_SIG)      ||
-             (exp->op == EXP_OP_SBIT_SEL) ||
-             (exp->op == EXP_OP_MBIT_SEL) ||
-             (exp->op == EXP_OP_MBIT_POS) ||
-             (exp->op == EXP_OP_MBIT_NEG)) &&
-            !ovl_is_assertion_module( funit_exp ) ) {
-          expression_set_assigned( exp );
-        }
-
-        /* Set signed bits */
-        if( !clear_assigned ) {
-          expression_set_signed( exp );
-        }
-
-        /*
-         If the signal is found for the given expression but the signal is marked as "must be assigned" but is also marked as
-         "won't be assigned", we need to remove all statement blocks that contain this signal from coverage consideration.
-        */
-        if( (found_sig->suppl.part.assigned == 0) && (found_sig->suppl.part.mba == 1) ) {
-          unsigned int i;
-          for( i=0; i<found_sig->exp_size; i++ ) {
-            if( (stmt = expression_get_root_statement( found_sig->exps[i] )) != NULL ) {
-#ifdef DEBUG_MODE
-              if( debug_mode ) {
-                unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Removing statement block %d, line %d because it needed to be assigned but would not be",
-                                            stmt->exp->id, stmt->exp->line );
-                assert( rv < USER_MSG_LENGTH );
-                print_output( user_msg, DEBUG, __FILE__, __LINE__ );
-              }
-#endif /* DEBUG_MODE */
-              stmt_blk_add_to_remove_list( stmt );
-            }
-          }
-        }
-
-      }
-#endif /* RUNLIB */
-
+      bind_signal_link( found_sig, exp, funit_exp, cdd_reading, clear_assigned );
     }
 
   } else {
@@ -748,7 +794,7 @@ static bool bind_task_function_namedblock(
         if( type == FUNIT_FUNCTION ) {
 
           scope_extract_back( found_funit->name, back, rest );
-          sig = sig_link_find( back, found_funit->sigs, found_funit->sig_size );
+          sig = funit_find_local_signal( back, found_funit );
 
           assert( sig != NULL );
 
@@ -796,7 +842,55 @@ static bool bind_task_function_namedblock(
 }
 
 /*!
- \throws anonymous Throw param_resolve bind_signal generate_resolve bind_task_function_namedblock bind_task_function_namedblock
+ \throws anonymous Throw
+
+ \return Returns a pointer to the signal recorded in the CDD file for the given binding if it is still valid;
+         otherwise, returns NULL to indicate that the binding must be resolved by name.
+
+ In debug mode, the recorded signal is also checked against the signal that binding by name would find.
+*/
+static vsignal* bind_find_indexed_signal(
+  const exp_bind* eb  /*!< Pointer to expression binding to look up */
+) { PROFILE(BIND_FIND_INDEXED_SIGNAL);
+
+  vsignal*     sig   = NULL;       /* Pointer to found signal */
+  func_unit*   funit = eb->funit;  /* Pointer to functional unit containing the signal */
+  unsigned int i;
+
+  if( (eb->sig_index >= 0) && (eb->clear_assigned == 0) && (eb->exp != NULL) ) {
+
+    for( i=0; (i<eb->sig_depth) && (funit != NULL); i++ ) {
+      funit = funit->parent;
+    }
+
+    if( (funit != NULL) && ((unsigned int)eb->sig_index < funit->sig_size) && (strcmp( funit->sigs[eb->sig_index]->name, eb->name ) == 0) ) {
+      sig = funit->sigs[eb->sig_index];
+    }
+
+#ifdef DEBUG_MODE
+    if( (sig != NULL) && debug_mode ) {
+      unsigned int depth;
+      int          index;
+      if( !funit_find_signal_ref( eb->name, eb->funit, sig, &depth, &index ) || (depth != eb->sig_depth) || (index != eb->sig_index) ) {
+        unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Recorded binding of signal \"%s\" does not match its binding by name, file %s, line %d",
+                                    obf_sig( eb->name ), obf_file( eb->funit->orig_fname ), eb->line );
+        assert( rv < USER_MSG_LENGTH );
+        print_output( user_msg, FATAL, __FILE__, __LINE__ );
+        Throw 0;
+      }
+    }
+#endif /* DEBUG_MODE */
+
+  }
+
+  PROFILE_END;
+
+  return( sig );
+
+}
+
+/*!
+ \throws anonymous Throw param_resolve bind_signal generate_resolve bind_task_function_namedblock bind_task_function_namedblock bind_find_indexed_signal
 
  In the process of binding, we go through each element of the binding list,
  finding the signal to be bound in the specified tree, adding the expression
@@ -812,6 +906,7 @@ void bind_perform(
   int        id;        /* Current expression id -- used for removal */
   bool       bound;     /* Specifies if the current expression was successfully bound or not */
   statement* tmp_stmt;  /* Pointer to temporary statement */
+  vsignal*   found_sig; /* Pointer to signal recorded in the CDD file for the current binding */
 
   Try {
 
@@ -838,15 +933,26 @@ void bind_perform(
           /* Handle signal/parameter binding */
           if( curr_eb->type == 0 ) {
 
-            /* Attempt to bind the expression to a parameter; otherwise, bind to a signal */
+            /*
+             If the CDD file recorded the signal that this expression was bound to, link them directly (CDD files do not
+             contain module parameters, so the expression cannot bind to a parameter instead).
+            */
+            if( cdd_reading && ((found_sig = bind_find_indexed_signal( curr_eb )) != NULL) ) {
+              if( (bound = (found_sig->suppl.part.not_handled == 0)) ) {
+                bind_signal_link( found_sig, curr_eb->exp, curr_eb->funit, cdd_reading, FALSE );
+              }
+
+            /* Otherwise, attempt to bind the expression to a parameter; otherwise, bind to a signal */
+            } else {
 #ifndef RUNLIB
-            if( !(bound = bind_param( curr_eb->name, curr_eb->exp, curr_eb->funit, curr_eb->line, (pass == 0) )) ) {
+              if( !(bound = bind_param( curr_eb->name, curr_eb->exp, curr_eb->funit, curr_eb->line, (pass == 0) )) ) {
 #endif /* RUNLIB */
-              bound = bind_signal( curr_eb->name, curr_eb->exp, curr_eb->funit, FALSE, cdd_reading,
-                                   (curr_eb->clear_assigned > 0), curr_eb->line, (pass == 0) );
+                bound = bind_signal( curr_eb->name, curr_eb->exp, curr_eb->funit, FALSE, cdd_reading,
+                                     (curr_eb->clear_assigned > 0), curr_eb->line, (pass == 0) );
 #ifndef RUNLIB
-            }
+              }
 #endif /* RUNLIB */
+            }
 
             /* If an FSM expression is attached, size it now */
             if( curr_eb->fsm != NULL ) {
@@ -917,11 +1023,27 @@ void bind_perform(
 #ifndef RUNLIB
       /* If we are in parse mode, resolve all parameters and arrays of instances now */
       if( !cdd_reading && (pass == 0) ) {
-        inst_link* instl = db_list[curr_db]->inst_head;
+        inst_link* instl  = db_list[curr_db]->inst_head;
+        timer*     etimer = NULL;
+        if( flag_display_sim_stats ) {
+          timer_clear( &etimer );
+          timer_start( &etimer );
+        }
         while( instl != NULL ) {
           instance_resolve( instl->inst );
           instl = instl->next;
         }
+        if( flag_display_sim_stats ) {
+          unsigned int rv;
+          timer_stop( &etimer );
+          /*@-duplicatequals -formattype -formatcode@*/
+          rv = snprintf( user_msg, USER_MSG_LENGTH, "Elaborated design in %s (dynamic memory allocated: %" FMT64 "u bytes)",
+                         timer_to_string( etimer ), largest_malloc_size );
+          /*@=duplicatequals =formattype =formatcode@*/
+          assert( rv < USER_MSG_LENGTH );
+          print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+          free_safe( etimer, sizeof( timer ) );
+        }
       }
 #endif /* RUNLIB */
 #endif /* VPI_ONLY */
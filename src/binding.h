@@ -35,6 +35,15 @@ void bind_add(
   bool        staticf
 );
 
+/*! \brief Adds an expression to the binding list along with the index of its signal recorded in the CDD file. */
+void bind_add_indexed(
+  const char*  name,
+  expression*  exp,
+  func_unit*   funit,
+  unsigned int sig_depth,
+  int          sig_index
+);
+
 /*! \brief Appends an FSM expression to a matching expression binding structure */
 void bind_append_fsm_expr(
   expression*       fsm_exp,
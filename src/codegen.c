@@ -66,6 +66,58 @@ extern const exp_info exp_op_info[EXP_OP_NUM];
 */
 bool use_actual_names = FALSE;
 
+/*!
+ Arena containing all of the intermediate strings and string arrays built while generating the code for an
+ expression tree.  Only the final code lines are copied out of the arena for the caller; everything else is
+ released in bulk once the expression has been generated.
+*/
+static str_arena codegen_arena = { NULL, NULL };
+
+
+/*!
+ \return Returns a copy of the given string that is allocated from the code generator arena.
+
+ Moves the given heap-allocated string into the code generator arena, deallocating the original string.
+*/
+static char* codegen_adopt(
+  char* str  /*!< Heap-allocated string to move into the arena */
+) { PROFILE(CODEGEN_ADOPT);
+
+  char* copy = str_arena_strdup( &codegen_arena, str );
+
+  free_safe( str, (strlen( str ) + 1) );
+
+  PROFILE_END;
+
+  return( copy );
+
+}
+
+/*!
+ \return Returns a heap-allocated copy of the given code array.
+
+ Copies the code lines generated in the code generator arena to memory owned by the caller.
+*/
+static char** codegen_export(
+  char**       code,       /*!< Array of code lines allocated from the arena */
+  unsigned int code_depth  /*!< Number of strings contained in code array */
+) { PROFILE(CODEGEN_EXPORT);
+
+  char**       ecode = NULL;
+  unsigned int i;
+
+  if( code_depth > 0 ) {
+    ecode = (char**)malloc_safe( sizeof( char* ) * code_depth );
+    for( i=0; i<code_depth; i++ ) {
+      ecode[i] = strdup_safe( code[i] );
+    }
+  }
+
+  PROFILE_END;
+
+  return( ecode );
+
+}
 
 /*!
  Generates multi-line expression code strings from current, left, and right expressions.
@@ -117,10 +169,7 @@ static void codegen_create_expr_helper(
   //    printf( "code size after middle: %d\n", code_size );
   //  }
   }
-  if( code[code_index] != NULL ) {
-    free_safe( code[code_index], (strlen( code[code_index] ) + 1) );
-  }
-  code[code_index]    = (char*)malloc_safe( code_size + 1 );
+  code[code_index]    = (char*)str_arena_alloc( &codegen_arena, code_size + 1 );
   //printf( "Allocated %d bytes for code[%d]\n", (code_size + 1), code_index );
   code[code_index][0] = '\0';
 
@@ -129,22 +178,16 @@ static void codegen_create_expr_helper(
     assert( rv < (code_size + 1) );
   }
   if( first_same_line ) {
-    tmpstr = strdup_safe( code[code_index] );
-    rv = snprintf( code[code_index], (code_size + 1), "%s%s", tmpstr, left[0] );
-    assert( rv < (code_size + 1) );
-    free_safe( tmpstr, (strlen( tmpstr ) + 1) );
-    free_safe( left[0], (strlen( left[0] ) + 1) );
+    strcat( code[code_index], left[0] );
     if( (left_depth == 1) && (middle != NULL) ) {
       code_size = strlen( code[code_index] ) + strlen( middle );
-      tmpstr    = (char*)malloc_safe( code_size + 1 );
+      tmpstr    = (char*)str_arena_alloc( &codegen_arena, code_size + 1 );
       rv = snprintf( tmpstr, (code_size + 1), "%s%s", code[code_index], middle );
       assert( rv < (code_size + 1) );
       if( right_depth > 0 ) {
         // printf( "A code[%d]:%s.\n", code_index, code[code_index] );
         codegen_create_expr_helper( code, code_index, tmpstr, right, right_depth, last_same_line, last, NULL, 0, FALSE, NULL );
-        free_safe( tmpstr, (strlen( tmpstr ) + 1) );
       } else {
-        free_safe( code[code_index], (strlen( code[code_index] ) + 1) );
         code[code_index] = tmpstr;
       }
     } else {
@@ -153,14 +196,12 @@ static void codegen_create_expr_helper(
           code[code_index+i] = left[i];
         }
         code_size = strlen( left[i] ) + strlen( middle );
-        tmpstr    = (char*)malloc_safe( code_size + 1 );
+        tmpstr    = (char*)str_arena_alloc( &codegen_arena, code_size + 1 );
         rv = snprintf( tmpstr, (code_size + 1), "%s%s", left[i], middle );
         assert( rv < (code_size + 1) );
-        free_safe( left[i], (strlen( left[i] ) + 1) );
         if( right_depth > 0 ) {
           // printf( "B code[%d+%d]:%s.\n", code_index, i, code[code_index] );
           codegen_create_expr_helper( code, (code_index + i), tmpstr, right, right_depth, last_same_line, last, NULL, 0, FALSE, NULL );
-          free_safe( tmpstr, (strlen( tmpstr ) + 1) );
         } else {
           code[code_index+i] = tmpstr;
         }
@@ -176,14 +217,12 @@ static void codegen_create_expr_helper(
         code[code_index+1+i] = left[i];
       }
       code_size = strlen( left[i] ) + strlen( middle );
-      tmpstr    = (char*)malloc_safe( code_size + 1 );
+      tmpstr    = (char*)str_arena_alloc( &codegen_arena, code_size + 1 );
       rv = snprintf( tmpstr, (code_size + 1), "%s%s", left[i], middle );
       assert( rv < (code_size + 1) );
-      free_safe( left[i], (strlen( left[i] ) + 1) );
       if( right_depth > 0 ) {
         // printf( "C code[%d+%d]:%s.\n", code_index, i, code[code_index] );
         codegen_create_expr_helper( code, (code_index + i + 1), tmpstr, right, right_depth, last_same_line, last, NULL, 0, FALSE, NULL );
-        free_safe( tmpstr, (strlen( tmpstr ) + 1) );
       } else {
         code[code_index+i+1] = tmpstr;
       }
@@ -194,6 +233,8 @@ static void codegen_create_expr_helper(
     }
   }
 
+  PROFILE_END;
+
 }
 
 /*!
@@ -283,7 +324,7 @@ static void codegen_create_expr(
 
     }
 
-    *code = (char**)malloc_safe( sizeof( char* ) * (*code_depth) );
+    *code = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) * (*code_depth) );
     for( i=0; i<(*code_depth); i++ ) {
       (*code)[i] = NULL;
     }
@@ -306,6 +347,8 @@ static void codegen_create_expr(
 
   }
 
+  PROFILE_END;
+
 }
 
 /*!
@@ -341,8 +384,8 @@ static void codegen_gen_expr1(
     /* If the current expression will be calculated intermediately, just output the intermediate expression name */
     if( inline_exp && generator_expr_name_needed( expr ) ) {
        
-      *code       = (char**)malloc_safe( sizeof( char* ) );
-      (*code)[0]  = generator_create_expr_name( expr );
+      *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+      (*code)[0]  = codegen_adopt( generator_create_expr_name( expr ) );
       *code_depth = 1;
 
     /* Otherwise, calculate the value as is deemed necessary */
@@ -366,18 +409,18 @@ static void codegen_gen_expr1(
 
         unsigned int data_type = expr->value->suppl.part.data_type;
 
-        *code       = (char**)malloc_safe( sizeof( char* ) );
+        *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
         *code_depth = 1;
 
         if( data_type == VDATA_R64 ) {
 
           assert( expr->value->value.r64->str != NULL );
-          (*code)[0] = strdup_safe( expr->value->value.r64->str );
+          (*code)[0] = str_arena_strdup( &codegen_arena, expr->value->value.r64->str );
 
         } else if( data_type == VDATA_R32 ) {
 
           assert( expr->value->value.r32->str != NULL );
-          (*code)[0] = strdup_safe( expr->value->value.r32->str );
+          (*code)[0] = str_arena_strdup( &codegen_arena, expr->value->value.r32->str );
 
         } else {
 
@@ -388,21 +431,20 @@ static void codegen_gen_expr1(
             if( (strlen( code_format ) == 1) && (expr->parent->expr->op == EXP_OP_NEGATE) ) {
               strcat( code_format, " " );
             }
-            (*code)[0] = strdup_safe( code_format );
+            (*code)[0] = str_arena_strdup( &codegen_arena, code_format );
 
           } else if( ESUPPL_STATIC_BASE( expr->suppl ) == QSTRING ) {
 
             unsigned int slen;
-            tmpstr = vector_to_string( expr->value, QSTRING, FALSE, 0 );
+            tmpstr = codegen_adopt( vector_to_string( expr->value, QSTRING, FALSE, 0 ) );
             slen   = strlen( tmpstr ) + 3;
-            (*code)[0] = (char*)malloc_safe( slen );
+            (*code)[0] = (char*)str_arena_alloc( &codegen_arena, slen );
             rv = snprintf( (*code)[0], slen, "\"%s\"", tmpstr );
             assert( rv < slen );
-            free_safe( tmpstr, (strlen( tmpstr ) + 1) );
 
           } else { 
 
-            (*code)[0] = vector_to_string( expr->value, ESUPPL_STATIC_BASE( expr->suppl ), FALSE, 0 );
+            (*code)[0] = codegen_adopt( vector_to_string( expr->value, ESUPPL_STATIC_BASE( expr->suppl ), FALSE, 0 ) );
 
           }
    
@@ -411,53 +453,51 @@ static void codegen_gen_expr1(
       } else if( (expr->op == EXP_OP_SIG) || (expr->op == EXP_OP_PARAM) ) {
 
         if( use_actual_names ) {
-          tmpstr = strdup_safe( obf_sig( expr->name ) );
+          tmpstr = str_arena_strdup( &codegen_arena, obf_sig( expr->name ) );
         } else {
-          tmpstr = scope_gen_printable( expr->name );
+          tmpstr = codegen_adopt( scope_gen_printable( expr->name ) );
         }
 
         switch( strlen( tmpstr ) ) {
           case 0 :  assert( strlen( tmpstr ) > 0 );  break;
           case 1 :
-            *code       = (char**)malloc_safe( sizeof( char* ) );
-            (*code)[0]  = (char*)malloc_safe( 4 );
+            *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+            (*code)[0]  = (char*)str_arena_alloc( &codegen_arena, 4 );
             *code_depth = 1;
             rv = snprintf( (*code)[0], 4, " %s ", tmpstr );
             assert( rv < 4 );
             break;
           case 2 :
-            *code       = (char**)malloc_safe( sizeof( char* ) );
-            (*code)[0]  = (char*)malloc_safe( 4 );
+            *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+            (*code)[0]  = (char*)str_arena_alloc( &codegen_arena, 4 );
             *code_depth = 1;
             rv = snprintf( (*code)[0], 4, " %s", tmpstr );
             assert( rv < 4 );
             break;
           default :
-            *code       = (char**)malloc_safe( sizeof( char* ) );
-            (*code)[0]  = strdup_safe( tmpstr );
+            *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+            (*code)[0]  = str_arena_strdup( &codegen_arena, tmpstr );
             *code_depth = 1;
             break;
         }
 
-        free_safe( tmpstr, (strlen( tmpstr ) + 1) );
-
       } else if( (expr->op == EXP_OP_SBIT_SEL) || (expr->op == EXP_OP_PARAM_SBIT) ) {
 
         if( (ESUPPL_IS_ROOT( expr->suppl ) == 0) &&
             (expr->parent->expr->op == EXP_OP_DIM) &&
             (expr->parent->expr->right == expr) ) {
-          tmpstr = (char*)malloc_safe( 2 );
+          tmpstr = (char*)str_arena_alloc( &codegen_arena, 2 );
           rv = snprintf( tmpstr, 2, "[" );
           assert( rv < 2 );
         } else {
           unsigned int slen;
           if( use_actual_names ) {
-            pname = strdup_safe( obf_sig( expr->name ) ); 
+            pname = str_arena_strdup( &codegen_arena, obf_sig( expr->name ) ); 
           } else {
-            pname = scope_gen_printable( expr->name );
+            pname = codegen_adopt( scope_gen_printable( expr->name ) );
           }
           slen   = strlen( pname ) + 2;
-          tmpstr = (char*)malloc_safe( slen );
+          tmpstr = (char*)str_arena_alloc( &codegen_arena, slen );
           rv = snprintf( tmpstr, slen, "%s[", pname );
           assert( rv < slen );
         }
@@ -465,26 +505,23 @@ static void codegen_gen_expr1(
         codegen_create_expr( code, code_depth, expr->line, tmpstr, left_code, left_code_depth,
                              expr->left, "]", NULL, 0, NULL, NULL );
 
-        free_safe( tmpstr, (strlen( tmpstr ) + 1) );
-        free_safe( pname, (strlen( pname ) + 1) );
-
       } else if( (expr->op == EXP_OP_MBIT_SEL) || (expr->op == EXP_OP_PARAM_MBIT) ) {
 
         if( (ESUPPL_IS_ROOT( expr->suppl ) == 0) &&
             (expr->parent->expr->op == EXP_OP_DIM) &&
             (expr->parent->expr->right == expr) ) {
-          tmpstr = (char*)malloc_safe( 2 );
+          tmpstr = (char*)str_arena_alloc( &codegen_arena, 2 );
           rv = snprintf( tmpstr, 2, "[" );
           assert( rv < 2 );
         } else {
           unsigned int slen;
           if( use_actual_names ) {
-            pname = strdup_safe( obf_sig( expr->name ) );
+            pname = str_arena_strdup( &codegen_arena, obf_sig( expr->name ) );
           } else {
-            pname = scope_gen_printable( expr->name );
+            pname = codegen_adopt( scope_gen_printable( expr->name ) );
           }
           slen   = strlen( pname ) + 2;
-          tmpstr = (char*)malloc_safe( slen );
+          tmpstr = (char*)str_arena_alloc( &codegen_arena, slen );
           rv = snprintf( tmpstr, slen, "%s[", pname );
           assert( rv < slen );
         }
@@ -499,26 +536,23 @@ static void codegen_gen_expr1(
                                right_code, right_code_depth, expr->right, "]" );
         }
 
-        free_safe( tmpstr, (strlen( tmpstr ) + 1) );
-        free_safe( pname, (strlen( pname ) + 1) );
-
       } else if( (expr->op == EXP_OP_MBIT_POS) || (expr->op == EXP_OP_PARAM_MBIT_POS) ) {
 
         if( (ESUPPL_IS_ROOT( expr->suppl ) == 0) &&
             (expr->parent->expr->op == EXP_OP_DIM) &&
             (expr->parent->expr->right == expr) ) {
-          tmpstr = (char*)malloc_safe( 2 );
+          tmpstr = (char*)str_arena_alloc( &codegen_arena, 2 );
           rv = snprintf( tmpstr, 2, "[" );
           assert( rv < 2 );
         } else {
           unsigned int slen;
           if( use_actual_names ) {
-            pname = strdup_safe( obf_sig( expr->name ) );
+            pname = str_arena_strdup( &codegen_arena, obf_sig( expr->name ) );
           } else {
-            pname = scope_gen_printable( expr->name );
+            pname = codegen_adopt( scope_gen_printable( expr->name ) );
           } 
           slen   = strlen( pname ) + 2;
-          tmpstr = (char*)malloc_safe( slen );
+          tmpstr = (char*)str_arena_alloc( &codegen_arena, slen );
           rv = snprintf( tmpstr, slen, "%s[", pname );
           assert( rv < slen );
         }
@@ -526,26 +560,23 @@ static void codegen_gen_expr1(
         codegen_create_expr( code, code_depth, expr->line, tmpstr, left_code, left_code_depth, expr->left, "+:",
                              right_code, right_code_depth, expr->right, "]" );
 
-        free_safe( tmpstr, (strlen( tmpstr ) + 1) );
-        free_safe( pname, (strlen( pname ) + 1) );
-
       } else if( (expr->op == EXP_OP_MBIT_NEG) || (expr->op == EXP_OP_PARAM_MBIT_NEG) ) {
 
         if( (ESUPPL_IS_ROOT( expr->suppl ) == 0) &&
             (expr->parent->expr->op == EXP_OP_DIM) &&
             (expr->parent->expr->right == expr) ) {
-          tmpstr = (char*)malloc_safe( 2 );
+          tmpstr = (char*)str_arena_alloc( &codegen_arena, 2 );
           rv = snprintf( tmpstr, 2, "[" );
           assert( rv < 2 );
         } else {
           unsigned int slen;
           if( use_actual_names ) {
-            pname = strdup_safe( obf_sig( expr->name ) );
+            pname = str_arena_strdup( &codegen_arena, obf_sig( expr->name ) );
           } else {
-            pname = scope_gen_printable( expr->name );
+            pname = codegen_adopt( scope_gen_printable( expr->name ) );
           }
           slen   = strlen( pname ) + 2;
-          tmpstr = (char*)malloc_safe( slen );
+          tmpstr = (char*)str_arena_alloc( &codegen_arena, slen );
           rv = snprintf( tmpstr, slen, "%s[", pname );
           assert( rv < slen );
         }
@@ -553,125 +584,113 @@ static void codegen_gen_expr1(
         codegen_create_expr( code, code_depth, expr->line, tmpstr, left_code, left_code_depth, expr->left, "-:",
                              right_code, right_code_depth, expr->right, "]" );
 
-        free_safe( tmpstr, (strlen( tmpstr ) + 1) );
-        free_safe( pname, (strlen( pname ) + 1) );
-
       } else if( (expr->op == EXP_OP_FUNC_CALL) || (expr->op == EXP_OP_TASK_CALL) ) {
 
         assert( expr->elem.funit != NULL );
 
         tfunit = expr->elem.funit;
-        after = (char*)malloc_safe( strlen( tfunit->name ) + 1 );
+        after = (char*)str_arena_alloc( &codegen_arena, strlen( tfunit->name ) + 1 );
         scope_extract_back( tfunit->name, after, user_msg );
         if( use_actual_names ) {
-          pname = strdup_safe( obf_sig( after ) );
+          pname = str_arena_strdup( &codegen_arena, obf_sig( after ) );
         } else {
-          pname = scope_gen_printable( after );
+          pname = codegen_adopt( scope_gen_printable( after ) );
         }
         if( (expr->op == EXP_OP_TASK_CALL) && (expr->left == NULL) ) {
-          *code       = (char**)malloc_safe( sizeof( char* ) );
-          (*code)[0]  = strdup_safe( pname );
+          *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+          (*code)[0]  = str_arena_strdup( &codegen_arena, pname );
           *code_depth = 1;
         } else {
           unsigned int slen;
-          tmpstr = (char*)malloc_safe( strlen( pname ) + 3 );
+          tmpstr = (char*)str_arena_alloc( &codegen_arena, strlen( pname ) + 3 );
           slen   = strlen( pname ) + 3;
           rv = snprintf( tmpstr, slen, "%s( ", pname );
           assert( rv < slen );
           codegen_create_expr( code, code_depth, expr->line, tmpstr, left_code, left_code_depth, expr->left, " )", NULL, 0, NULL, NULL );
-          free_safe( tmpstr, (strlen( tmpstr ) + 1) );
         }
-        free_safe( after, (strlen( tfunit->name ) + 1) );
-        free_safe( pname, (strlen( pname ) + 1) );
 
       } else if( expr->op == EXP_OP_TRIGGER ) {
         unsigned int slen;
         assert( expr->sig != NULL );
         if( use_actual_names ) {
-          pname = strdup_safe( obf_sig( expr->name ) );
+          pname = str_arena_strdup( &codegen_arena, obf_sig( expr->name ) );
         } else {
-          pname = scope_gen_printable( expr->name );
+          pname = codegen_adopt( scope_gen_printable( expr->name ) );
         }
         slen   = strlen( pname ) + 3;
-        tmpstr = (char*)malloc_safe( slen );
+        tmpstr = (char*)str_arena_alloc( &codegen_arena, slen );
         rv = snprintf( tmpstr, slen, "->%s", pname );
         assert( rv < slen );
 
-        *code       = (char**)malloc_safe( sizeof( char* ) );
-        (*code)[0]  = strdup_safe( tmpstr );
+        *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+        (*code)[0]  = str_arena_strdup( &codegen_arena, tmpstr );
         *code_depth = 1;
 
-        free_safe( tmpstr, (strlen( tmpstr ) + 1) );
-        free_safe( pname, (strlen( pname ) + 1) );
-
       } else if( expr->op == EXP_OP_DISABLE ) {
 
         unsigned int slen;
         assert( expr->elem.funit != NULL );
         if( use_actual_names ) {
-          pname = strdup_safe( obf_sig( expr->name ) );
+          pname = str_arena_strdup( &codegen_arena, obf_sig( expr->name ) );
         } else {
-          pname = scope_gen_printable( expr->name );
+          pname = codegen_adopt( scope_gen_printable( expr->name ) );
         }
         slen   = strlen( pname ) + 9;
-        tmpstr = (char*)malloc_safe( slen );
+        tmpstr = (char*)str_arena_alloc( &codegen_arena, slen );
         rv = snprintf( tmpstr, slen, "disable %s", pname );
         assert( rv < slen );
 
-        *code       = (char**)malloc_safe( sizeof( char* ) );
-        (*code)[0]  = strdup_safe( tmpstr );
+        *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+        (*code)[0]  = str_arena_strdup( &codegen_arena, tmpstr );
         *code_depth = 1;
 
-        free_safe( tmpstr, (strlen( tmpstr ) + 1) );
-        free_safe( pname, (strlen( pname ) + 1) );
-
       } else if( expr->op == EXP_OP_DEFAULT ) {
 
-        *code       = (char**)malloc_safe( sizeof( char* ) );
-        (*code)[0]  = strdup_safe( "default :" );
+        *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+        (*code)[0]  = str_arena_strdup( &codegen_arena, "default :" );
         *code_depth = 1;
 
       } else if( expr->op == EXP_OP_SLIST ) {
   
-        *code       = (char**)malloc_safe( sizeof( char* ) );
-        (*code)[0]  = strdup_safe( "@*" );
+        *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+        (*code)[0]  = str_arena_strdup( &codegen_arena, "@*" );
         *code_depth = 1;
 
       } else if( expr->op == EXP_OP_ALWAYS_COMB ) {
  
-        *code       = (char**)malloc_safe( sizeof( char* ) );
-        (*code)[0]  = strdup_safe( "always_comb" );
+        *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+        (*code)[0]  = str_arena_strdup( &codegen_arena, "always_comb" );
         *code_depth = 1;
 
       } else if( expr->op == EXP_OP_ALWAYS_LATCH ) {
 
-        *code       = (char**)malloc_safe( sizeof( char* ) );
-        (*code)[0]  = strdup_safe( "always_latch" );
+        *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+        (*code)[0]  = str_arena_strdup( &codegen_arena, "always_latch" );
         *code_depth = 1;
 
       } else if( expr->op == EXP_OP_STIME ) {
    
-        *code       = (char**)malloc_safe( sizeof( char* ) );
-        (*code)[0]  = strdup_safe( "$time" );
+        *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+        (*code)[0]  = str_arena_strdup( &codegen_arena, "$time" );
         *code_depth = 1;
 
       } else if( (expr->op == EXP_OP_SRANDOM) && (expr->left == NULL) ) {
 
-        *code       = (char**)malloc_safe( sizeof( char* ) );
-        (*code)[0]  = strdup_safe( "$random" );
+        *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+        (*code)[0]  = str_arena_strdup( &codegen_arena, "$random" );
         *code_depth = 1;
 
       } else if( (expr->op == EXP_OP_SURANDOM) && (expr->left == NULL) ) {
  
-        *code       = (char**)malloc_safe( sizeof( char* ) );
-        (*code)[0]  = strdup_safe( "$urandom" );
+        *code       = (char**)str_arena_alloc( &codegen_arena, sizeof( char* ) );
+        (*code)[0]  = str_arena_strdup( &codegen_arena, "$urandom" );
         *code_depth = 1;
 
       } else {
 
         if( expr->suppl.part.parenthesis ) {
-          before = strdup_safe( "(" );
-          after  = strdup_safe( ")" );
+          before = str_arena_strdup( &codegen_arena, "(" );
+          after  = str_arena_strdup( &codegen_arena, ")" );
         } else {
           before = NULL;
           after  = NULL;
@@ -839,7 +858,7 @@ static void codegen_gen_expr1(
                                  right_code, right_code_depth, expr->right, NULL );
             break;
           case EXP_OP_UINV     :
-            before = expr->suppl.part.parenthesis ? strdup_safe( "(~" ) : strdup_safe( "~" );
+            before = expr->suppl.part.parenthesis ? str_arena_strdup( &codegen_arena, "(~" ) : str_arena_strdup( &codegen_arena, "~" );
             codegen_create_expr( code, code_depth, expr->line, (expr->suppl.part.parenthesis ? "(~" : "~"), right_code, right_code_depth, expr->right, after,
                                  NULL, 0, NULL, NULL );
             break;
@@ -1076,24 +1095,14 @@ static void codegen_gen_expr1(
           default:  break;
         }
 
-        /* Deallocate before and after strings */
-        free_safe( before, (strlen( before ) + 1) );
-        free_safe( after, (strlen( after ) + 1) );
-
-      }
-
-      if( right_code_depth > 0 ) {
-        free_safe( right_code, (sizeof( char* ) * right_code_depth) );
-      }
-
-      if( left_code_depth > 0 ) {
-        free_safe( left_code, (sizeof( char* ) * left_code_depth) );
       }
 
     }
 
   }
 
+  PROFILE_END;
+
 }
 
 /*!
@@ -1108,7 +1117,15 @@ void codegen_gen_expr(
 ) { PROFILE(CODEGEN_GEN_EXPR);
 
   if( expr != NULL ) {
-    codegen_gen_expr1( expr, expr->op, code, code_depth, funit, FALSE ); 
+
+    char** arena_code;
+
+    codegen_gen_expr1( expr, expr->op, &arena_code, code_depth, funit, FALSE );
+
+    /* Copy the generated lines out of the arena and release everything else in bulk */
+    *code = codegen_export( arena_code, *code_depth );
+    str_arena_reset( &codegen_arena );
+
   }
 
   PROFILE_END;
@@ -1149,11 +1166,9 @@ char* codegen_gen_expr_one_line(
     /* The number of elements in the code_array array should only be one */
     assert( code_depth == 1 );
 
-    /* Save the line for returning purposes */
-    code_str = code_array[0];
-
-    /* Deallocate the string array */
-    free_safe( code_array, (sizeof( char* ) * code_depth) );
+    /* Save the line for returning purposes and release the rest of the generated strings in bulk */
+    code_str = strdup_safe( code_array[0] );
+    str_arena_reset( &codegen_arena );
 
     /* Restore the original values of flag_use_line_width and line_width */
     flag_use_line_width = orig_flag_use_line_width;
@@ -1168,3 +1183,14 @@ char* codegen_gen_expr_one_line(
 
 }
 
+
+/*!
+ Deallocates the memory blocks held by the code generator arena.
+*/
+void codegen_dealloc() { PROFILE(CODEGEN_DEALLOC);
+
+  str_arena_dealloc( &codegen_arena );
+
+  PROFILE_END;
+
+}
@@ -41,5 +41,8 @@ char* codegen_gen_expr_one_line(
   bool         inline_exp
 );
 
+/*! \brief Deallocates the memory held by the code generator. */
+void codegen_dealloc();
+
 #endif
 
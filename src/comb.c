@@ -74,6 +74,7 @@
 #include "obfuscate.h"
 #include "ovl.h"
 #include "report.h"
+#include "tree.h"
 #include "util.h"
 #include "vector.h"
 
@@ -84,6 +85,7 @@ extern bool           report_covered;
 extern unsigned int   report_comb_depth;
 extern bool           report_instance;
 extern bool           report_bitwise;
+extern bool           flag_use_line_width;
 extern int            line_width;
 extern char           user_msg[USER_MSG_LENGTH];
 extern const exp_info exp_op_info[EXP_OP_NUM];
@@ -98,6 +100,19 @@ extern unsigned int   inline_comb_depth;
 */
 bool allow_multi_expr = TRUE;
 
+/*!
+ Cache of the code lines generated for the root expressions that have been output in this session.  Each entry
+ is keyed by the functional unit name, expression ID and line width and contains the newline-separated code lines
+ so that instances of the same module (and the GUI when an expression is reopened) do not regenerate the code.
+*/
+static tnode* comb_code_cache = NULL;
+
+/*!
+ Arena containing the underline stacks built for the expression currently being output.  The arena is reset
+ once the underlines of each expression have been displayed or copied for the GUI.
+*/
+static str_arena comb_arena = { NULL, NULL };
+
 
 /*!
  \return Returns new depth value for specified child expression.
@@ -570,6 +585,139 @@ void combination_get_stats(
 
 }
 
+/*!
+ Recursively copies the underline ID and combination counted bit of each expression in the given expression tree to
+ the given array (if save is TRUE) or from the given array (if save is FALSE).  If data is NULL, the expressions are
+ only counted.
+*/
+static void combination_copy_tree_ulids(
+  expression*   exp,    /*!< Pointer to expression tree to copy */
+  int*          data,   /*!< Array containing two entries for each expression (or NULL) */
+  unsigned int* index,  /*!< Pointer to the current index in the data array */
+  bool          save    /*!< Set to TRUE to copy from the expressions to the array */
+) { PROFILE(COMBINATION_COPY_TREE_ULIDS);
+
+  if( exp != NULL ) {
+
+    combination_copy_tree_ulids( exp->left,  data, index, save );
+    combination_copy_tree_ulids( exp->right, data, index, save );
+
+    if( data == NULL ) {
+      (*index) += 2;
+    } else if( save ) {
+      data[(*index)++] = exp->ulid;
+      data[(*index)++] = exp->suppl.part.comb_cntd;
+    } else {
+      exp->ulid                 = data[(*index)++];
+      exp->suppl.part.comb_cntd = data[(*index)++];
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Copies the underline IDs and combination counted bits of the expressions traversed by combination_get_stats
+ for the given functional unit to or from the given array.  If data is NULL, the number of array entries needed
+ is stored in index.
+*/
+static void combination_copy_ulids(
+  func_unit*    funit,  /*!< Pointer to functional unit to copy */
+  int*          data,   /*!< Array containing two entries for each expression (or NULL) */
+  unsigned int* index,  /*!< Pointer to the current index in the data array */
+  bool          save    /*!< Set to TRUE to copy from the expressions to the array */
+) { PROFILE(COMBINATION_COPY_ULIDS);
+
+  func_iter  fi;
+  statement* stmt;
+
+  if( !funit_is_unnamed( funit ) ) {
+
+    func_iter_init( &fi, funit, TRUE, FALSE, FALSE );
+
+    while( (stmt = func_iter_get_next_statement( &fi )) != NULL ) {
+      combination_copy_tree_ulids( stmt->exp, data, index, save );
+    }
+
+    func_iter_dealloc( &fi );
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if the underline IDs were successfully written; otherwise, returns FALSE.
+
+ Writes the underline IDs and combination counted bits that were assigned by combination_get_stats for the
+ given functional unit to the specified file.  Called by report worker processes so that the parent process
+ can display the verbose combinational logic report without recalculating the statistics.
+*/
+bool combination_write_ulids(
+  func_unit* funit,  /*!< Pointer to functional unit to write underline IDs for */
+  FILE*      ofile   /*!< File to write underline IDs to */
+) { PROFILE(COMBINATION_WRITE_ULIDS);
+
+  bool         retval = TRUE;
+  unsigned int num    = 0;
+  unsigned int index  = 0;
+
+  combination_copy_ulids( funit, NULL, &num, TRUE );
+
+  if( fwrite( &num, sizeof( unsigned int ), 1, ofile ) != 1 ) {
+    retval = FALSE;
+  } else if( num > 0 ) {
+    int* data = (int*)malloc_safe( sizeof( int ) * num );
+    combination_copy_ulids( funit, data, &index, TRUE );
+    retval = (fwrite( data, sizeof( int ), num, ofile ) == num);
+    free_safe( data, (sizeof( int ) * num) );
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if the underline IDs were successfully read; otherwise, returns FALSE.
+
+ Reads the underline IDs and combination counted bits written by combination_write_ulids for the given functional
+ unit from the specified file.  The expressions are only modified if all of their values were read.
+*/
+bool combination_read_ulids(
+  func_unit* funit,  /*!< Pointer to functional unit to read underline IDs for */
+  FILE*      ifile   /*!< File to read underline IDs from */
+) { PROFILE(COMBINATION_READ_ULIDS);
+
+  bool         retval   = TRUE;
+  unsigned int expected = 0;
+  unsigned int num;
+  unsigned int index    = 0;
+
+  combination_copy_ulids( funit, NULL, &expected, FALSE );
+
+  if( (fread( &num, sizeof( unsigned int ), 1, ifile ) != 1) || (num != expected) ) {
+    retval = FALSE;
+  } else if( num > 0 ) {
+    int* data = (int*)malloc_safe( sizeof( int ) * num );
+    if( fread( data, sizeof( int ), num, ifile ) == num ) {
+      combination_copy_ulids( funit, data, &index, FALSE );
+    } else {
+      retval = FALSE;
+    }
+    free_safe( data, (sizeof( int ) * num) );
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
 /*!
  Retrieves the combinational logic summary information for the specified functional unit
 */
@@ -924,7 +1072,7 @@ static void combination_underline_tree(
   l_lines     = NULL;
   r_lines     = NULL;
   comb_missed = 0;
-  code_fmt    = (char*)malloc_safe( 300 );
+  code_fmt    = (char*)str_arena_alloc( &comb_arena, 300 );
 
   if( exp != NULL ) {
 
@@ -1272,13 +1420,13 @@ static void combination_underline_tree(
           unsigned int i;
                 
           /* Allocate all memory for the stack */
-          *lines = (char**)malloc_safe( sizeof( char* ) * (*depth) );
+          *lines = (char**)str_arena_alloc( &comb_arena, sizeof( char* ) * (*depth) );
 
           /* Create underline or space */
           if( comb_missed == 1 ) {
 
             /* Allocate memory for this underline */
-            (*lines)[(*depth)-1] = (char*)malloc_safe( *size + 1 );
+            (*lines)[(*depth)-1] = (char*)str_arena_alloc( &comb_arena, *size + 1 );
 
             if( center ) {
               combination_draw_centered_line( (*lines)[(*depth)-1], *size, ulid, TRUE, TRUE );
@@ -1291,29 +1439,23 @@ static void combination_underline_tree(
           /* Combine the left and right line stacks */
           for( i=0; i<(*depth - comb_missed); i++ ) {
 
-            (*lines)[i] = (char*)malloc_safe( *size + 1 );
+            (*lines)[i] = (char*)str_arena_alloc( &comb_arena, *size + 1 );
 
             if( (i < l_depth) && (i < r_depth) ) {
             
               /* Merge left and right lines */
               rv = snprintf( (*lines)[i], (*size + 1), code_fmt, l_lines[i], r_lines[i] );
               assert( rv < (*size + 1) );
-            
-              free_safe( l_lines[i], (strlen( l_lines[i] ) + 1) );
-              free_safe( r_lines[i], (strlen( r_lines[i] ) + 1) );
 
             } else if( i < l_depth ) {
             
               /* Create spaces for right side */
-              exp_sp = (char*)malloc_safe( r_size + 1 );
+              exp_sp = (char*)str_arena_alloc( &comb_arena, r_size + 1 );
               gen_char_string( exp_sp, ' ', r_size );
 
               /* Merge left side only */
               rv = snprintf( (*lines)[i], (*size + 1), code_fmt, l_lines[i], exp_sp );
               assert( rv < (*size + 1) );
-            
-              free_safe( l_lines[i], (strlen( l_lines[i] ) + 1) );
-              free_safe( exp_sp, (r_size + 1) );
 
             } else if( i < r_depth ) {
 
@@ -1325,18 +1467,14 @@ static void combination_underline_tree(
               } else {
 
                 /* Create spaces for left side */
-                exp_sp = (char*)malloc_safe( l_size + 1 );
+                exp_sp = (char*)str_arena_alloc( &comb_arena, l_size + 1 );
                 gen_char_string( exp_sp, ' ', l_size );
 
                 /* Merge right side only */
                 rv = snprintf( (*lines)[i], (*size + 1), code_fmt, exp_sp, r_lines[i] );
                 assert( rv < (*size + 1) );
-              
-                free_safe( exp_sp, (l_size + 1) );
           
               }
-  
-              free_safe( r_lines[i], (strlen( r_lines[i] ) + 1) );
    
             } else {
 
@@ -1347,34 +1485,12 @@ static void combination_underline_tree(
 
           }
 
-          /* Free left child stack */
-          if( l_depth > 0 ) {
-            free_safe( l_lines, (sizeof( char* ) * l_depth) );
-          }
-
-          /* Free right child stack */
-          if( r_depth > 0 ) {
-            free_safe( r_lines, (sizeof( char* ) * r_depth) );
-          }
-
         }
 
       } Catch_anonymous {
-        unsigned int i;
-        for( i=0; i<(*depth - comb_missed); i++ ) {
-          free_safe( (*lines)[i], (strlen( (*lines)[i] ) + 1) );
-        }
-        free_safe( *lines, (sizeof( char* ) * (*depth - comb_missed)) );
+        /* The partially built underlines are released with the rest of the arena */
         *lines = NULL;
         *depth = 0;
-        for( i=0; i<l_depth; i++ ) {
-          free_safe( l_lines[i], (strlen( l_lines[i] ) + 1) );
-        }
-        free_safe( l_lines, (sizeof( char* ) * l_depth) );
-        for( i=0; i<r_depth; i++ ) {
-          free_safe( r_lines[i], (strlen( r_lines[i] ) + 1) );
-        }
-        free_safe( r_lines, (sizeof( char* ) * r_depth) );
         Throw 0;
       }
 
@@ -1382,9 +1498,6 @@ static void combination_underline_tree(
 
   }
 
-  /* Deallocate memory */
-  free_safe( code_fmt, 300 );
-
   PROFILE_END;
     
 }
@@ -1415,9 +1528,9 @@ static char* combination_prep_line(
   bool  line_seen = FALSE;  /* Specifies that a line has been seen for this line */
   int   start_ul  = 0;      /* Index of starting underline */
 
-  /* Allocate memory for string to return */
+  /* Allocate memory for the prepared line from the underline arena */
   str_size = len + 2;
-  str      = (char*)malloc_safe( str_size );
+  str      = (char*)str_arena_alloc( &comb_arena, str_size );
 
   i          = 0;
   curr_index = 0;
@@ -1466,7 +1579,9 @@ static char* combination_prep_line(
   if( line_ip ) {
     /* If our pointer exceeded the allotted size, resize the str to fit */
     if( i > (start + len) ) {
-      str      = (char*)realloc_safe( str, str_size, (len + 2 + (i - (start + len))) );
+      newstr   = (char*)str_arena_alloc( &comb_arena, (len + 2 + (i - (start + len))) );
+      memcpy( newstr, str, curr_index );
+      str      = newstr;
       str_size = (len + 2 + (i - (start + len)));
     }
     if( start_ul >= start ) {
@@ -1486,9 +1601,6 @@ static char* combination_prep_line(
     newstr = strdup_safe( str );
   }
 
-  /* The str may be a bit oversized, so we copied it and now free it here (where we know its allocated size) */
-  free_safe( str, str_size );
-
   PROFILE_END;
 
   return( newstr );
@@ -1550,18 +1662,13 @@ static void combination_underline(
 
   }
 
-  for( i=0; i<depth; i++ ) {
-    free_safe( lines[i], (strlen( lines[i] ) + 1) );
-  }
-
-  if( depth > 0 ) {
-    free_safe( lines, (sizeof( char* ) * depth) );
-  }
-
   if( code_depth > 0 ) {
     free_safe( code, (sizeof( char* ) * code_depth) );
   }
 
+  /* Release the underline stack in bulk */
+  str_arena_reset( &comb_arena );
+
   PROFILE_END;
 
 }
@@ -2588,6 +2695,98 @@ static void combination_output_expr(
 
 }
 
+/*!
+ Generates the code lines for the given root expression, retrieving them from the code cache if they were
+ already generated for the same functional unit and line width.  The returned code array is newly allocated
+ and is owned by the caller in the same manner as the output of codegen_gen_expr.
+*/
+static void combination_gen_code(
+            expression*   exp,         /*!< Pointer to root expression to generate code for */
+            func_unit*    funit,       /*!< Pointer to functional unit containing the expression */
+  /*@out@*/ char***       code,        /*!< Pointer to array of strings that will contain code lines for the expression */
+  /*@out@*/ unsigned int* code_depth   /*!< Pointer to number of strings contained in code array */
+) { PROFILE(COMBINATION_GEN_CODE);
+
+  char         key[4096];
+  int          width = flag_use_line_width ? line_width : 0;
+  tnode*       node;
+  unsigned int rv;
+
+  rv = snprintf( key, 4096, "%s %d %d", funit->name, exp->id, width );
+  assert( rv < 4096 );
+
+  if( (node = tree_find( key, comb_code_cache )) != NULL ) {
+
+    char*        ptr = node->value;
+    char*        end;
+    unsigned int i;
+
+    /* Count the number of lines stored in the cache entry */
+    *code_depth = 1;
+    while( (ptr = strchr( ptr, '\n' )) != NULL ) {
+      (*code_depth)++;
+      ptr++;
+    }
+
+    /* Split the cached lines into a newly allocated code array */
+    *code = (char**)malloc_safe( sizeof( char* ) * (*code_depth) );
+    ptr   = node->value;
+    for( i=0; i<*code_depth; i++ ) {
+      unsigned int len = ((end = strchr( ptr, '\n' )) != NULL) ? (end - ptr) : strlen( ptr );
+      (*code)[i] = (char*)malloc_safe( len + 1 );
+      strncpy( (*code)[i], ptr, len );
+      (*code)[i][len] = '\0';
+      ptr += len + 1;
+    }
+
+  } else {
+
+    codegen_gen_expr( exp, funit, code, code_depth );
+
+    if( *code_depth > 0 ) {
+
+      char*        value;
+      unsigned int size = 0;
+      unsigned int i;
+
+      /* Join the generated lines and store them in the cache */
+      for( i=0; i<*code_depth; i++ ) {
+        size += strlen( (*code)[i] ) + 1;
+      }
+      value    = (char*)malloc_safe( size );
+      value[0] = '\0';
+      for( i=0; i<*code_depth; i++ ) {
+        if( i > 0 ) {
+          strcat( value, "\n" );
+        }
+        strcat( value, (*code)[i] );
+      }
+      (void)tree_add( key, value, FALSE, &comb_code_cache );
+      free_safe( value, size );
+
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Deallocates the combinational logic code cache and the blocks of the underline arena.  Called when the current
+ database is closed since the cached code is only valid for the functional units of that database.
+*/
+void combination_dealloc_caches() { PROFILE(COMBINATION_DEALLOC_CACHES);
+
+  tree_dealloc( comb_code_cache );
+  comb_code_cache = NULL;
+
+  str_arena_dealloc( &comb_arena );
+
+  PROFILE_END;
+
+}
+
 /*!
  \throws anonymous combination_underline
 
@@ -2641,7 +2840,7 @@ static void combination_display_verbose(
       fprintf( ofile, "      =========================================================================================================\n" );
 
       /* Generate line of code that missed combinational coverage */
-      codegen_gen_expr( stmt->exp, funit, &code, &code_depth );
+      combination_gen_code( stmt->exp, funit, &code, &code_depth );
 
       /* Output underlining feature for missed expressions */
       combination_underline( ofile, code, code_depth, stmt->exp, funit );
@@ -2877,10 +3076,10 @@ static void combination_get_exclude_list(
 
       exclude_reason* er;
      
-      if( (exp->ulid > 0) && ((unsigned int)exp->ulid > *exclude_size) ) {
+      if( (exp->ulid > 0) && ((unsigned int)exp->ulid >= *exclude_size) ) {
         int i;
-        *excludes = (int*)realloc_safe( *excludes, (sizeof( int ) * exp->ulid), (sizeof( int ) * (exp->ulid + 1)) );
-        *reasons  = (char**)realloc_safe( *reasons, (sizeof( int ) * exp->ulid), (sizeof( int ) * (exp->ulid + 1)) );
+        *excludes = (int*)realloc_safe( *excludes, (sizeof( int ) * (*exclude_size)), (sizeof( int ) * (exp->ulid + 1)) );
+        *reasons  = (char**)realloc_safe( *reasons, (sizeof( char* ) * (*exclude_size)), (sizeof( char* ) * (exp->ulid + 1)) );
         for( i=*exclude_size; i<exp->ulid; i++ ) {
           (*excludes)[i] = 0;
           (*reasons)[i]  = NULL;
@@ -2946,7 +3145,7 @@ void combination_get_expression(
   assert( exp != NULL );
 
   /* Generate line of code that missed combinational coverage */
-  codegen_gen_expr( exp, funit, code, code_size );
+  combination_gen_code( exp, funit, code, code_size );
   *uline_groups = (int*)malloc_safe( sizeof( int ) * (*code_size) );
 
   /* Generate exclude information */
@@ -2962,6 +3161,7 @@ void combination_get_expression(
   
   } Catch_anonymous {
     unsigned int i;
+    str_arena_reset( &comb_arena );
     free_safe( *uline_groups, (sizeof( int ) * (*code_size)) );
     *uline_groups = NULL;
     for( i=0; i<*code_size; i++ ) {
@@ -2986,10 +3186,13 @@ void combination_get_expression(
     (*uline_groups)[i] = 0;
 
     if( *code_size == 1 ) {
-      *ulines            = tmp_ulines;
+      free_safe( *ulines, (sizeof( char* ) * uline_max) );
+      *ulines = (tmp_uline_size > 0) ? (char**)malloc_safe( sizeof( char* ) * tmp_uline_size ) : NULL;
+      for( j=0; j<tmp_uline_size; j++ ) {
+        (*ulines)[j] = strdup_safe( tmp_ulines[j] );
+      }
       *uline_size        = tmp_uline_size;
       (*uline_groups)[0] = tmp_uline_size;
-      tmp_uline_size     = 0;
     } else {
       for( j=0; j<tmp_uline_size; j++ ) {
         if( ((*ulines)[*uline_size] = combination_prep_line( tmp_ulines[j], start, strlen( (*code)[i] ) )) != NULL ) {
@@ -3007,13 +3210,8 @@ void combination_get_expression(
 
   }
 
-  for( i=0; i<tmp_uline_size; i++ ) {
-    free_safe( tmp_ulines[i], (strlen( tmp_ulines[i] ) + 1) );
-  }
-
-  if( tmp_uline_size > 0 ) {
-    free_safe( tmp_ulines, (sizeof( char* ) * tmp_uline_size) );
-  }
+  /* Release the underline stack in bulk */
+  str_arena_reset( &comb_arena );
 
   PROFILE_END;
 
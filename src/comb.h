@@ -53,6 +53,18 @@ void combination_get_stats(
   /*@out@*/ unsigned int* total
 );
 
+/*! \brief Writes the underline IDs assigned while calculating combination logic statistics to a file */
+bool combination_write_ulids(
+  func_unit* funit,
+  FILE*      ofile
+);
+
+/*! \brief Reads the underline IDs written by combination_write_ulids from a file */
+bool combination_read_ulids(
+  func_unit* funit,
+  FILE*      ifile
+);
+
 /*! \brief Collects all toggle expressions that match the specified coverage indication. */
 void combination_collect(
             func_unit*    funit,
@@ -99,6 +111,9 @@ void combination_get_coverage(
   /*@out@*/ int*       info_size
 );
 
+/*! \brief Deallocates the cached combinational logic code and underline memory. */
+void combination_dealloc_caches();
+
 /*! \brief Generates report output for combinational logic coverage. */
 void combination_report(
   FILE* ofile,
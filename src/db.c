@@ -32,9 +32,12 @@
 
 #include "attr.h"
 #include "binding.h"
+#include "codegen.h"
+#include "comb.h"
 #include "db.h"
 #include "defines.h"
 #include "enumerate.h"
+#include "exclude.h"
 #include "expr.h"
 #include "fsm.h"
 #include "func_unit.h"
@@ -110,6 +113,28 @@ int curr_inst_scope_size = 0;
 */
 /*@null@*/ funit_inst* curr_instance = NULL;
 
+/*!
+ Index of the child scopes of every instance in the current design.  Built when the first dumpfile scope
+ is set so that each VCD scope level can be resolved from the instance of its parent scope.
+*/
+/*@null@*/ static inst_index* vcd_inst_index = NULL;
+
+/*!
+ Array containing the instance that each resolved level of curr_inst_scope refers to (NULL if the level does
+ not reside in the design).
+*/
+/*@null@*/ static funit_inst** vcd_inst_stack = NULL;
+
+/*!
+ Allocated size of the vcd_inst_stack array.
+*/
+static int vcd_inst_stack_size = 0;
+
+/*!
+ Number of leading levels of curr_inst_scope whose instance is stored in the vcd_inst_stack array.
+*/
+static int vcd_inst_resolved = 0;
+
 /*!
  Pointer to head of list of module names that need to be parsed yet.  These names
  are added in the db_add_instance function and removed in the db_end_module function.
@@ -295,6 +320,22 @@ void db_close() { PROFILE(DB_CLOSE);
   /* Deallocate the exclusion identifier container, if it exists */
   free_safe( exclusion_id, db_get_exclusion_id_size() );
 
+#ifndef RUNLIB
+  /* Deallocate the dumpfile scope index, if it was built */
+  db_vcd_scope_index_dealloc();
+
+#ifndef VPI_ONLY
+  /* Deallocate the exclusion ID index, if it was built */
+  exclude_index_dealloc();
+
+  /* Deallocate the cached combinational logic code and underline memory */
+  combination_dealloc_caches();
+#endif /* VPI_ONLY */
+
+  /* Deallocate the code generator memory */
+  codegen_dealloc();
+#endif /* RUNLIB */
+
   /* Finally, deallocate the database list */
   free_safe( db_list, (sizeof( db ) * db_size) );
   db_list = NULL;
@@ -355,13 +396,48 @@ void db_write(
 
     Try {
 
+      /*
+       Design fingerprint of the written structure.  Each structural line written to the CDD file (instances, functional
+       units, expressions, signals, statements, FSMs and race condition blocks) folds its structure into it as it is
+       written, so the fingerprint describes exactly what is in the file.
+      */
+      uint64 fingerprint = HASH64_INIT;
+
       /* Reset expression IDs */
       curr_expr_id = 1;
 
       /* Iterate through instance tree */
       assert( db_list[curr_db]->inst_head != NULL );
+
       info_db_write( db_handle );
 
+#ifndef RUNLIB
+#ifndef VPI_ONLY
+      /*
+       Output the summary statistics of each scored instance ahead of the instance trees (writing the FSMs
+       deallocates their tables, so the statistics must be calculated first).
+      */
+      if( !parse_mode && (info_suppl.part.scored == 1) ) {
+        instl = db_list[curr_db]->inst_head;
+        while( instl != NULL ) {
+          if( !instl->ignore ) {
+            instance_db_write_stats( instl->inst, db_handle, instl->inst->name );
+          }
+          instl = instl->next;
+        }
+      }
+#endif /* VPI_ONLY */
+#endif /* RUNLIB */
+
+      /* No functional unit is sized for any instance yet, so the first written instance of each must size it */
+      if( parse_mode ) {
+        funit_link* funitl = db_list[curr_db]->funit_head;
+        while( funitl != NULL ) {
+          funitl->funit->sized_inst = NULL;
+          funitl = funitl->next;
+        }
+      }
+
       instl = db_list[curr_db]->inst_head;
       while( instl != NULL ) {
 
@@ -381,7 +457,7 @@ void db_write(
           }
 
           /* Now write the instance */
-          instance_db_write( instl->inst, db_handle, instl->inst->name, parse_mode, issue_ids );
+          instance_db_write( instl->inst, db_handle, instl->inst->name, parse_mode, issue_ids, &fingerprint );
 
         }
 
@@ -389,6 +465,9 @@ void db_write(
 
       }
 
+      /* Now that the whole design has been written, store its fingerprint in the information line */
+      info_db_write_fingerprint( db_handle, fingerprint );
+
     } Catch_anonymous {
       rv = fclose( db_handle );
       assert( rv == 0 );
@@ -446,7 +525,11 @@ bool db_read(
   bool         inst_name_diff;         /* Specifies the read value of the name diff for the current instance */
   bool         stop_reading  = FALSE;
   bool         one_line_read = FALSE;
+  bool         header_done   = FALSE;
   unsigned int inst_index    = 0;
+  str_link*    stat_head     = NULL;   /* Pointer to head of list of instance statistic lines to apply after reading */
+  str_link*    stat_tail     = NULL;   /* Pointer to tail of list of instance statistic lines to apply after reading */
+  funit_link*  stream_funitl = NULL;   /* Pointer to functional unit link that was last streamed into */
 
 #ifdef DEBUG_MODE
   if( debug_mode ) {
@@ -469,7 +552,7 @@ bool db_read(
 
     Try {
 
-      while( !stop_reading && util_readline( db_handle, &curr_line, &curr_line_size ) ) {
+      while( !stop_reading && !header_done && util_readline( db_handle, &curr_line, &curr_line_size ) ) {
 
         one_line_read = TRUE;
 
@@ -479,7 +562,13 @@ bool db_read(
 
             rest_line = curr_line + chars_read;
 
-            if( type == DB_TYPE_INFO ) {
+            if( (read_mode == READ_MODE_MERGE_HEADER) &&
+                (type != DB_TYPE_INFO) && (type != DB_TYPE_SCORE_ARGS) && (type != DB_TYPE_MESSAGE) && (type != DB_TYPE_MERGED_CDD) ) {
+
+              /* We have read all of the header information, stop reading the file */
+              header_done = TRUE;
+
+            } else if( type == DB_TYPE_INFO ) {
           
               /* Parse rest of line for general info */
               stop_reading = !info_db_read( &rest_line, read_mode );
@@ -510,7 +599,8 @@ bool db_read(
               assert( !merge_mode );
  
               /* Parse rest of line for user-supplied message */
-              if( (read_mode != READ_MODE_MERGE_NO_MERGE) && (read_mode != READ_MODE_MERGE_INST_MERGE) ) {
+              if( (read_mode != READ_MODE_MERGE_NO_MERGE) && (read_mode != READ_MODE_MERGE_INST_MERGE) &&
+                  (read_mode != READ_MODE_MERGE_HEADER) && (read_mode != READ_MODE_MERGE_STREAM) ) {
                 message_db_read( &rest_line );
               }
 
@@ -576,12 +666,24 @@ bool db_read(
               /* Parse rest of line for functional unit version information */
               funit_version_db_read( curr_funit, &rest_line );
 
+            } else if( type == DB_TYPE_INST_STATS ) {
+
+              assert( !merge_mode );
+
+              /*
+               Instance statistics are only trusted by a report that reads a single CDD file.  The instances
+               do not exist yet so the line is applied after the rest of the file has been read.
+              */
+              if( read_mode == READ_MODE_REPORT_NO_MERGE ) {
+                (void)str_link_add( strdup_safe( rest_line ), &stat_head, &stat_tail );
+              }
+
             } else if( (type == DB_TYPE_FUNIT ) || (type == DB_TYPE_INST_ONLY) ) {
 
               /* Finish handling last functional unit read from CDD file */
               if( curr_funit != NULL ) {
               
-                if( (read_mode != READ_MODE_MERGE_INST_MERGE) || !merge_mode ) {
+                if( ((read_mode != READ_MODE_MERGE_INST_MERGE) && (read_mode != READ_MODE_MERGE_STREAM)) || !merge_mode ) {
 
                   funit_inst* inst;
 
@@ -612,14 +714,14 @@ bool db_read(
 
               if( type == DB_TYPE_INST_ONLY ) {
 
-                /* Parse rest of the line for an instance-only structure */
-                if( !merge_mode ) {
+                /* Parse rest of the line for an instance-only structure (it carries no coverage information to stream) */
+                if( (read_mode != READ_MODE_MERGE_STREAM) && !merge_mode ) {
                   funit_inst* inst = instance_only_db_read( &rest_line );
                   if( (info_suppl.part.scored == 0) && (info_suppl.part.inlined == 1) ) {
                     db_list[curr_db]->insts[inst_index++] = inst;
                   }
 #ifndef RUNLIB
-                } else {
+                } else if( read_mode != READ_MODE_MERGE_STREAM ) {
                   instance_only_db_merge( &rest_line );
 #endif /* RUNLIB */
                 }
@@ -632,14 +734,31 @@ bool db_read(
                 /* Reset merge mode */
                 merge_mode = FALSE;
 
-                /* Now finish reading functional unit line */
-                funit_db_read( &tmpfunit, funit_scope, &inst_name_diff, &rest_line );
+                /* Now finish reading functional unit line (the structure of a streamed functional unit is not needed) */
+                if( read_mode != READ_MODE_MERGE_STREAM ) {
+                  funit_db_read( &tmpfunit, funit_scope, &inst_name_diff, &rest_line );
+                }
 #ifndef RUNLIB
-                if( (read_mode == READ_MODE_MERGE_INST_MERGE) &&
+                if( read_mode == READ_MODE_MERGE_STREAM ) {
+                  /*
+                   The design fingerprints match, so the functional units of this file were written in the same order as
+                   those of the current database were read.  Fold the coverage information of this functional unit into
+                   the functional unit at the same position without parsing or looking up any of its structure.
+                  */
+                  stream_funitl = (stream_funitl == NULL) ? db_list[curr_db]->funit_head : stream_funitl->next;
+                  if( stream_funitl == NULL ) {
+                    print_output( "Databases being merged are incompatible.", FATAL, __FILE__, __LINE__ );
+                    Throw 0;
+                  }
+                  merge_mode = TRUE;
+                  curr_funit = stream_funitl->funit;
+                  funit_db_merge_coverage( curr_funit, db_handle );
+                } else if( (read_mode == READ_MODE_MERGE_INST_MERGE) &&
                     ((foundinst = inst_link_find_by_scope( funit_scope, db_list[curr_db]->inst_head, FALSE )) != NULL) ) {
                   merge_mode = TRUE;
                   curr_funit = foundinst->funit;
                   funit_db_merge( foundinst->funit, db_handle, TRUE );
+                  funit_get_curr_module( curr_funit )->stat_stale = TRUE;
                 } else if( (read_mode == READ_MODE_REPORT_MOD_MERGE) &&
                            ((foundfunit = funit_link_find( tmpfunit.name, tmpfunit.suppl.part.type, db_list[curr_db]->funit_head )) != NULL) ) {
                   merge_mode = TRUE;
@@ -692,17 +811,18 @@ bool db_read(
         } Catch_anonymous {
 
           free_safe( curr_line, curr_line_size );
-          if( (read_mode != READ_MODE_MERGE_INST_MERGE) && (read_mode != READ_MODE_REPORT_MOD_MERGE) ) {
+          if( (read_mode != READ_MODE_MERGE_INST_MERGE) && (read_mode != READ_MODE_REPORT_MOD_MERGE) && (read_mode != READ_MODE_MERGE_STREAM) ) {
             funit_dealloc( curr_funit );
           }
+          str_link_delete_list( stat_head );
           Throw 0;
 
         }
 
       }
 
-      /* If we ran into an issue with reading the CDD file, we will need to deallocate the line string */
-      if( stop_reading ) {
+      /* If we ran into an issue with reading the CDD file or stopped after its header, we will need to deallocate the line string */
+      if( stop_reading || header_done ) {
         free_safe( curr_line, curr_line_size );
       }
 
@@ -729,7 +849,7 @@ bool db_read(
   /* If the last functional unit was being read, add it now */
   if( curr_funit != NULL ) {
 
-    if( (read_mode != READ_MODE_MERGE_INST_MERGE) || !merge_mode ) {
+    if( ((read_mode != READ_MODE_MERGE_INST_MERGE) && (read_mode != READ_MODE_MERGE_STREAM)) || !merge_mode ) {
 
       funit_inst* inst;
 
@@ -760,6 +880,24 @@ bool db_read(
 
   }
 
+#ifndef RUNLIB
+  /* Now that the instance trees are complete, store the instance statistics that were read */
+  if( stat_head != NULL ) {
+    str_link* strl = stat_head;
+    Try {
+      while( strl != NULL ) {
+        char* line = strl->str;
+        instance_db_read_stats( &line );
+        strl = strl->next;
+      }
+    } Catch_anonymous {
+      str_link_delete_list( stat_head );
+      Throw 0;
+    }
+    str_link_delete_list( stat_head );
+  }
+#endif /* RUNLIB */
+
 #ifdef DEBUG_MODE
   /* Display the instance trees, if we are debugging */
   if( debug_mode && (db_list != NULL) ) {
@@ -820,7 +958,7 @@ void db_assign_ids() { PROFILE(DB_ASSIGN_IDS);
 void db_merge_instance_trees() { PROFILE(DB_MERGE_INSTANCE_TREES);
 
   funit_inst* base  = NULL;
-  inst_link*  instl = db_list[curr_db]->inst_head;
+  inst_link*  instl;
   bool        done  = FALSE;
 
   if( db_list != NULL ) {
@@ -1667,7 +1805,7 @@ void db_add_signal(
 #endif
 
   /* Add signal to current module's signal list if it does not already exist */
-  if( (sig = sig_link_find( name, curr_funit->sigs, curr_funit->sig_size )) == NULL ) {
+  if( (sig = funit_find_local_signal( name, curr_funit )) == NULL ) {
 
     /* Create the signal */
     if( (type == SSUPPL_TYPE_GENVAR) || (type == SSUPPL_TYPE_DECL_SREAL) ) {
@@ -3072,6 +3210,24 @@ void db_sync_curr_instance() { PROFILE(DB_SYNC_CURR_INSTANCE);
 
 } 
 
+/*!
+ Deallocates the dumpfile scope index and instance stack used to resolve dumpfile scopes.  This must be called
+ when the instance tree is changed or deallocated after dumpfile scopes have been set.
+*/
+void db_vcd_scope_index_dealloc() { PROFILE(DB_VCD_SCOPE_INDEX_DEALLOC);
+
+  instance_index_dealloc( vcd_inst_index );
+  vcd_inst_index = NULL;
+
+  free_safe( vcd_inst_stack, (sizeof( funit_inst* ) * vcd_inst_stack_size) );
+  vcd_inst_stack      = NULL;
+  vcd_inst_stack_size = 0;
+  vcd_inst_resolved   = 0;
+
+  PROFILE_END;
+
+}
+
 /*!
  Sets the curr_inst_scope global variable to the specified scope.
 */
@@ -3110,8 +3266,44 @@ void db_set_vcd_scope(
   }
   curr_inst_scope_size++;
 
-  /* Synchronize the current instance to the value of curr_inst_scope */
-  db_sync_curr_instance();
+  /* Someone else may have changed curr_inst_scope since the last scope was resolved */
+  if( vcd_inst_resolved >= curr_inst_scope_size ) {
+    vcd_inst_resolved = curr_inst_scope_size - 1;
+  }
+
+  if( vcd_inst_stack_size < curr_inst_scope_size ) {
+    vcd_inst_stack      = (funit_inst**)realloc_safe( vcd_inst_stack, (sizeof( funit_inst* ) * vcd_inst_stack_size), (sizeof( funit_inst* ) * curr_inst_scope_size) );
+    vcd_inst_stack_size = curr_inst_scope_size;
+  }
+
+  /*
+   If the parent scope was resolved, resolve the new scope from its instance; otherwise, synchronize the
+   current instance to the full value of curr_inst_scope.
+  */
+  if( vcd_inst_resolved == (curr_inst_scope_size - 1) ) {
+
+    funit_inst* parent = (curr_inst_scope_size > 1) ? vcd_inst_stack[curr_inst_scope_size - 2] : NULL;
+    funit_inst* inst   = NULL;
+
+    if( vcd_inst_index == NULL ) {
+      vcd_inst_index = instance_index_create( db_list[curr_db]->inst_head );
+    }
+
+    /* If the parent scope is not in the design, none of its child scopes are either */
+    if( ((curr_inst_scope_size > 1) && (parent == NULL)) ||
+        instance_index_find( vcd_inst_index, parent, curr_inst_scope[curr_inst_scope_size - 1], &inst ) ) {
+      vcd_inst_stack[curr_inst_scope_size - 1] = inst;
+      vcd_inst_resolved = curr_inst_scope_size;
+      curr_instance     = inst;
+    } else {
+      db_sync_curr_instance();
+    }
+
+  } else {
+
+    db_sync_curr_instance();
+
+  }
 
   PROFILE_END;
 
@@ -3140,7 +3332,16 @@ void db_vcd_upscope() { PROFILE(DB_VCD_UPSCOPE);
     free_safe( curr_inst_scope[curr_inst_scope_size], (strlen( curr_inst_scope[curr_inst_scope_size] ) + 1) );
     curr_inst_scope = (char**)realloc_safe( curr_inst_scope, (sizeof( char* ) * (curr_inst_scope_size + 1)), (sizeof( char* ) * curr_inst_scope_size) );
 
-    db_sync_curr_instance();
+    if( vcd_inst_resolved > curr_inst_scope_size ) {
+      vcd_inst_resolved = curr_inst_scope_size;
+    }
+
+    /* If the parent scope was resolved from the index, return to its instance */
+    if( (curr_inst_scope_size > 0) && (vcd_inst_resolved == curr_inst_scope_size) ) {
+      curr_instance = vcd_inst_stack[curr_inst_scope_size - 1];
+    } else {
+      db_sync_curr_instance();
+    }
 
   }
 
@@ -3398,7 +3599,7 @@ void db_assign_symbol(
       }
 
       /* Find the signal that matches the specified signal name */
-      if( ((sig = sig_link_find( name, curr_instance->funit->sigs, curr_instance->funit->sig_size )) != NULL) ||
+      if( ((sig = funit_find_local_signal( name, curr_instance->funit )) != NULL) ||
           scope_find_signal( name, curr_instance->funit, &sig, &found_funit, 0 ) ) {
 
         /* Only add the symbol if we are not going to generate this value ourselves */
@@ -3570,6 +3771,9 @@ bool db_do_timestep(
 */
 void db_check_dumpfile_scopes() { PROFILE(DB_CHECK_DUMPFILE_SCOPES);
 
+  /* All dumpfile scopes have been resolved so the scope index is no longer needed */
+  db_vcd_scope_index_dealloc();
+
   /* If no signals were used from the VCD dumpfile, check to see if any signals were needed */
   if( vcd_symtab_size == 0 ) {
 
@@ -364,6 +364,9 @@ void db_remove_stmt_blks_calling_statement(
 /*! \brief Synchronizes the curr_instance pointer to match the curr_inst_scope hierarchy */
 void db_sync_curr_instance();
 
+/*! \brief Deallocates the index used to resolve dumpfile scopes. */
+void db_vcd_scope_index_dealloc();
+
 /*! \brief Sets current VCD scope to specified scope. */
 void db_set_vcd_scope(
   const char* scope
@@ -52,7 +52,25 @@
  Contains the CDD version number of all CDD files that this version of Covered can write
  and read.
 */
-#define CDD_VERSION        24
+#define CDD_VERSION        26
+
+/*!
+ Contains the version number of the rank cache file format that this version of Covered can write
+ and read.
+*/
+#define RANK_CACHE_VERSION 2
+
+/*!
+ Contains the version number of the preprocessor cache entry format that this version of Covered can write
+ and read.
+*/
+#define PPCACHE_VERSION    3
+
+/*!
+ Contains the version number of the library directory index file format that this version of Covered can
+ write and read.
+*/
+#define DIR_INDEX_VERSION  1
 
 /*!
  This contains the header information specified when executing this tool.
@@ -69,6 +87,16 @@
 */
 #define PROFILING_OUTPUT_NAME "covered.prof"
 
+/*!
+ Starting value of a hash calculated with the util_hash and util_hash_string functions.
+*/
+#define HASH_INIT          0x811c9dc5
+
+/*!
+ Starting value of a hash calculated with the util_hash64 and util_hash64_string functions.
+*/
+#define HASH64_INIT        UINT64(0xcbf29ce484222325)
+
 /*!
  Default filename that will contain the code necessary to attach Covered as a VPI to the Verilog
  simulator.
@@ -96,6 +124,37 @@
 */
 #define MAX_MALLOC_SIZE    (MAX_BIT_WIDTH * 2)
 
+/*!
+ Specifies the default number of bytes allocated for each block of a string arena.
+*/
+#define STR_ARENA_BLK_SIZE 16384
+
+/*!
+ Specifies the minimum number of signals a functional unit must contain before its signal array is searched
+ through a hashed name index rather than by a linear scan.
+*/
+#define SIG_INDEX_MIN_SIZE 16
+
+/*!
+ \addtogroup inst_index_kinds Instance index entry kinds
+
+ The following defines specify how a child instance was reached from the parent instance it is indexed under
+ in an instance scope index.
+
+ @{
+*/
+
+/*! Child instance that is not an unnamed scope */
+#define INST_INDEX_NAMED        0
+
+/*! Child instance that is an unnamed scope (only matched by unnamed scope names) */
+#define INST_INDEX_UNNAMED      1
+
+/*! Named instance that is reached from the parent by passing through one or more unnamed scopes */
+#define INST_INDEX_THRU_UNNAMED 2
+
+/*! @} */
+
 /*!
  Length of user_msg global string (used for inputs to snprintf calls).
 */
@@ -291,6 +350,11 @@
 */
 #define DB_TYPE_INST_ONLY     15
 
+/*!
+ Specifies the summary coverage statistics of an instance that were calculated when the CDD was written.
+*/
+#define DB_TYPE_INST_STATS    16
+
 /*! @} */
 
 /*!
@@ -660,6 +724,20 @@
 */
 #define READ_MODE_REPORT_MOD_MERGE        4
 
+/*!
+ Only the header lines of the database file (information, score arguments, message and merged CDD
+ lines) are read; reading stops at the first functional unit.  Used by a parallel MERGE command to
+ rebuild the merged CDD and leading hierarchy information of the original inputs in command-line order.
+*/
+#define READ_MODE_MERGE_HEADER            5
+
+/*!
+ When functional unit is read in, its coverage information is merged into the functional unit at the same position
+ in the current database as it is read, without parsing its structure or building a new functional unit.  Used when
+ performing a MERGE command on CDD files that were all created from the same design (their design fingerprints match).
+*/
+#define READ_MODE_MERGE_STREAM            6
+
 /*! @} */
 
 /*!
@@ -1922,6 +2000,10 @@ struct gitem_pair_s;
 struct dim_and_nba_s;
 struct nonblock_assign_s;
 struct str_cov_s;
+struct str_arena_blk_s;
+struct str_arena_s;
+struct name_index_s;
+struct inst_index_s;
 
 /*------------------------------------------------------------------------------*/
 /*  STRUCTURE/UNION TYPEDEFS  */
@@ -2268,6 +2350,26 @@ typedef struct nonblock_assign_s nonblock_assign;
 */
 typedef struct str_cov_s str_cov;
 
+/*!
+ Renaming str_arena_blk_s structure for convenience.
+*/
+typedef struct str_arena_blk_s str_arena_blk;
+
+/*!
+ Renaming str_arena_s structure for convenience.
+*/
+typedef struct str_arena_s str_arena;
+
+/*!
+ Renaming name_index_s structure for convenience.
+*/
+typedef struct name_index_s name_index;
+
+/*!
+ Renaming inst_index_s structure for convenience.
+*/
+typedef struct inst_index_s inst_index;
+
 /*------------------------------------------------------------------------------*/
 /*  STRUCTURE/UNION DEFINITIONS  */
 
@@ -2667,6 +2769,7 @@ struct func_unit_s {
   vsignal**       sigs;              /*!< Array of signal pointers that belong to this functional unit */
   unsigned int    sig_size;          /*!< Number of elements in the sigs array */
   unsigned int    sig_no_rm_index;   /*!< Index in sigs array that begins the list of signals that should not be deallocated */
+  name_index*     sig_index;         /*!< Hash index of the sigs array by signal name (NULL if not built yet) */
   expression**    exps;              /*!< Array of expression pointers that belong to this functional unit */
   unsigned int    exp_size;          /*!< Number of elements in the exps array */
   statement*      first_stmt;        /*!< Pointer to first head statement in this functional unit (for tasks/functions only) */
@@ -2691,6 +2794,8 @@ struct func_unit_s {
   struct_union*   su_tail;           /*!< Tail pointer to list of struct/unions for this functional unit */
   exclude_reason* er_head;           /*!< Head pointer to list of exclusion reason structures for this functional unit */
   exclude_reason* er_tail;           /*!< Tail pointer to list of exclusion reason structures for this functional unit */
+  funit_inst*     sized_inst;        /*!< Instance that this functional unit was last sized for when written (score -share-insts option only) */
+  bool            stat_stale;        /*!< Set to TRUE if the coverage or exclusions of this module changed after its instance statistics were stored */
   union {
     thread*   thr;                   /*!< Pointer to a single thread that this statement is associated with */
     thr_list* tlist;                 /*!< Pointer to a list of threads that this statement is currently associated with */
@@ -2781,6 +2886,8 @@ struct exp_bind_s {
   expression*      fsm;              /*!< FSM expression to create value for when this expression is bound */
   func_unit*       funit;            /*!< Pointer to functional unit containing expression */
   bool             staticf;          /*!< Set to TRUE if the functional unit being bound to is a result of a static function */
+  unsigned int     sig_depth;        /*!< Number of parent functional units above funit that contain the signal recorded in the CDD file */
+  int              sig_index;        /*!< Index of the recorded signal in the signal array of its functional unit (-1 if not known) */
   exp_bind*        next;             /*!< Pointer to next binding in list */
 };
 
@@ -2827,9 +2934,14 @@ struct funit_inst_s {
                                           as a placeholder in the instance tree for functional unit that will be generated
                                           at a later time). */
     uint8 gend_scope: 1;             /*!< Set to 1 if this instance is a generated scope */
+    uint8 stat_stored: 1;            /*!< Set to 1 if the stored_stat field contains the statistics that were stored in the
+                                          CDD file for this instance */
+    uint8 stat_gathered: 1;          /*!< Set to 1 if the stat field contains statistics that were calculated by a report job
+                                          and have not been gathered yet */
   } suppl;                           /*!< Supplemental field for the instance */
   func_unit*    funit;               /*!< Pointer to functional unit this instance represents */
   statistic*    stat;                /*!< Pointer to statistic holder */
+  statistic*    stored_stat;         /*!< Pointer to statistics read from the CDD file (only valid if suppl.stat_stored is set) */
   vector_width* range;               /*!< Used to create an array of instances */
   inst_parm*    param_head;          /*!< Head pointer to list of parameter overrides in this functional unit if it is a module */
   inst_parm*    param_tail;          /*!< Tail pointer to list of parameter overrides in this functional unit if it is a module */
@@ -2843,7 +2955,7 @@ struct funit_inst_s {
 
 /*!
  Node for a tree that carries two strings:  a key and a value.  The tree is a binary
- tree that is sorted by key.
+ tree that is sorted by key and kept height-balanced (AVL) as nodes are added and removed.
 */
 struct tnode_s {
   char*  name;                       /*!< Key value for tree node */
@@ -2851,6 +2963,7 @@ struct tnode_s {
   tnode* left;                       /*!< Pointer to left child node */
   tnode* right;                      /*!< Pointer to right child node */
   tnode* up;                         /*!< Pointer to parent node */
+  int    height;                     /*!< Height of the subtree rooted at this node (a leaf has a height of 1) */
 };
 
 #ifdef HAVE_SYS_TIME_H
@@ -3213,6 +3326,52 @@ struct str_cov_s {
   char*           str;                  /*!< Code string */
 };
 
+/*!
+ Single block of memory owned by a string arena.
+*/
+struct str_arena_blk_s {
+  char*           mem;                  /*!< Pointer to the memory of this block */
+  unsigned int    size;                 /*!< Number of bytes allocated for mem */
+  unsigned int    used;                 /*!< Number of bytes of mem that have been handed out */
+  str_arena_blk*  next;                 /*!< Pointer to next block in the arena */
+};
+
+/*!
+ Arena used for building many short-lived strings (such as the intermediate strings of the report text
+ builders).  Memory is handed out from large blocks and is only released in bulk when the arena is reset
+ or deallocated, avoiding a heap allocation and deallocation for every string.
+*/
+struct str_arena_s {
+  str_arena_blk*  head;                 /*!< Pointer to head of block list */
+  str_arena_blk*  curr;                 /*!< Pointer to block that is currently being allocated from */
+};
+
+/*!
+ Open-addressed hash table that maps the printable form of a signal/instance name to the index of the
+ element with that name in an external array.  Used to avoid linear name searches of large arrays.
+*/
+struct name_index_s {
+  char**          names;                /*!< Printable name stored in each slot (NULL if the slot is empty) */
+  uint32*         hashes;               /*!< Hash value of the name stored in each slot */
+  unsigned int*   elems;                /*!< Array index of the element stored in each slot */
+  unsigned int    size;                 /*!< Number of slots in the table (always a power of two) */
+  unsigned int    num;                  /*!< Number of elements stored in the table */
+};
+
+/*!
+ Open-addressed hash table that maps a parent instance and the printable name of one of its child instances
+ to that child instance.  Used to resolve dumpfile scopes one hierarchy level at a time.
+*/
+struct inst_index_s {
+  funit_inst**    parents;              /*!< Parent instance of each slot (NULL for top-level instances) */
+  funit_inst**    insts;                /*!< Child instance stored in each slot (NULL if the slot is empty) */
+  char**          names;                /*!< Printable name of the child instance stored in each slot */
+  uint32*         hashes;               /*!< Hash value of the parent/name pair stored in each slot */
+  uint8*          kinds;                /*!< Specifies how the child is reached from its parent (see \ref inst_index_kinds) */
+  unsigned int    size;                 /*!< Number of slots in the table (always a power of two) */
+  unsigned int    num;                  /*!< Number of elements stored in the table */
+};
+
 /*!
  This will define the exception type that gets thrown (Covered does not care about this value)
 */
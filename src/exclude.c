@@ -72,6 +72,50 @@ static bool exclude_prompt_for_msgs = FALSE;
 */
 static bool exclude_print = FALSE;
 
+/*!
+ Entry of the exclusion ID index, associating an exclusion ID with the signal, expression or FSM table that has it.
+*/
+typedef struct excl_entry_s excl_entry;
+struct excl_entry_s {
+  void*      obj;    /*!< Pointer to the signal, expression or FSM table that has the exclusion ID */
+  func_unit* funit;  /*!< Pointer to the functional unit containing the object */
+};
+
+/*!
+ Database that the exclusion ID index was built for (NULL if the index has not been built).
+*/
+static db* excl_index_db = NULL;
+
+/*!
+ Array of signals indexed by exclusion ID (used for toggle and memory exclusion IDs).
+*/
+static excl_entry* excl_sig_index = NULL;
+
+/*!
+ Number of elements in the excl_sig_index array.
+*/
+static unsigned int excl_sig_index_size = 0;
+
+/*!
+ Array of expressions indexed by exclusion ID (used for line, combinational logic and assertion exclusion IDs).
+*/
+static excl_entry* excl_exp_index = NULL;
+
+/*!
+ Number of elements in the excl_exp_index array.
+*/
+static unsigned int excl_exp_index_size = 0;
+
+/*!
+ Array of FSM tables indexed by the exclusion IDs of their state transitions.
+*/
+static excl_entry* excl_arc_index = NULL;
+
+/*!
+ Number of elements in the excl_arc_index array.
+*/
+static unsigned int excl_arc_index_size = 0;
+
 
 static char* exclude_get_message( const char* eid );
 
@@ -175,6 +219,21 @@ static void exclude_expr_assign_and_recalc(
 
 }
 
+/*!
+ Marks the statistics stored for each instance of the module containing the given functional unit as stale.  The
+ exclusion of a coverage point within the functional unit was changed, so the statistics stored in the CDD file no
+ longer match it.
+*/
+static void exclude_clear_stored_stats(
+  func_unit* funit  /*!< Pointer to functional unit whose exclusions were changed */
+) { PROFILE(EXCLUDE_CLEAR_STORED_STATS);
+
+  funit_get_curr_module( funit )->stat_stale = TRUE;
+
+  PROFILE_END;
+
+}
+
 /*!
  Sets the specified signal's exclude bit to the given value and recalculates all
  affected coverage information for this instance.
@@ -388,6 +447,7 @@ void exclude_set_line_exclude(
     if( stmt != NULL ) {
 
       exclude_expr_assign_and_recalc( stmt->exp, funit, (value == 1), TRUE, rpt_comb, rpt_event, stat );
+      exclude_clear_stored_stats( funit );
 
       /* Handle the exclusion reason */
       if( value == 1 ) {
@@ -455,6 +515,7 @@ void exclude_set_toggle_exclude(
 
     /* Exclude/include the signal and recalculate the summary information */
     exclude_sig_assign_and_recalc( sig, (value == 1), stat );
+    exclude_clear_stored_stats( funit );
 
     /* Handle the exclusion reason */
     if( value == 1 ) {
@@ -531,6 +592,7 @@ void exclude_set_comb_exclude(
 
       /* Exclude/include the expression and recalculate the summary information */
       exclude_expr_assign_and_recalc( subexp, funit, (value == 1), FALSE, rpt_comb, rpt_event, stat );
+      exclude_clear_stored_stats( funit );
 
       /* Handle the exclusion reason */
       if( value == 1 ) {
@@ -624,6 +686,7 @@ void exclude_set_fsm_exclude(
 
       /* Handle the exclusion and recalculate the summary values */
       exclude_arc_assign_and_recalc( funit->fsms[i]->table, found_index, (value == 1), stat );
+      exclude_clear_stored_stats( funit );
  
       /* Handle the exclusion reason */
       if( value == 1 ) {
@@ -731,6 +794,7 @@ void exclude_set_assert_exclude(
 
       /* Exclude/include the assertion and recalculate the summary information */
       exclude_expr_assign_and_recalc( stmt->exp, curr_child->funit, (value == 1), FALSE, rpt_comb, rpt_event, stat );
+      exclude_clear_stored_stats( curr_child->funit );
 
       /* Handle the exclusion reason */
       if( value == 1 ) {
@@ -760,7 +824,7 @@ void exclude_set_assert_exclude(
 static void exclude_usage() {
 
   printf( "\n" );
-  printf( "Usage:  covered exclude (-h | ([<options>] <exclusion_ids>+ <database_file>)\n" );
+  printf( "Usage:  covered exclude (-h | ([<options>] <exclusion_ids>* <database_file>)\n" );
   printf( "\n" );
   printf( "   -h                           Displays this help information.\n" );
   printf( "\n" );
@@ -771,12 +835,103 @@ static void exclude_usage() {
   printf( "                                  is being excluded.  If a coverage point is being included for\n" );
   printf( "                                  coverage (i.e., it was previously excluded from coverage), no\n" );
   printf( "                                  message prompt will be specified.\n" );
+  printf( "      -b <filename>             Name of exclusion batch file containing exclusion IDs to exclude.  Each line\n" );
+  printf( "                                  of the file contains an exclusion ID optionally followed by the reason\n" );
+  printf( "                                  for its exclusion.  Blank lines and lines starting with '#' are ignored.\n" );
+  printf( "                                  Coverage points that are already excluded are left unchanged.\n" );
   printf( "      -p                        Outputs the status of the exclusion ID and an exclusion message\n" );
   printf( "                                  if one exists.  No excluding will occur if this option is set.\n" );
   printf( "\n" );
 
 }
 
+/*!
+ \throws anonymous Throw
+
+ Reads the given exclusion batch file, adding each exclusion ID in it to the list of exclusion IDs to apply along
+ with the exclusion reason that follows it on the same line (if one is specified).  Blank lines and lines starting
+ with a '#' character are ignored.
+*/
+static void exclude_read_batch_file(
+  const char* fname  /*!< Name of exclusion batch file to read */
+) { PROFILE(EXCLUDE_READ_BATCH_FILE);
+
+  FILE* bfile;
+
+  if( (bfile = fopen( fname, "r" )) != NULL ) {
+
+    char         buf[4096];
+    char*        line      = NULL;
+    unsigned int line_size = 0;
+    unsigned int rv;
+
+    while( fgets( buf, 4096, bfile ) != NULL ) {
+
+      /* Add the read characters to the current line */
+      line = (char*)realloc_safe( line, line_size, (line_size + strlen( buf ) + ((line_size == 0) ? 1 : 0)) );
+      if( line_size == 0 ) {
+        line[0]   = '\0';
+        line_size = 1;
+      }
+      strcat( line, buf );
+      line_size += strlen( buf );
+
+      /* If we have read the entire line, parse it */
+      if( (line[line_size - 2] == '\n') || feof( bfile ) ) {
+
+        char id[4096];
+        int  chars_read;
+
+        if( (sscanf( line, "%4095s%n", id, &chars_read ) == 1) && (id[0] != '#') ) {
+
+          str_link*    strl   = str_link_add( strdup_safe( id ), &excl_ids_head, &excl_ids_tail );
+          char*        reason = exclude_format_reason( line + chars_read );
+          unsigned int len    = strlen( reason );
+
+          /* Remove the trailing spaces that the formatting leaves in place of the line's newline */
+          if( (len > 0) && (reason[len - 1] == ' ') ) {
+            unsigned int size = len + 1;
+            while( (len > 0) && (reason[len - 1] == ' ') ) {
+              reason[--len] = '\0';
+            }
+            reason = (char*)realloc_safe( reason, size, (len + 1) );
+          }
+
+          strl->suppl = 1;
+          if( strlen( reason ) > 0 ) {
+            strl->str2 = reason;
+          } else {
+            free_safe( reason, (strlen( reason ) + 1) );
+          }
+
+        }
+
+        free_safe( line, line_size );
+        line      = NULL;
+        line_size = 0;
+
+      }
+
+    }
+
+    free_safe( line, line_size );
+
+    rv = fclose( bfile );
+    assert( rv == 0 );
+
+  } else {
+
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Unable to read exclusion batch file \"%s\"", fname );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, FATAL, __FILE__, __LINE__ );
+    Throw 0;
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  \return Returns TRUE if the help option was parsed.
 
@@ -838,6 +993,15 @@ static bool exclude_parse_args(
 
       exclude_print = TRUE;
 
+    } else if( strncmp( "-b", argv[i], 2 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        exclude_read_batch_file( argv[i] );
+      } else {
+        Throw 0;
+      }
+
     } else if( strncmp( "-", argv[i], 1 ) == 0 ) {
 
       unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Unknown exclude option (%s) specified.", argv[i] );
@@ -1191,6 +1355,133 @@ void exclude_merge(
 
 }
 
+/*!
+ Adds the given object to the specified exclusion ID index, growing the index as needed.  If an object has
+ already been indexed with the same exclusion ID, the index is left unchanged so that the first object found in
+ the instance trees is used (just as the instance tree searches do).
+*/
+static void exclude_index_add(
+  excl_entry**  index,  /*!< Pointer to exclusion ID index to add to */
+  unsigned int* size,   /*!< Pointer to number of elements in the index */
+  int           id,     /*!< Exclusion ID of the object */
+  void*         obj,    /*!< Pointer to object to add */
+  func_unit*    funit   /*!< Pointer to functional unit containing the object */
+) { PROFILE(EXCLUDE_INDEX_ADD);
+
+  if( id >= 0 ) {
+
+    if( (unsigned int)id >= *size ) {
+      unsigned int new_size = (*size == 0) ? 64 : *size;
+      unsigned int i;
+      while( (unsigned int)id >= new_size ) {
+        new_size *= 2;
+      }
+      *index = (excl_entry*)realloc_safe( *index, (sizeof( excl_entry ) * (*size)), (sizeof( excl_entry ) * new_size) );
+      for( i=*size; i<new_size; i++ ) {
+        (*index)[i].obj   = NULL;
+        (*index)[i].funit = NULL;
+      }
+      *size = new_size;
+    }
+
+    if( (*index)[id].obj == NULL ) {
+      (*index)[id].obj   = obj;
+      (*index)[id].funit = funit;
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Recursively adds the signals, expressions and FSM state transitions of the given instance tree to the exclusion
+ ID index.
+*/
+static void exclude_index_add_instance(
+  funit_inst* root  /*!< Pointer to root of instance tree to add */
+) { PROFILE(EXCLUDE_INDEX_ADD_INSTANCE);
+
+  funit_inst* child;
+
+  if( root->funit != NULL ) {
+
+    func_unit*   funit = root->funit;
+    unsigned int i, j;
+
+    for( i=0; i<funit->sig_size; i++ ) {
+      exclude_index_add( &excl_sig_index, &excl_sig_index_size, funit->sigs[i]->id, funit->sigs[i], funit );
+    }
+    for( i=0; i<funit->exp_size; i++ ) {
+      exclude_index_add( &excl_exp_index, &excl_exp_index_size, funit->exps[i]->id, funit->exps[i], funit );
+    }
+    for( i=0; i<funit->fsm_size; i++ ) {
+      fsm_table* table = funit->fsms[i]->table;
+      for( j=0; j<table->num_arcs; j++ ) {
+        exclude_index_add( &excl_arc_index, &excl_arc_index_size, (int)(table->id + j), table, funit );
+      }
+    }
+
+  }
+
+  child = root->child_head;
+  while( child != NULL ) {
+    exclude_index_add_instance( child );
+    child = child->next;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Deallocates the exclusion ID index.  This must be called whenever the database that it was built for is closed.
+*/
+void exclude_index_dealloc() { PROFILE(EXCLUDE_INDEX_DEALLOC);
+
+  free_safe( excl_sig_index, (sizeof( excl_entry ) * excl_sig_index_size) );
+  free_safe( excl_exp_index, (sizeof( excl_entry ) * excl_exp_index_size) );
+  free_safe( excl_arc_index, (sizeof( excl_entry ) * excl_arc_index_size) );
+
+  excl_sig_index      = NULL;
+  excl_sig_index_size = 0;
+  excl_exp_index      = NULL;
+  excl_exp_index_size = 0;
+  excl_arc_index      = NULL;
+  excl_arc_index_size = 0;
+  excl_index_db       = NULL;
+
+  PROFILE_END;
+
+}
+
+/*!
+ Builds the exclusion ID index for the current database if it has not been built yet.  Building the index walks
+ the instance trees once so that each exclusion ID can then be resolved without searching the design.
+*/
+static void exclude_index_build() { PROFILE(EXCLUDE_INDEX_BUILD);
+
+  if( excl_index_db != db_list[curr_db] ) {
+
+    inst_link* instl;
+
+    exclude_index_dealloc();
+
+    instl = db_list[curr_db]->inst_head;
+    while( instl != NULL ) {
+      exclude_index_add_instance( instl->inst );
+      instl = instl->next;
+    }
+
+    excl_index_db = db_list[curr_db];
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  \return Returns pointer to found signal if it was found; otherwise, returns NULL.
 */
@@ -1199,16 +1490,13 @@ vsignal* exclude_find_signal(
   /*@out@*/ func_unit** found_funit  /*!< Pointer to functional unit containing found signal */
 ) { PROFILE(EXCLUDE_FIND_SIGNAL);
 
-  inst_link* instl;       /* Pointer to current instance link */
-  vsignal*   sig = NULL;  /* Pointer to found signal */
+  vsignal* sig = NULL;  /* Pointer to found signal */
 
-  instl = db_list[curr_db]->inst_head;
-  while( (instl != NULL) && ((sig = instance_find_signal_by_exclusion_id( instl->inst, id, found_funit )) == NULL) ) {
-    instl = instl->next;
-  }
+  exclude_index_build();
 
-  if( sig != NULL ) {
-    *found_funit = funit_get_curr_module( *found_funit );
+  if( (id >= 0) && ((unsigned int)id < excl_sig_index_size) && (excl_sig_index[id].obj != NULL) ) {
+    sig          = (vsignal*)excl_sig_index[id].obj;
+    *found_funit = funit_get_curr_module( excl_sig_index[id].funit );
   }
 
   PROFILE_END;
@@ -1225,16 +1513,13 @@ expression* exclude_find_expression(
   /*@out@*/ func_unit** found_funit  /*!< Pointer to functional unit containing found expression */
 ) { PROFILE(EXCLUDE_FIND_EXPRESSION);
 
-  inst_link*  instl;       /* Pointer to current instance link */
   expression* exp = NULL;  /* Pointer to found expression */
 
-  instl = db_list[curr_db]->inst_head;
-  while( (instl != NULL) && ((exp = instance_find_expression_by_exclusion_id( instl->inst, id, found_funit )) == NULL) ) {
-    instl = instl->next;
-  }
+  exclude_index_build();
 
-  if( exp != NULL ) {
-    *found_funit = funit_get_curr_module( *found_funit );
+  if( (id >= 0) && ((unsigned int)id < excl_exp_index_size) && (excl_exp_index[id].obj != NULL) ) {
+    exp          = (expression*)excl_exp_index[id].obj;
+    *found_funit = funit_get_curr_module( excl_exp_index[id].funit );
   }
 
   PROFILE_END;
@@ -1252,16 +1537,14 @@ int exclude_find_fsm_arc(
   /*@out@*/ func_unit** found_funit  /*!< Pointer to found functional unit */
 ) { PROFILE(EXCLUDE_FIND_FSM_ARC);
 
-  inst_link* instl;  /* Pointer to current instance link */
-  int        arc_index = -1;
+  int arc_index = -1;
 
-  instl = db_list[curr_db]->inst_head;
-  while( (instl != NULL) && ((arc_index = instance_find_fsm_arc_index_by_exclusion_id( instl->inst, id, found_fsm, found_funit )) == -1) ) {
-    instl = instl->next;
-  }
+  exclude_index_build();
 
-  if( arc_index != -1 ) {
-    *found_funit = funit_get_curr_module( *found_funit );
+  if( (id >= 0) && ((unsigned int)id < excl_arc_index_size) && (excl_arc_index[id].obj != NULL) ) {
+    *found_fsm   = (fsm_table*)excl_arc_index[id].obj;
+    *found_funit = funit_get_curr_module( excl_arc_index[id].funit );
+    arc_index    = arc_find_arc_by_exclusion_id( *found_fsm, id );
   }
 
   PROFILE_END;
@@ -1400,18 +1683,20 @@ static char* exclude_get_message(
  Handle the creation/deallocation of the exclude reason structure.
 */
 static void exclude_handle_exclude_reason(
-  int         prev_excluded,  /*!< Specifies if the coverage point was previously excluded or not */
-  const char* id,             /*!< Exclusion ID */
-  func_unit*  funit           /*!< Functional unit containing sig */
+  int             prev_excluded,  /*!< Specifies if the coverage point was previously excluded or not */
+  const str_link* strl,           /*!< Exclusion ID and exclusion reason from an exclusion batch file (if specified) */
+  func_unit*      funit           /*!< Functional unit containing sig */
 ) { PROFILE(EXCLUDE_HANDLE_EXCLUDE_REASON);
 
+  const char* id = strl->str;  /* Exclusion ID */
+
   /*
-   If the coverage point was not previously excluded, allow the user to specify a reason and
-   store this information in the functional unit.
+   If the coverage point was not previously excluded, use the reason from the exclusion batch file or allow
+   the user to specify a reason and store this information in the functional unit.
   */
   if( prev_excluded == 0 ) { 
 
-    char* str = exclude_get_message( id );
+    char* str = (strl->str2 != NULL) ? strdup_safe( strl->str2 ) : exclude_get_message( id );
 
     if( (str != NULL) && (strlen( str ) > 0) ) {
       exclude_add_exclude_reason( id[0], atoi( id + 1 ), str, funit );
@@ -1468,9 +1753,10 @@ static void exclude_print_exclusion(
  for exclusion if it is excluding the coverage point and the -m option was specified on the command-line.
 */
 static bool exclude_line_from_id(
-  const char* id  /*!< String version of exclusion ID */
+  const str_link* strl  /*!< Pointer to exclusion ID and exclusion reason from an exclusion batch file (if specified) */
 ) { PROFILE(EXCLUDE_LINE_FROM_ID);
 
+  const char* id = strl->str;  /* String version of exclusion ID */
   expression* exp;          /* Pointer to found expression */
   func_unit*  found_funit;  /* Pointer to functional unit containing found expression */
 
@@ -1489,6 +1775,13 @@ static bool exclude_line_from_id(
 
       exclude_print_exclusion( id, prev_excluded, found_funit );
 
+    /* Coverage points listed in an exclusion batch file are only excluded, never included */
+    } else if( (strl->suppl == 1) && (prev_excluded == 1) ) {
+
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "  Skipping %s (already excluded)", id );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
     /* Otherwise, perform the exclusion */
     } else {
 
@@ -1504,10 +1797,11 @@ static bool exclude_line_from_id(
       /* Set the exclude bits in the expression supplemental field */
       exp->suppl.part.excluded               = (prev_excluded ^ 1);
       exp->parent->stmt->suppl.part.excluded = (prev_excluded ^ 1);
+      exclude_clear_stored_stats( found_funit );
 
       /* If we are excluding and the -m option was specified, get an exclusion reason from the user */
-      if( exclude_prompt_for_msgs || (prev_excluded == 1) ) {
-        exclude_handle_exclude_reason( prev_excluded, id, found_funit );
+      if( exclude_prompt_for_msgs || (prev_excluded == 1) || (strl->str2 != NULL) ) {
+        exclude_handle_exclude_reason( prev_excluded, strl, found_funit );
       }
 
     }
@@ -1533,9 +1827,10 @@ static bool exclude_line_from_id(
  for exclusion if it is excluding the coverage point and the -m option was specified on the command-line.
 */
 static bool exclude_toggle_from_id(
-  const char* id  /*!< String version of exclusion ID */
+  const str_link* strl  /*!< Pointer to exclusion ID and exclusion reason from an exclusion batch file (if specified) */
 ) { PROFILE(EXCLUDE_TOGGLE_FROM_ID);
 
+  const char* id = strl->str;  /* String version of exclusion ID */
   vsignal*   sig;          /* Pointer to found signal */
   func_unit* found_funit;  /* Pointer to functional unit containing sig */
   
@@ -1549,6 +1844,13 @@ static bool exclude_toggle_from_id(
 
       exclude_print_exclusion( id, prev_excluded, found_funit );
 
+    /* Coverage points listed in an exclusion batch file are only excluded, never included */
+    } else if( (strl->suppl == 1) && (prev_excluded == 1) ) {
+
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "  Skipping %s (already excluded)", id );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
     /* Otherwise, perform the exclusion */
     } else {
 
@@ -1563,10 +1865,11 @@ static bool exclude_toggle_from_id(
     
       /* Set the exclude bits in the expression supplemental field */
       sig->suppl.part.excluded = (prev_excluded ^ 1);
+      exclude_clear_stored_stats( found_funit );
     
       /* If we are excluding and the -m option was specified, get an exclusion reason from the user */
-      if( exclude_prompt_for_msgs || (prev_excluded == 1) ) { 
-        exclude_handle_exclude_reason( prev_excluded, id, found_funit );
+      if( exclude_prompt_for_msgs || (prev_excluded == 1) || (strl->str2 != NULL) ) {
+        exclude_handle_exclude_reason( prev_excluded, strl, found_funit );
       }
 
     }
@@ -1592,9 +1895,10 @@ static bool exclude_toggle_from_id(
  for exclusion if it is excluding the coverage point and the -m option was specified on the command-line.
 */
 static bool exclude_memory_from_id(
-  const char* id  /*!< String version of exclusion ID */
+  const str_link* strl  /*!< Pointer to exclusion ID and exclusion reason from an exclusion batch file (if specified) */
 ) { PROFILE(EXCLUDE_MEMORY_FROM_ID);
 
+  const char* id = strl->str;  /* String version of exclusion ID */
   vsignal*   sig;          /* Pointer to found signal */
   func_unit* found_funit;  /* Pointer to functional unit containing sig */
   
@@ -1608,6 +1912,13 @@ static bool exclude_memory_from_id(
 
       exclude_print_exclusion( id, prev_excluded, found_funit );
 
+    /* Coverage points listed in an exclusion batch file are only excluded, never included */
+    } else if( (strl->suppl == 1) && (prev_excluded == 1) ) {
+
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "  Skipping %s (already excluded)", id );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
     /* Otherwise, perform the exclusion */
     } else {
 
@@ -1622,10 +1933,11 @@ static bool exclude_memory_from_id(
 
       /* Set the exclude bits in the expression supplemental field */
       sig->suppl.part.excluded = (prev_excluded ^ 1);
+      exclude_clear_stored_stats( found_funit );
    
       /* If we are excluding and the -m option was specified, get an exclusion reason from the user */
-      if( exclude_prompt_for_msgs || (prev_excluded == 1) ) {
-        exclude_handle_exclude_reason( prev_excluded, id, found_funit );
+      if( exclude_prompt_for_msgs || (prev_excluded == 1) || (strl->str2 != NULL) ) {
+        exclude_handle_exclude_reason( prev_excluded, strl, found_funit );
       }
 
     }
@@ -1651,9 +1963,10 @@ static bool exclude_memory_from_id(
  for exclusion if it is excluding the coverage point and the -m option was specified on the command-line.
 */
 static bool exclude_expr_from_id(
-  const char* id  /*!< String version of exclusion ID */
+  const str_link* strl  /*!< Pointer to exclusion ID and exclusion reason from an exclusion batch file (if specified) */
 ) { PROFILE(EXCLUDE_EXPR_FROM_ID);
 
+  const char* id = strl->str;  /* String version of exclusion ID */
   expression* exp;          /* Pointer to found expression */
   func_unit*  found_funit;  /* Pointer to functional unit containing exp */
   
@@ -1670,6 +1983,13 @@ static bool exclude_expr_from_id(
 
       exclude_print_exclusion( id, prev_excluded, found_funit );
 
+    /* Coverage points listed in an exclusion batch file are only excluded, never included */
+    } else if( (strl->suppl == 1) && (prev_excluded == 1) ) {
+
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "  Skipping %s (already excluded)", id );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
     /* Otherwise, perform the exclusion */
     } else {
     
@@ -1684,10 +2004,11 @@ static bool exclude_expr_from_id(
 
       /* Set the exclude bits in the expression supplemental field */
       exp->suppl.part.excluded = (prev_excluded ^ 1);
+      exclude_clear_stored_stats( found_funit );
     
       /* If we are excluding and the -m option was specified, get an exclusion reason from the user */
-      if( exclude_prompt_for_msgs || (prev_excluded == 1) ) { 
-        exclude_handle_exclude_reason( prev_excluded, id, found_funit );
+      if( exclude_prompt_for_msgs || (prev_excluded == 1) || (strl->str2 != NULL) ) {
+        exclude_handle_exclude_reason( prev_excluded, strl, found_funit );
       }
 
     }
@@ -1713,9 +2034,10 @@ static bool exclude_expr_from_id(
  for exclusion if it is excluding the coverage point and the -m option was specified on the command-line.
 */
 static bool exclude_fsm_from_id(
-  const char* id  /*!< String version of exclusion ID */
+  const str_link* strl  /*!< Pointer to exclusion ID and exclusion reason from an exclusion batch file (if specified) */
 ) { PROFILE(EXCLUDE_FSM_FROM_ID);
 
+  const char* id = strl->str;  /* String version of exclusion ID */
   int        arc_index;    /* Index of found state transition in arcs array */
   fsm_table* found_fsm;    /* Pointer to found FSM structure */
   func_unit* found_funit;  /* Pointer to functional unit containing arc */
@@ -1733,6 +2055,13 @@ static bool exclude_fsm_from_id(
 
       exclude_print_exclusion( id, prev_excluded, found_funit );
 
+    /* Coverage points listed in an exclusion batch file are only excluded, never included */
+    } else if( (strl->suppl == 1) && (prev_excluded == 1) ) {
+
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "  Skipping %s (already excluded)", id );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
     /* Otherwise, perform the exclusion */
     } else {
 
@@ -1747,10 +2076,11 @@ static bool exclude_fsm_from_id(
 
       /* Toggle the exclude bit */
       found_fsm->arcs[arc_index]->suppl.part.excluded = (prev_excluded ^ 1);
+      exclude_clear_stored_stats( found_funit );
 
       /* If we are excluding and the -m option was specified, get an exclusion reason from the user */
-      if( exclude_prompt_for_msgs || (prev_excluded == 1) ) {
-        exclude_handle_exclude_reason( prev_excluded, id, found_funit );
+      if( exclude_prompt_for_msgs || (prev_excluded == 1) || (strl->str2 != NULL) ) {
+        exclude_handle_exclude_reason( prev_excluded, strl, found_funit );
       }
 
     }
@@ -1776,9 +2106,10 @@ static bool exclude_fsm_from_id(
  for exclusion if it is excluding the coverage point and the -m option was specified on the command-line.
 */
 static bool exclude_assert_from_id(
-  const char* id  /*!< String version of exclusion ID */
+  const str_link* strl  /*!< Pointer to exclusion ID and exclusion reason from an exclusion batch file (if specified) */
 ) { PROFILE(EXCLUDE_ASSERT_FROM_ID);
 
+  const char* id = strl->str;  /* String version of exclusion ID */
   expression* exp;          /* Pointer to found expression */
   func_unit*  found_funit;  /* Pointer to functional unit containing exp */
 
@@ -1795,6 +2126,13 @@ static bool exclude_assert_from_id(
 
       exclude_print_exclusion( id, prev_excluded, found_funit );
 
+    /* Coverage points listed in an exclusion batch file are only excluded, never included */
+    } else if( (strl->suppl == 1) && (prev_excluded == 1) ) {
+
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "  Skipping %s (already excluded)", id );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
     /* Otherwise, perform the exclusion */
     } else {
 
@@ -1809,10 +2147,11 @@ static bool exclude_assert_from_id(
 
       /* Set the exclude bits in the expression supplemental field */
       exp->suppl.part.excluded = (prev_excluded ^ 1);
+      exclude_clear_stored_stats( found_funit );
   
       /* If we are excluding and the -m option was specified, get an exclusion reason from the user */
-      if( exclude_prompt_for_msgs || (prev_excluded == 1) ) {
-        exclude_handle_exclude_reason( prev_excluded, id, found_funit );
+      if( exclude_prompt_for_msgs || (prev_excluded == 1) || (strl->str2 != NULL) ) {
+        exclude_handle_exclude_reason( prev_excluded, strl, found_funit );
       }
 
     }
@@ -1845,12 +2184,12 @@ static bool exclude_apply_exclusions() { PROFILE(EXCLUDE_APPLY_EXCLUSIONS);
   strl = excl_ids_head;
   while( strl != NULL ) {
     switch( strl->str[0] ) {
-      case 'L' :  retval |= exclude_line_from_id( strl->str );    break;
-      case 'T' :  retval |= exclude_toggle_from_id( strl->str );  break;
-      case 'M' :  retval |= exclude_memory_from_id( strl->str );  break;
-      case 'E' :  retval |= exclude_expr_from_id( strl->str );    break;
-      case 'F' :  retval |= exclude_fsm_from_id( strl->str );     break;
-      case 'A' :  retval |= exclude_assert_from_id( strl->str );  break;
+      case 'L' :  retval |= exclude_line_from_id( strl );    break;
+      case 'T' :  retval |= exclude_toggle_from_id( strl );  break;
+      case 'M' :  retval |= exclude_memory_from_id( strl );  break;
+      case 'E' :  retval |= exclude_expr_from_id( strl );    break;
+      case 'F' :  retval |= exclude_fsm_from_id( strl );     break;
+      case 'A' :  retval |= exclude_assert_from_id( strl );  break;
       default  :
         rv = snprintf( user_msg, USER_MSG_LENGTH, "Illegal exclusion identifier specified (%s)", strl->str );
         assert( rv < USER_MSG_LENGTH );
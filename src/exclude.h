@@ -159,6 +159,9 @@ void exclude_merge(
   exclude_reason* er
 );
 
+/*! \brief Deallocates the exclusion ID index. */
+void exclude_index_dealloc();
+
 /*! \brief Allows the user to exclude coverage points from reporting. */
 void command_exclude(
   int          argc,
@@ -1527,11 +1527,19 @@ void expression_db_write(
   FILE*       file,        /*!< Pointer to database file to write to */
   bool        parse_mode,  /*!< Set to TRUE when we are writing after just parsing the design (causes ulid value to be
                                 output instead of id) */
-  bool        ids_issued   /*!< Set to TRUE if IDs were issued prior to calling this function */
+  bool        ids_issued,  /*!< Set to TRUE if IDs were issued prior to calling this function */
+  func_unit*  funit,       /*!< Pointer to functional unit being written that contains this expression (NULL if signal
+                                locations should not be recorded) */
+  uint64*     fingerprint  /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(EXPRESSION_DB_WRITE);
 
   assert( expr != NULL );
 
+  /* Fold the operation and the written vector width into the design fingerprint */
+  *fingerprint = util_hash64_uint32( *fingerprint, DB_TYPE_EXPRESSION );
+  *fingerprint = util_hash64_uint32( *fingerprint, expr->op );
+  *fingerprint = util_hash64_uint32( *fingerprint, (ESUPPL_OWNS_VEC( expr->suppl ) ? expr->value->width : 0) );
+
   fprintf( file, "%d %d %u %u %u %x %x %x %x %d %d",
     DB_TYPE_EXPRESSION,
     expression_get_id( expr, ids_issued ),
@@ -1555,7 +1563,20 @@ void expression_db_write(
   }
 
   if( expr->name != NULL ) {
-    fprintf( file, " %s", expr->name );
+    unsigned int sig_depth;
+    int          sig_index;
+    /*
+     If the expression is bound by a local name to a signal that is written with the given functional unit or one of its
+     parents, record where the signal is so that readers can bind to it without searching for it by name.
+    */
+    if( (funit != NULL) && (expr->sig != NULL) &&
+        (expr->op != EXP_OP_FUNC_CALL) && (expr->op != EXP_OP_TASK_CALL) && (expr->op != EXP_OP_FORK) &&
+        (expr->op != EXP_OP_NB_CALL) && (expr->op != EXP_OP_DISABLE) && scope_local( expr->name ) &&
+        funit_find_signal_ref( expr->name, funit, expr->sig, &sig_depth, &sig_index ) ) {
+      fprintf( file, " @%u:%d %s", sig_depth, sig_index, expr->name );
+    } else {
+      fprintf( file, " %s", expr->name );
+    }
   } else if( expr->sig != NULL ) {
     fprintf( file, " %s", expr->sig->name );  /* This will be valid for parameters */
   }
@@ -1572,20 +1593,21 @@ void expression_db_write(
  to the specified file.
 */
 void expression_db_write_tree(
-  expression* root,  /*!< Pointer to the root expression to display */
-  FILE*       ofile  /*!< Output file to write expression tree to */
+  expression* root,        /*!< Pointer to the root expression to display */
+  FILE*       ofile,       /*!< Output file to write expression tree to */
+  uint64*     fingerprint  /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(EXPRESSION_DB_WRITE_TREE);
 
   if( root != NULL ) {
 
     /* Print children first */
     if( EXPR_LEFT_DEALLOCABLE( root ) ) {
-      expression_db_write_tree( root->left, ofile );
+      expression_db_write_tree( root->left, ofile, fingerprint );
     }
-    expression_db_write_tree( root->right, ofile );
+    expression_db_write_tree( root->right, ofile, fingerprint );
 
     /* Now write ourselves */
-    expression_db_write( root, ofile, TRUE, TRUE );
+    expression_db_write( root, ofile, TRUE, TRUE, NULL, fingerprint );
 
   }
 
@@ -1692,14 +1714,26 @@ void expression_db_read(
 
       /* Check to see if we are bound to a signal or functional unit */
       if( ((*line)[0] != '\n') && ((*line)[0] != '\0') ) {
+        unsigned int sig_depth = 0;
+        int          sig_index = -1;
         (*line)++;   /* Remove space */
+        /* Get the location of the bound signal, if it was recorded */
+        if( sscanf( *line, "@%u:%d%n", &sig_depth, &sig_index, &chars_read ) == 2 ) {
+          *line = *line + chars_read + 1;
+        }
         switch( op ) {
           case EXP_OP_FUNC_CALL :  bind_add( FUNIT_FUNCTION,    *line, expr, curr_funit, FALSE );  break;
           case EXP_OP_TASK_CALL :  bind_add( FUNIT_TASK,        *line, expr, curr_funit, FALSE );  break;
           case EXP_OP_FORK      :
           case EXP_OP_NB_CALL   :  bind_add( FUNIT_NAMED_BLOCK, *line, expr, curr_funit, FALSE );  break;
           case EXP_OP_DISABLE   :  bind_add( 1,                 *line, expr, curr_funit, FALSE );  break;
-          default               :  bind_add( 0,                 *line, expr, curr_funit, FALSE );  break;
+          default               :
+            if( sig_index != -1 ) {
+              bind_add_indexed( *line, expr, curr_funit, sig_depth, sig_index );
+            } else {
+              bind_add( 0, *line, expr, curr_funit, FALSE );
+            }
+            break;
         }
       }
 
@@ -1815,6 +1849,52 @@ void expression_db_merge(
 
 }
 
+/*!
+ \throws anonymous Throw vector_db_merge
+
+ Parses specified line for expression information and merges only its coverage information (the execution
+ count, the merged supplemental bits and the vector) into the base expression.  The expression is known to come
+ from a CDD file created from the same design, so none of its structural fields are compared.
+*/
+void expression_db_merge_coverage(
+  expression* base,  /*!< Expression to merge data into */
+  char**      line   /*!< Pointer to CDD line to parse */
+) { PROFILE(EXPRESSION_DB_MERGE_COVERAGE);
+
+  uint32 exec_num;    /* Execution number */
+  esuppl suppl;       /* Supplemental field */
+  int    chars_read;  /* Number of characters read */
+
+  assert( base != NULL );
+
+  if( sscanf( *line, "%*d %*u %*u %*u %*x %x %*x %x %*d %*d%n", &exec_num, &(suppl.all), &chars_read ) == 2 ) {
+
+    *line = *line + chars_read;
+
+    /* Merge expression supplemental fields */
+    base->suppl.all = (base->suppl.all & ESUPPL_MERGE_MASK) | (suppl.all & ESUPPL_MERGE_MASK);
+
+    /* Merge execution number information */
+    if( base->exec_num < exec_num ) {
+      base->exec_num = exec_num;
+    }
+
+    /* Merge expression vectors */
+    if( ESUPPL_OWNS_VEC( suppl ) ) {
+      vector_db_merge( base->value, line, TRUE );
+    }
+
+  } else {
+
+    print_output( "Unable to parse expression line in database.  Unable to merge.", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  Performs an expression merge of two expressions, storing the result into the base expression.  This
  function is used by the GUI for calculating module coverage.
@@ -95,10 +95,10 @@ statement* expression_get_root_statement( expression* exp );
 void expression_assign_expr_ids( expression* root, func_unit* funit );
 
 /*! \brief Writes this expression to the specified database file. */
-void expression_db_write( expression* expr, FILE* file, bool parse_mode, bool ids_issued );
+void expression_db_write( expression* expr, FILE* file, bool parse_mode, bool ids_issued, func_unit* funit, uint64* fingerprint );
 
 /*! \brief Writes the entire expression tree to the specified data file. */
-void expression_db_write_tree( expression* root, FILE* file );
+void expression_db_write_tree( expression* root, FILE* file, uint64* fingerprint );
 
 /*! \brief Reads current line of specified file and parses for expression information. */
 void expression_db_read( char** line, /*@null@*/func_unit* curr_mod, bool eval );
@@ -110,6 +110,12 @@ void expression_db_merge(
   bool        same
 );
 
+/*! \brief Reads and merges only the coverage information of an expression from the same design into base. */
+void expression_db_merge_coverage(
+  expression* base,
+  char**      line
+);
+
 /*! \brief Merges two expressions into the base expression. */
 void expression_merge(
   expression* base,
@@ -171,11 +171,21 @@ void fsm_create_tables(
  Outputs the contents of the specified FSM to the specified CDD file.
 */
 void fsm_db_write(
-  fsm*  table,      /*!< Pointer to FSM structure to output */
-  FILE* file,       /*!< Pointer to file output stream to write to */
-  bool  ids_issued  /*!< Set to TRUE if expression IDs were just issued */
+  fsm*    table,       /*!< Pointer to FSM structure to output */
+  FILE*   file,        /*!< Pointer to file output stream to write to */
+  bool    ids_issued,  /*!< Set to TRUE if expression IDs were just issued */
+  uint64* fingerprint  /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(FSM_DB_WRITE);
 
+  /*
+   Fold the state widths of the FSM table and whether its state transitions were specified by the user into the
+   design fingerprint.  The states and arcs themselves are learned during simulation, so they are not part of it.
+  */
+  *fingerprint = util_hash64_uint32( *fingerprint, DB_TYPE_FSM );
+  *fingerprint = util_hash64_uint32( *fingerprint, table->from_state->value->width );
+  *fingerprint = util_hash64_uint32( *fingerprint, table->to_state->value->width );
+  *fingerprint = util_hash64_uint32( *fingerprint, (((table->table != NULL) && (table->table->suppl.part.known == 1)) ? 1 : 0) );
+
   fprintf( file, "%d %d %d ",
     DB_TYPE_FSM,
     expression_get_id( table->from_state, ids_issued ),
@@ -48,9 +48,10 @@ void fsm_create_tables(
 
 /*! \brief Outputs contents of specified FSM to CDD file. */
 void fsm_db_write(
-  fsm*  table,
-  FILE* file,
-  bool  ids_issued
+  fsm*    table,
+  FILE*   file,
+  bool    ids_issued,
+  uint64* fingerprint
 );
 
 /*! \brief Reads in contents of specified FSM. */
@@ -57,6 +57,11 @@ extern db**         db_list;
 extern unsigned int curr_db;
 extern func_unit*   curr_funit;
 extern isuppl       info_suppl;
+#ifndef RUNLIB
+#ifndef VPI_ONLY
+extern bool         flag_share_insts;
+#endif /* VPI_ONLY */
+#endif /* RUNLIB */
 
 
 /*!
@@ -80,6 +85,7 @@ static void funit_init(
   funit->sigs            = NULL;
   funit->sig_size        = 0;
   funit->sig_no_rm_index = 1;
+  funit->sig_index       = NULL;
   funit->exps            = NULL;
   funit->exp_size        = 0;
   funit->first_stmt      = NULL;
@@ -101,6 +107,8 @@ static void funit_init(
   funit->ei_tail         = NULL;
   funit->er_head         = NULL;
   funit->er_tail         = NULL;
+  funit->sized_inst      = NULL;
+  funit->stat_stale      = FALSE;
   funit->parent          = NULL;
   funit->elem.thr        = NULL;
 
@@ -278,6 +286,73 @@ mod_parm* funit_find_param(
 }
 #endif /* RUNLIB */
 
+/*!
+ \return Returns the index of the first signal in the signal array of the given functional unit that has
+         the specified name; otherwise, returns -1.
+
+ Searches only the signal array of the given functional unit (not its generate items).  Functional
+ units with many signals are searched through a hashed index of the signal array that is built on the
+ first search and extended as signals are added to the array; small arrays are scanned linearly.
+*/
+int funit_find_local_signal_index(
+  const char* name,  /*!< Name of the signal that we are searching for */
+  func_unit*  funit  /*!< Pointer to functional unit to search in */
+) { PROFILE(FUNIT_FIND_LOCAL_SIGNAL_INDEX);
+
+  int i = -1;  /* Index of the found signal */
+
+  if( funit->sig_size < SIG_INDEX_MIN_SIZE ) {
+
+    unsigned int j = 0;
+
+    while( (j < funit->sig_size) && !scope_compare( funit->sigs[j]->name, name ) ) j++;
+
+    if( j < funit->sig_size ) {
+      i = j;
+    }
+
+  } else {
+
+    /* Create the index and add any signals that have been appended to the array since the last search */
+    if( funit->sig_index == NULL ) {
+      funit->sig_index         = (name_index*)malloc_safe( sizeof( name_index ) );
+      funit->sig_index->names  = NULL;
+      funit->sig_index->hashes = NULL;
+      funit->sig_index->elems  = NULL;
+      funit->sig_index->size   = 0;
+      funit->sig_index->num    = 0;
+    }
+    while( funit->sig_index->num < funit->sig_size ) {
+      name_index_add( funit->sig_index, funit->sigs[funit->sig_index->num]->name, funit->sig_index->num );
+    }
+
+    i = name_index_find( funit->sig_index, name );
+
+  }
+
+  PROFILE_END;
+
+  return( i );
+
+}
+
+/*!
+ \return Returns a pointer to the first signal in the signal array of the given functional unit that
+         has the specified name; otherwise, returns NULL.
+*/
+vsignal* funit_find_local_signal(
+  const char* name,  /*!< Name of the signal that we are searching for */
+  func_unit*  funit  /*!< Pointer to functional unit to search in */
+) { PROFILE(FUNIT_FIND_LOCAL_SIGNAL);
+
+  int i = funit_find_local_signal_index( name, funit );
+
+  PROFILE_END;
+
+  return( (i == -1) ? NULL : funit->sigs[i] );
+
+}
+
 /*!
  \return Returns a pointer to the found signal in the given functional unit; otherwise,
          returns NULL if the signal could not be found.
@@ -303,7 +378,7 @@ vsignal* funit_find_signal(
   sig.name = name;
 
   /* Search for signal in given functional unit signal list */
-  if( (found_sig = sig_link_find( name, funit->sigs, funit->sig_size )) == NULL ) {
+  if( (found_sig = funit_find_local_signal( name, funit )) == NULL ) {
 
 #ifndef VPI_ONLY
 #ifndef RUNLIB
@@ -327,6 +402,50 @@ vsignal* funit_find_signal(
 
 }
 
+/*!
+ \return Returns TRUE if a search for the given signal name starting in the given functional unit would find the
+         given signal in the signal array of the given functional unit or of one of its parents; otherwise, returns FALSE.
+
+ Calculates the number of parent functional units that must be traversed from the given functional unit and the
+ index within that functional unit's signal array of the signal that a by-name search (as performed by
+ scope_find_signal for a local name) would find.  Only signals that are written to the CDD file with their
+ functional unit are considered.
+*/
+bool funit_find_signal_ref(
+            const char*    name,   /*!< Name of the signal to search for */
+            func_unit*     funit,  /*!< Pointer to functional unit to start searching in */
+            const vsignal* sig,    /*!< Pointer to signal that the search must find */
+  /*@out@*/ unsigned int*  depth,  /*!< Number of parent functional units traversed to find the signal */
+  /*@out@*/ int*           index   /*!< Index of the signal in the signal array of the functional unit it was found in */
+) { PROFILE(FUNIT_FIND_SIGNAL_REF);
+
+  bool retval = FALSE;  /* Return value for this function */
+
+  *depth = 0;
+
+  while( funit != NULL ) {
+
+    if( (*index = funit_find_local_signal_index( name, funit )) != -1 ) {
+      retval = (funit->sigs[*index] == sig) && ((unsigned int)*index < funit->sig_no_rm_index);
+      break;
+    }
+
+    /* Stop if the name would be found in a generate item of this functional unit */
+    if( funit_find_signal( (char*)name, funit ) != NULL ) {
+      break;
+    }
+
+    funit = funit->parent;
+    (*depth)++;
+
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
 #ifndef RUNLIB
 /*!
  Searches all statement blocks in the given functional unit that have expressions that call
@@ -405,6 +524,9 @@ void funit_size_elements(
   assert( funit != NULL );
   assert( inst != NULL );
 
+  /* Resizing may change the functional unit, so it is no longer sized for the instance it was last written for */
+  funit->sized_inst = NULL;
+
   /*
    First, traverse through current instance's parameter list and resolve
    any unresolved parameters created via generate statements.
@@ -517,6 +639,93 @@ void funit_size_elements(
 }
 #endif /* RUNLIB */
 
+#ifndef RUNLIB
+#ifndef VPI_ONLY
+/*!
+ \return Returns TRUE if the two given instance parameters belong to the same module parameter and have the same
+         name and value; otherwise, returns FALSE.
+
+ Parameters that are overridden by position are unnamed, so two unnamed parameters are considered to have the same name.
+*/
+static bool funit_inst_parms_match(
+  const inst_parm* iparm1,  /*!< Pointer to first instance parameter to compare */
+  const inst_parm* iparm2   /*!< Pointer to second instance parameter to compare */
+) { PROFILE(FUNIT_INST_PARMS_MATCH);
+
+  const vector* vec1   = iparm1->sig->value;
+  const vector* vec2   = iparm2->sig->value;
+  bool          retval = (iparm1->mparm != NULL) && (iparm1->mparm == iparm2->mparm) &&
+                         ((iparm1->sig->name == NULL) ? (iparm2->sig->name == NULL) :
+                                                        ((iparm2->sig->name != NULL) && (strcmp( iparm1->sig->name, iparm2->sig->name ) == 0))) &&
+                         (vec1->width == vec2->width) &&
+                         (vec1->suppl.part.data_type == vec2->suppl.part.data_type) &&
+                         (vec1->suppl.part.is_signed == vec2->suppl.part.is_signed);
+
+  if( retval ) {
+    switch( vec1->suppl.part.data_type ) {
+      case VDATA_UL :
+        {
+          unsigned int i;
+          for( i=0; (i<vec1->width) && retval; i+=UL_BITS ) {
+            retval = (vec1->value.ul[UL_DIV(i)][VTYPE_INDEX_VAL_VALL] == vec2->value.ul[UL_DIV(i)][VTYPE_INDEX_VAL_VALL]) &&
+                     (vec1->value.ul[UL_DIV(i)][VTYPE_INDEX_VAL_VALH] == vec2->value.ul[UL_DIV(i)][VTYPE_INDEX_VAL_VALH]);
+          }
+        }
+        break;
+      case VDATA_R64 :  retval = (vec1->value.r64->val == vec2->value.r64->val);  break;
+      case VDATA_R32 :  retval = (vec1->value.r32->val == vec2->value.r32->val);  break;
+      default        :  assert( 0 );  break;
+    }
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if the given module was last sized for an instance whose parameters have the same values
+         as the parameters of the given instance (so that sizing it for the given instance would not change it);
+         otherwise, returns FALSE.
+
+ Only used when the -share-insts score option is specified.  Modules containing generated items, generate variables,
+ function calls or hierarchical references are never shared as their sizing depends on more than their own parameters.
+*/
+static bool funit_is_sized_for(
+  const func_unit*  funit,  /*!< Pointer to functional unit to check */
+  const funit_inst* inst    /*!< Pointer to instance that the functional unit is about to be written for */
+) { PROFILE(FUNIT_IS_SIZED_FOR);
+
+  bool retval = flag_share_insts && (funit->sized_inst != NULL) && (funit->suppl.part.type == FUNIT_MODULE) &&
+                (inst->gitem_head == NULL) && (funit->sized_inst->gitem_head == NULL);
+
+  if( retval ) {
+
+    const inst_parm* iparm1 = funit->sized_inst->param_head;
+    const inst_parm* iparm2 = inst->param_head;
+    unsigned int     i;
+
+    while( (iparm1 != NULL) && (iparm2 != NULL) && funit_inst_parms_match( iparm1, iparm2 ) ) {
+      iparm1 = iparm1->next;
+      iparm2 = iparm2->next;
+    }
+    retval = (iparm1 == NULL) && (iparm2 == NULL);
+
+    for( i=0; (i<funit->exp_size) && retval; i++ ) {
+      retval = (funit->exps[i]->op != EXP_OP_FUNC_CALL) && ((funit->exps[i]->name == NULL) || scope_local( funit->exps[i]->name ));
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+#endif /* VPI_ONLY */
+#endif /* RUNLIB */
+
 /*!
  \throws anonymous funit_size_elements
 
@@ -530,7 +739,8 @@ void funit_db_write(
   bool        name_diff,    /*!< Specifies that this instance has an inaccurate way */
   FILE*       file,         /*!< Pointer to specified output file to write contents */
   funit_inst* inst,         /*!< Pointer to the current functional unit instance */
-  bool        ids_issued    /*!< Specifies if IDs have been issued prior to calling this function */
+  bool        ids_issued,   /*!< Specifies if IDs have been issued prior to calling this function */
+  uint64*     fingerprint   /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(FUNIT_DB_WRITE);
 
   stmt_link*      curr_stmt;      /* Statement list iterator */
@@ -581,11 +791,30 @@ void funit_db_write(
 #ifndef RUNLIB
     /* Size all elements in this functional unit and calculate timescale if we are in parse mode */
     if( inst != NULL ) {
+#ifndef VPI_ONLY
+      if( funit_is_sized_for( funit, inst ) ) {
+        /* The sizing is shared with the last written instance, only recreate the FSM tables (writing deallocates them) */
+        for( i=0; i<funit->fsm_size; i++ ) {
+          fsm_create_tables( funit->fsms[i] );
+        }
+      } else {
+        funit_size_elements( funit, inst, TRUE, FALSE );
+      }
+      if( flag_share_insts ) {
+        funit->sized_inst = inst;
+      }
+#else
       funit_size_elements( funit, inst, TRUE, FALSE );
+#endif /* VPI_ONLY */
       funit->timescale = db_scale_to_precision( (uint64)1, funit );
     }
 #endif /* RUNLIB */
   
+    /* Fold the functional unit type and written name into the design fingerprint */
+    *fingerprint = util_hash64_uint32( *fingerprint, DB_TYPE_FUNIT );
+    *fingerprint = util_hash64_uint32( *fingerprint, funit->suppl.part.type );
+    *fingerprint = util_hash64_string( *fingerprint, modname );
+
     /*@-duplicatequals -formattype -formatcode@*/
     fprintf( file, "%d %x %s \"%s\" %d %s %u %u %" FMT64 "u %s\n",
       DB_TYPE_FUNIT,
@@ -613,7 +842,7 @@ void funit_db_write(
 
     /* Now print all expressions in functional unit */
     for( i=0; i<funit->exp_size; i++ ) {
-      expression_db_write( funit->exps[i], file, (inst != NULL), ids_issued );
+      expression_db_write( funit->exps[i], file, (inst != NULL), ids_issued, funit, fingerprint );
     }
 
 #ifndef RUNLIB
@@ -622,7 +851,7 @@ void funit_db_write(
     if( inst != NULL ) {
       curr_gi = inst->gitem_head;
       while( curr_gi != NULL ) {
-        gen_item_db_write_expr_tree( curr_gi->gi, file );
+        gen_item_db_write_expr_tree( curr_gi->gi, file, fingerprint );
         curr_gi = curr_gi->next;
       }
     }
@@ -632,7 +861,7 @@ void funit_db_write(
     /* Now print all signals in functional unit */
     for( i=0; i<funit->sig_size; i++ ) {
       if( i < funit->sig_no_rm_index ) {
-        vsignal_db_write( funit->sigs[i], file );
+        vsignal_db_write( funit->sigs[i], file, fingerprint );
       }
     }
 
@@ -641,7 +870,7 @@ void funit_db_write(
     if( inst != NULL ) {
       curr_parm = inst->param_head;
       while( curr_parm != NULL ) {
-        param_db_write( curr_parm, file );
+        param_db_write( curr_parm, file, fingerprint );
         curr_parm = curr_parm->next;
       }
     }
@@ -651,7 +880,7 @@ void funit_db_write(
     if( inst != NULL ) {
       curr_gi = inst->gitem_head;
       while( curr_gi != NULL ) {
-        gen_item_db_write( curr_gi->gi, GI_TYPE_SIG, file );
+        gen_item_db_write( curr_gi->gi, GI_TYPE_SIG, file, fingerprint );
         curr_gi = curr_gi->next;
       }
     }
@@ -662,7 +891,7 @@ void funit_db_write(
     curr_stmt = funit->stmt_head;
     while( curr_stmt != NULL ) {
       if( curr_stmt->rm_stmt ) {
-        statement_db_write( curr_stmt->stmt, file, ids_issued );
+        statement_db_write( curr_stmt->stmt, file, ids_issued, fingerprint );
       }
       curr_stmt = curr_stmt->next;
     }
@@ -673,7 +902,7 @@ void funit_db_write(
     if( inst != NULL ) {
       curr_gi = inst->gitem_head;
       while( curr_gi != NULL ) {
-        gen_item_db_write( curr_gi->gi, GI_TYPE_STMT, file );
+        gen_item_db_write( curr_gi->gi, GI_TYPE_STMT, file, fingerprint );
         curr_gi = curr_gi->next;
       }
     }
@@ -682,14 +911,14 @@ void funit_db_write(
 
     /* Now print all FSM structures in functional unit */
     for( i=0; i<funit->fsm_size; i++ ) {
-      fsm_db_write( funit->fsms[i], file, ids_issued );
+      fsm_db_write( funit->fsms[i], file, ids_issued, fingerprint );
     }
 
     /* Now print all race condition block structures in functional unit (if we are a module) */
     if( funit->suppl.part.type == FUNIT_MODULE ) {
       curr_race = funit->race_head;
       while( curr_race != NULL ) {
-        race_db_write( curr_race, file );
+        race_db_write( curr_race, file, fingerprint );
         curr_race = curr_race->next;
       }
     }
@@ -976,6 +1205,101 @@ void funit_db_merge(
 
 }
 
+/*!
+ \throws anonymous Throw Throw
+
+ \return Returns a pointer to the portion of the read line that follows its type.
+
+ Reads the next line of the given CDD file, which must be of the given type.
+*/
+static char* funit_db_merge_read_line(
+  FILE*         file,            /*!< Pointer to CDD file handle to read */
+  char**        curr_line,       /*!< Pointer to the line buffer to read into */
+  unsigned int* curr_line_size,  /*!< Pointer to number of bytes allocated for curr_line */
+  int           exp_type         /*!< Type of line that is expected to be read next */
+) { PROFILE(FUNIT_DB_MERGE_READ_LINE);
+
+  int type;        /* Specifies currently read CDD type */
+  int chars_read;  /* Number of characters read from current CDD line */
+
+  if( !util_readline( file, curr_line, curr_line_size ) ||
+      (sscanf( *curr_line, "%d%n", &type, &chars_read ) != 1) || (type != exp_type) ) {
+    print_output( "Databases being merged are incompatible.", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  PROFILE_END;
+
+  return( *curr_line + chars_read );
+
+}
+
+/*!
+ \throws anonymous funit_db_merge_read_line expression_db_merge_coverage vsignal_db_merge_coverage fsm_db_merge
+
+ Reads the contents of a functional unit from a CDD file that was created from the same design as the current
+ database (their design fingerprints match) and merges only its coverage information into the base functional
+ unit:  the execution counts and evaluation bits of its expressions, the toggle and memory information of its
+ signals and the arcs of its FSMs.  Because the structure of the two functional units is known to be the same,
+ the version, statement and race condition block lines are skipped without being parsed.
+*/
+void funit_db_merge_coverage(
+  func_unit* base,  /*!< Functional unit to merge the coverage information into */
+  FILE*      file   /*!< Pointer to CDD file handle to read */
+) { PROFILE(FUNIT_DB_MERGE_COVERAGE);
+
+  char*        curr_line = NULL;  /* Pointer to current line being read from CDD */
+  unsigned int curr_line_size;    /* Number of bytes allocated for curr_line */
+  char*        rest_line;         /* Pointer to rest of read line */
+  stmt_link*   stmtl;             /* Pointer to current statement link */
+  race_blk*    race;              /* Pointer to current race condition block */
+  unsigned int i;
+
+  assert( base != NULL );
+
+  Try {
+
+    if( base->version != NULL ) {
+      (void)funit_db_merge_read_line( file, &curr_line, &curr_line_size, DB_TYPE_FUNIT_VERSION );
+    }
+
+    for( i=0; i<base->exp_size; i++ ) {
+      rest_line = funit_db_merge_read_line( file, &curr_line, &curr_line_size, DB_TYPE_EXPRESSION );
+      expression_db_merge_coverage( base->exps[i], &rest_line );
+    }
+
+    for( i=0; i<base->sig_size; i++ ) {
+      rest_line = funit_db_merge_read_line( file, &curr_line, &curr_line_size, DB_TYPE_SIGNAL );
+      vsignal_db_merge_coverage( base->sigs[i], &rest_line );
+    }
+
+    for( stmtl=base->stmt_head; stmtl!=NULL; stmtl=stmtl->next ) {
+      (void)funit_db_merge_read_line( file, &curr_line, &curr_line_size, DB_TYPE_STATEMENT );
+    }
+
+    for( i=0; i<base->fsm_size; i++ ) {
+      rest_line = funit_db_merge_read_line( file, &curr_line, &curr_line_size, DB_TYPE_FSM );
+      fsm_db_merge( base->fsms[i], &rest_line );
+    }
+
+    if( base->suppl.part.type == FUNIT_MODULE ) {
+      for( race=base->race_head; race!=NULL; race=race->next ) {
+        (void)funit_db_merge_read_line( file, &curr_line, &curr_line_size, DB_TYPE_RACE );
+      }
+    }
+
+  } Catch_anonymous {
+    free_safe( curr_line, curr_line_size );
+    Throw 0;
+  }
+
+  /* Deallocate memory */
+  free_safe( curr_line, curr_line_size );
+
+  PROFILE_END;
+
+}
+
 /*!
  Merges two functional units into the base functional unit.  Used for creating merged results
  for GUI usage.
@@ -1472,6 +1796,13 @@ static void funit_clean(
     funit->sig_size        = 0;
     funit->sig_no_rm_index = 1;
 
+    /* Free signal name index */
+    if( funit->sig_index != NULL ) {
+      name_index_dealloc( funit->sig_index );
+      free_safe( funit->sig_index, sizeof( name_index ) );
+      funit->sig_index = NULL;
+    }
+
     /* Free FSM list */
     fsm_link_delete_list( funit->fsms, funit->fsm_size );
     funit->fsms     = NULL;
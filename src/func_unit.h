@@ -69,12 +69,33 @@ mod_parm* funit_find_param(
   func_unit* funit
 );
 
+/*! \brief Finds the index of the specified signal in the signal array of the given functional unit */
+int funit_find_local_signal_index(
+  const char* name,
+  func_unit*  funit
+);
+
+/*! \brief Finds specified signal in the signal array of the given functional unit */
+vsignal* funit_find_local_signal(
+  const char* name,
+  func_unit*  funit
+);
+
 /*! \brief Finds specified signal given in the current functional unit */
 vsignal* funit_find_signal(
   char*      name,
   func_unit* funit
 );
 
+/*! \brief Finds the parent depth and signal array index of the signal that a search for the given name would find */
+bool funit_find_signal_ref(
+  const char*    name,
+  func_unit*     funit,
+  const vsignal* sig,
+  unsigned int*  depth,
+  int*           index
+);
+
 /*! \brief Finds all expressions that call the given statement */
 void funit_remove_stmt_blks_calling_stmt(
   func_unit* funit,
@@ -102,7 +123,8 @@ void funit_db_write(
   bool        name_diff,
   FILE*       file,
   funit_inst* inst,
-  bool        ids_issued
+  bool        ids_issued,
+  uint64*     fingerprint
 );
 
 /*! \brief Read contents of current line from specified file, creates functional unit
@@ -133,6 +155,12 @@ void funit_db_merge(
   bool       same
 );
 
+/*! \brief Reads and merges only the coverage information of a functional unit from the same design into base. */
+void funit_db_merge_coverage(
+  func_unit* base,
+  FILE*      file
+);
+
 /*! \brief Flattens the functional unit name by removing all unnamed scope portions */
 /*@shared@*/ char* funit_flatten_name(
   func_unit* funit
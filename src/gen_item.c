@@ -424,6 +424,69 @@ bool gen_item_varname_contains_genvar( char* name ) { PROFILE(GEN_ITEM_VARNAME_C
 
 }
 
+/*!
+ \return Returns the current value of the given generate variable.
+
+ \throws anonymous Throw Throw
+
+ Looks up the value of a generate variable index that consists of a single identifier directly, avoiding the
+ cost of running the static expression parser on it.  Reports the same errors as the static expression lexer.
+*/
+static int gen_item_genvar_value(
+  const char* genvar,     /*!< Name of generate variable to get the value of */
+  func_unit*  funit,      /*!< Pointer to current functional unit */
+  int         line,       /*!< Line number in which the signal's expression exists */
+  bool        no_genvars  /*!< If set to TRUE, generate variables are not allowed */
+) { PROFILE(GEN_ITEM_GENVAR_VALUE);
+
+  vsignal*     gvar;         /* Pointer to found generate variable */
+  func_unit*   found_funit;  /* Pointer to functional unit containing the generate variable */
+  unsigned int rv;           /* Return value from snprintf calls */
+
+  if( no_genvars ) {
+    rv = snprintf( user_msg, USER_MSG_LENGTH, "Generate variable found in constant expression outside of generate block, file: %s, line: %d",
+                   obf_file( funit->orig_fname ), line );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  if( !scope_find_signal( genvar, funit, &gvar, &found_funit, 0 ) ) {
+    rv = snprintf( user_msg, USER_MSG_LENGTH, "Unable to find generate variable %s in module %s",
+                   obf_sig( genvar ), obf_funit( funit->name ) );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  PROFILE_END;
+
+  return( vector_to_int( gvar->value ) );
+
+}
+
+/*!
+ \return Returns TRUE if the given string is a single Verilog identifier; otherwise, returns FALSE.
+*/
+static bool gen_item_is_identifier(
+  const char* str  /*!< String to check */
+) { PROFILE(GEN_ITEM_IS_IDENTIFIER);
+
+  bool retval = (str[0] == '_') || ((str[0] >= 'a') && (str[0] <= 'z')) || ((str[0] >= 'A') && (str[0] <= 'Z'));
+  int  i      = 1;
+
+  while( retval && (str[i] != '\0') ) {
+    retval = (str[i] == '_') || (str[i] == '$') || ((str[i] >= 'a') && (str[i] <= 'z')) || ((str[i] >= 'A') && (str[i] <= 'Z')) ||
+             ((str[i] >= '0') && (str[i] <= '9'));
+    i++;
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
 /*!
  \param name        Name of signal that we possibly need to convert if it contains generate variable(s)
  \param funit       Pointer to current functional unit
@@ -462,7 +525,9 @@ char* gen_item_calc_signal_name(
     do {
       gen_item_get_genvar( tmpname, &pre, &genvar, &post );
       if( genvar != NULL ) {
-        unsigned int rv = snprintf( intstr, 20, "%d", parse_static_expr( genvar, funit, line, no_genvars ) );
+        int          value = gen_item_is_identifier( genvar ) ? gen_item_genvar_value( genvar, funit, line, no_genvars )
+                                                                  : parse_static_expr( genvar, funit, line, no_genvars );
+        unsigned int rv    = snprintf( intstr, 20, "%d", value );
         assert( rv < 20 );
         new_name = (char*)realloc_safe( new_name, (strlen( new_name ) + 1), (strlen( new_name ) + strlen( pre ) + strlen( intstr ) + 3) );
         strncat( new_name, pre, strlen( pre ) );
@@ -789,9 +854,10 @@ void gen_item_assign_ids(
  not match, nothing is done.
 */
 void gen_item_db_write(
-  gen_item* gi,    /*!< Pointer to current generate item to test and output */
-  uint32    type,  /*!< Specifies the type of the generate item to output */
-  FILE*     ofile  /*!< Output file to display generate item to */
+  gen_item* gi,          /*!< Pointer to current generate item to test and output */
+  uint32    type,        /*!< Specifies the type of the generate item to output */
+  FILE*     ofile,       /*!< Output file to display generate item to */
+  uint64*   fingerprint  /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(GEN_ITEM_DB_WRITE);
 
   /* If the types match, output based on type */
@@ -799,10 +865,10 @@ void gen_item_db_write(
 
     switch( type ) {
       case GI_TYPE_SIG :
-        vsignal_db_write( gi->elem.sig, ofile );
+        vsignal_db_write( gi->elem.sig, ofile, fingerprint );
         break;
       case GI_TYPE_STMT :
-        statement_db_write_tree( gi->elem.stmt, ofile );
+        statement_db_write_tree( gi->elem.stmt, ofile, fingerprint );
         break;
       default :  /* Should never be called */
         assert( (type == GI_TYPE_SIG) || (type == GI_TYPE_STMT) );
@@ -819,14 +885,15 @@ void gen_item_db_write(
  Outputs all expressions for the statement contained in the specified generate item.
 */
 void gen_item_db_write_expr_tree(
-  gen_item* gi,    /*!< Pointer to current generate item to test and output */
-  FILE*     ofile  /*!< Output file to display generate item to */
+  gen_item* gi,          /*!< Pointer to current generate item to test and output */
+  FILE*     ofile,       /*!< Output file to display generate item to */
+  uint64*   fingerprint  /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(GEN_ITEM_DB_WRITE_EXPR_TREE);
 
   /* Only do this for statements */
   if( (gi->suppl.part.type == GI_TYPE_STMT) && (gi->suppl.part.removed == 0) ) {
 
-    statement_db_write_expr_tree( gi->elem.stmt, ofile );
+    statement_db_write_expr_tree( gi->elem.stmt, ofile, fingerprint );
 
   }
 
@@ -958,7 +1025,7 @@ static void gen_item_resolve(
 
       case GI_TYPE_SIG :
         gitem_link_add( gen_item_create_sig( gi->elem.sig ), &(inst->gitem_head), &(inst->gitem_tail) );
-        if( sig_link_find( gi->elem.sig->name, inst->funit->sigs, inst->funit->sig_size ) == NULL ) {
+        if( funit_find_local_signal( gi->elem.sig->name, inst->funit ) == NULL ) {
           sig_link_add( gi->elem.sig, FALSE, &(inst->funit->sigs), &(inst->funit->sig_size), &(inst->funit->sig_no_rm_index) );
         }
         gen_item_resolve( gi->next_true, inst );
@@ -1002,6 +1069,7 @@ static void gen_item_resolve(
           if( gi->varname != NULL ) {
             vsignal*     genvar;
             func_unit*   found_funit;
+            funit_inst*  last_child = inst->child_tail;
             unsigned int rv;
             if( !scope_find_signal( gi->varname, inst->funit, &genvar, &found_funit, 0 ) ) {
               rv = snprintf( user_msg, USER_MSG_LENGTH, "Unable to find variable %s in module %s",
@@ -1013,9 +1081,19 @@ static void gen_item_resolve(
             rv = snprintf( inst_name, 4096, "%s[%d]", gi->elem.inst->name, vector_to_int( genvar->value ) );
             assert( rv < 4096 );
             (void)instance_parse_add( &inst, inst->funit, gi->elem.inst->funit, inst_name, gi->elem.inst->ppfline, gi->elem.inst->fcol, NULL, FALSE, TRUE, FALSE, TRUE );
-            rv = snprintf( inst_name, 4096, "%s.%s[%d]", inst->name, gi->elem.inst->name, vector_to_int( genvar->value ) );
-            assert( rv < 4096 );
-            if( (child = instance_find_scope( inst, inst_name, TRUE )) != NULL ) {
+            /*
+             If the generated scope was just appended to our children, use it directly instead of searching all of
+             our children for it (each iteration of a large generate loop would otherwise search all prior iterations).
+            */
+            if( (last_child != inst->child_tail) && (strcmp( inst->child_tail->name, inst_name ) == 0) &&
+                (inst->range == NULL) && !funit_is_unnamed( inst->funit ) ) {
+              child = inst->child_tail;
+            } else {
+              rv = snprintf( inst_name, 4096, "%s.%s[%d]", inst->name, gi->elem.inst->name, vector_to_int( genvar->value ) );
+              assert( rv < 4096 );
+              child = instance_find_scope( inst, inst_name, TRUE );
+            }
+            if( child != NULL ) {
               inst_parm_add_genvar( genvar, child );
             }
           } else {
@@ -1102,13 +1180,20 @@ void generate_resolve_inst(
 
   if( inst != NULL ) {
 
-    /* Resolve ourself */
-    if( inst->funit != NULL ) {
+    /* Resolve ourself (using the child map to find existing instances while doing so) */
+    if( (inst->funit != NULL) && (inst->funit->gitem_head != NULL) ) {
       gitem_link* curr_gi = inst->funit->gitem_head;
-      while( curr_gi != NULL ) {
-        gen_item_resolve( curr_gi->gi, inst );
-        curr_gi = curr_gi->next;
+      instance_child_map_create();
+      Try {
+        while( curr_gi != NULL ) {
+          gen_item_resolve( curr_gi->gi, inst );
+          curr_gi = curr_gi->next;
+        }
+      } Catch_anonymous {
+        instance_child_map_dealloc();
+        Throw 0;
       }
+      instance_child_map_dealloc();
     }
 
   }
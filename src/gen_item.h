@@ -114,13 +114,15 @@ void gen_item_assign_ids(
 void gen_item_db_write(
   gen_item* gi,
   uint32    type,
-  FILE*     file
+  FILE*     file,
+  uint64*   fingerprint
 );
 
 /*! \brief Outputs the entire expression tree from the given generate statement */
 void gen_item_db_write_expr_tree(
   gen_item* gi,
-  FILE*     file
+  FILE*     file,
+  uint64*   fingerprint
 );
 
 /*! \brief Connects a generate item block to a new generate item */
@@ -36,8 +36,7 @@
 
 
 extern void reset_lexer_for_generation(
-  const char* in_fname,  /*!< Name of file to read */
-  const char* out_dir    /*!< Output directory name */
+  const char* in_fname  /*!< Name of file to read */
 );
 extern int VLparse();
 
@@ -884,7 +883,7 @@ static void generator_output_funits(
     if( (curr_ofile = fopen( filename, "w" )) != NULL ) {
 
       /* Parse the original code and output inline coverage code */
-      reset_lexer_for_generation( head->filename, "covered/verilog" );
+      reset_lexer_for_generation( head->filename );
       (void)VLparse();
 
       /* Flush the work and hold buffers */
@@ -54,20 +54,26 @@ profiler profiles[NUM_PROFILES] = {
   {"attribute_parse", NULL, 0, 0, 0, TRUE},
   {"attribute_dealloc", NULL, 0, 0, 0, TRUE},
   {"bind_add", NULL, 0, 0, 0, TRUE},
+  {"bind_add_indexed", NULL, 0, 0, 0, TRUE},
   {"bind_append_fsm_expr", NULL, 0, 0, 0, TRUE},
   {"bind_remove", NULL, 0, 0, 0, TRUE},
   {"bind_find_sig_name", NULL, 0, 0, 0, TRUE},
   {"bind_param", NULL, 0, 0, 0, TRUE},
   {"bind_signal", NULL, 0, 0, 0, TRUE},
+  {"bind_signal_link", NULL, 0, 0, 0, TRUE},
+  {"bind_find_indexed_signal", NULL, 0, 0, 0, TRUE},
   {"bind_task_function_ports", NULL, 0, 0, 0, TRUE},
   {"bind_task_function_namedblock", NULL, 0, 0, 0, TRUE},
   {"bind_perform", NULL, 0, 0, 0, TRUE},
   {"bind_dealloc", NULL, 0, 0, 0, TRUE},
-  {"codegen_create_expr_helper", NULL, 0, 0, 0, FALSE},
-  {"codegen_create_expr", NULL, 0, 0, 0, FALSE},
-  {"codegen_gen_expr1", NULL, 0, 0, 0, FALSE},
+  {"codegen_create_expr_helper", NULL, 0, 0, 0, TRUE},
+  {"codegen_adopt", NULL, 0, 0, 0, TRUE},
+  {"codegen_export", NULL, 0, 0, 0, TRUE},
+  {"codegen_create_expr", NULL, 0, 0, 0, TRUE},
+  {"codegen_gen_expr1", NULL, 0, 0, 0, TRUE},
   {"codegen_gen_expr", NULL, 0, 0, 0, TRUE},
   {"codegen_gen_expr_one_line", NULL, 0, 0, 0, TRUE},
+  {"codegen_dealloc", NULL, 0, 0, 0, TRUE},
   {"combination_calc_depth", NULL, 0, 0, 0, TRUE},
   {"combination_does_multi_exp_need_ul", NULL, 0, 0, 0, TRUE},
   {"combination_multi_expr_calc", NULL, 0, 0, 0, TRUE},
@@ -76,6 +82,10 @@ profiler profiles[NUM_PROFILES] = {
   {"combination_reset_counted_exprs", NULL, 0, 0, 0, TRUE},
   {"combination_reset_counted_expr_tree", NULL, 0, 0, 0, TRUE},
   {"combination_get_stats", NULL, 0, 0, 0, TRUE},
+  {"combination_copy_tree_ulids", NULL, 0, 0, 0, TRUE},
+  {"combination_copy_ulids", NULL, 0, 0, 0, TRUE},
+  {"combination_write_ulids", NULL, 0, 0, 0, TRUE},
+  {"combination_read_ulids", NULL, 0, 0, 0, TRUE},
   {"combination_get_funit_summary", NULL, 0, 0, 0, TRUE},
   {"combination_get_inst_summary", NULL, 0, 0, 0, TRUE},
   {"combination_display_instance_summary", NULL, 0, 0, 0, TRUE},
@@ -88,6 +98,8 @@ profiler profiles[NUM_PROFILES] = {
   {"combination_underline_tree", NULL, 0, 0, 0, TRUE},
   {"combination_prep_line", NULL, 0, 0, 0, TRUE},
   {"combination_underline", NULL, 0, 0, 0, TRUE},
+  {"combination_gen_code", NULL, 0, 0, 0, TRUE},
+  {"combination_dealloc_caches", NULL, 0, 0, 0, TRUE},
   {"combination_unary", NULL, 0, 0, 0, TRUE},
   {"combination_event", NULL, 0, 0, 0, TRUE},
   {"combination_two_vars", NULL, 0, 0, 0, TRUE},
@@ -166,6 +178,7 @@ profiler profiles[NUM_PROFILES] = {
   {"db_gen_curr_inst_scope", NULL, 0, 0, 0, TRUE},
   {"db_sync_curr_instance", NULL, 0, 0, 0, TRUE},
   {"db_set_vcd_scope", NULL, 0, 0, 0, TRUE},
+  {"db_vcd_scope_index_dealloc", NULL, 0, 0, 0, TRUE},
   {"db_vcd_upscope", NULL, 0, 0, 0, TRUE},
   {"db_assign_symbol", NULL, 0, 0, 0, TRUE},
   {"db_set_symbol_char", NULL, 0, 0, 0, TRUE},
@@ -183,6 +196,7 @@ profiler profiles[NUM_PROFILES] = {
   {"exclude_expr_assign_and_recalc", NULL, 0, 0, 0, TRUE},
   {"exclude_sig_assign_and_recalc", NULL, 0, 0, 0, TRUE},
   {"exclude_arc_assign_and_recalc", NULL, 0, 0, 0, TRUE},
+  {"exclude_clear_stored_stats", NULL, 0, 0, 0, TRUE},
   {"exclude_add_exclude_reason", NULL, 0, 0, 0, FALSE},
   {"exclude_remove_exclude_reason", NULL, 0, 0, 0, TRUE},
   {"exclude_is_line_excluded", NULL, 0, 0, 0, TRUE},
@@ -202,6 +216,11 @@ profiler profiles[NUM_PROFILES] = {
   {"exclude_db_merge", NULL, 0, 0, 0, TRUE},
   {"exclude_merge", NULL, 0, 0, 0, TRUE},
   {"exclude_find_signal", NULL, 0, 0, 0, TRUE},
+  {"exclude_index_add", NULL, 0, 0, 0, TRUE},
+  {"exclude_index_add_instance", NULL, 0, 0, 0, TRUE},
+  {"exclude_index_dealloc", NULL, 0, 0, 0, TRUE},
+  {"exclude_index_build", NULL, 0, 0, 0, TRUE},
+  {"exclude_read_batch_file", NULL, 0, 0, 0, TRUE},
   {"exclude_find_expression", NULL, 0, 0, 0, TRUE},
   {"exclude_find_fsm_arc", NULL, 0, 0, 0, TRUE},
   {"exclude_format_reason", NULL, 0, 0, 0, TRUE},
@@ -216,6 +235,28 @@ profiler profiles[NUM_PROFILES] = {
   {"exclude_assert_from_id", NULL, 0, 0, 0, TRUE},
   {"exclude_apply_exclusions", NULL, 0, 0, 0, TRUE},
   {"command_exclude", NULL, 0, 0, 0, TRUE},
+  {"command_serve", NULL, 0, 0, 0, TRUE},
+  {"serve_appendf", NULL, 0, 0, 0, TRUE},
+  {"serve_list_instances", NULL, 0, 0, 0, TRUE},
+  {"serve_find_funit", NULL, 0, 0, 0, TRUE},
+  {"serve_summary", NULL, 0, 0, 0, TRUE},
+  {"serve_collect", NULL, 0, 0, 0, TRUE},
+  {"serve_parse_int", NULL, 0, 0, 0, TRUE},
+  {"serve_find_signal", NULL, 0, 0, 0, TRUE},
+  {"serve_find_statement", NULL, 0, 0, 0, TRUE},
+  {"serve_find_assertion", NULL, 0, 0, 0, TRUE},
+  {"serve_fsm_coverage", NULL, 0, 0, 0, TRUE},
+  {"serve_detail", NULL, 0, 0, 0, TRUE},
+  {"serve_append_exclusion", NULL, 0, 0, 0, TRUE},
+  {"serve_excluded", NULL, 0, 0, 0, TRUE},
+  {"serve_rsp_dealloc", NULL, 0, 0, 0, TRUE},
+  {"serve_process_request", NULL, 0, 0, 0, TRUE},
+  {"serve_write_rsp", NULL, 0, 0, 0, TRUE},
+  {"serve_queue", NULL, 0, 0, 0, TRUE},
+  {"serve_write", NULL, 0, 0, 0, TRUE},
+  {"serve_close_client", NULL, 0, 0, 0, TRUE},
+  {"serve_handle_client", NULL, 0, 0, 0, TRUE},
+  {"serve_run", NULL, 0, 0, 0, TRUE},
   {"expression_create_tmp_vecs", NULL, 0, 0, 0, TRUE},
   {"expression_create_nba", NULL, 0, 0, 0, TRUE},
   {"expression_is_nba_lhs", NULL, 0, 0, 0, TRUE},
@@ -239,6 +280,7 @@ profiler profiles[NUM_PROFILES] = {
   {"expression_db_write_tree", NULL, 0, 0, 0, TRUE},
   {"expression_db_read", NULL, 0, 0, 0, TRUE},
   {"expression_db_merge", NULL, 0, 0, 0, TRUE},
+  {"expression_db_merge_coverage", NULL, 0, 0, 0, TRUE},
   {"expression_merge", NULL, 0, 0, 0, TRUE},
   {"expression_string_op", NULL, 0, 0, 0, TRUE},
   {"expression_string", NULL, 0, 0, 0, TRUE},
@@ -423,13 +465,20 @@ profiler profiles[NUM_PROFILES] = {
   {"funit_get_port_count", NULL, 0, 0, 0, TRUE},
   {"funit_find_param", NULL, 0, 0, 0, TRUE},
   {"funit_find_signal", NULL, 0, 0, 0, TRUE},
+  {"funit_find_signal_ref", NULL, 0, 0, 0, TRUE},
+  {"funit_find_local_signal", NULL, 0, 0, 0, TRUE},
+  {"funit_find_local_signal_index", NULL, 0, 0, 0, TRUE},
   {"funit_remove_stmt_blks_calling_stmt", NULL, 0, 0, 0, TRUE},
   {"funit_gen_task_function_namedblock_name", NULL, 0, 0, 0, TRUE},
   {"funit_size_elements", NULL, 0, 0, 0, TRUE},
   {"funit_db_write", NULL, 0, 0, 0, TRUE},
+  {"funit_inst_parms_match", NULL, 0, 0, 0, TRUE},
+  {"funit_is_sized_for", NULL, 0, 0, 0, TRUE},
   {"funit_db_read", NULL, 0, 0, 0, TRUE},
   {"funit_version_db_read", NULL, 0, 0, 0, TRUE},
   {"funit_db_merge", NULL, 0, 0, 0, TRUE},
+  {"funit_db_merge_read_line", NULL, 0, 0, 0, TRUE},
+  {"funit_db_merge_coverage", NULL, 0, 0, 0, TRUE},
   {"funit_merge", NULL, 0, 0, 0, TRUE},
   {"funit_flatten_name", NULL, 0, 0, 0, TRUE},
   {"funit_find_by_id", NULL, 0, 0, 0, TRUE},
@@ -456,6 +505,8 @@ profiler profiles[NUM_PROFILES] = {
   {"gen_item_get_genvar", NULL, 0, 0, 0, TRUE},
   {"gen_item_varname_contains_genvar", NULL, 0, 0, 0, FALSE},
   {"gen_item_calc_signal_name", NULL, 0, 0, 0, FALSE},
+  {"gen_item_genvar_value", NULL, 0, 0, 0, TRUE},
+  {"gen_item_is_identifier", NULL, 0, 0, 0, TRUE},
   {"gen_item_create_expr", NULL, 0, 0, 0, FALSE},
   {"gen_item_create_sig", NULL, 0, 0, 0, FALSE},
   {"gen_item_create_stmt", NULL, 0, 0, 0, FALSE},
@@ -551,7 +602,9 @@ profiler profiles[NUM_PROFILES] = {
   {"info_set_vector_elem_size", NULL, 0, 0, 0, TRUE},
   {"info_set_scored", NULL, 0, 0, 0, TRUE},
   {"info_db_write", NULL, 0, 0, 0, TRUE},
+  {"info_db_write_fingerprint", NULL, 0, 0, 0, TRUE},
   {"info_db_read", NULL, 0, 0, 0, TRUE},
+  {"info_read_fingerprint", NULL, 0, 0, 0, TRUE},
   {"args_db_read", NULL, 0, 0, 0, TRUE},
   {"message_db_read", NULL, 0, 0, 0, TRUE},
   {"merged_cdd_db_read", NULL, 0, 0, 0, TRUE},
@@ -564,6 +617,15 @@ profiler profiles[NUM_PROFILES] = {
   {"instance_gen_verilator_scope", NULL, 0, 0, 0, TRUE},
   {"instance_compare", NULL, 0, 0, 0, TRUE},
   {"instance_find_scope", NULL, 0, 0, 0, TRUE},
+  {"instance_index_hash", NULL, 0, 0, 0, TRUE},
+  {"instance_index_insert", NULL, 0, 0, 0, TRUE},
+  {"instance_index_add", NULL, 0, 0, 0, TRUE},
+  {"instance_index_add_candidate", NULL, 0, 0, 0, TRUE},
+  {"instance_index_add_tree", NULL, 0, 0, 0, TRUE},
+  {"instance_index_create", NULL, 0, 0, 0, TRUE},
+  {"instance_index_lookup", NULL, 0, 0, 0, TRUE},
+  {"instance_index_find", NULL, 0, 0, 0, TRUE},
+  {"instance_index_dealloc", NULL, 0, 0, 0, TRUE},
   {"instance_find_by_funit", NULL, 0, 0, 0, TRUE},
   {"instance_find_by_funit_name_if_one_helper", NULL, 0, 0, 0, TRUE},
   {"instance_find_by_funit_name_if_one", NULL, 0, 0, 0, TRUE},
@@ -571,6 +633,11 @@ profiler profiles[NUM_PROFILES] = {
   {"instance_find_expression_by_exclusion_id", NULL, 0, 0, 0, TRUE},
   {"instance_find_fsm_arc_index_by_exclusion_id", NULL, 0, 0, 0, TRUE},
   {"instance_add_child", NULL, 0, 0, 0, TRUE},
+  {"instance_child_map_slot", NULL, 0, 0, 0, TRUE},
+  {"instance_child_map_add", NULL, 0, 0, 0, TRUE},
+  {"instance_child_map_find", NULL, 0, 0, 0, TRUE},
+  {"instance_child_map_create", NULL, 0, 0, 0, TRUE},
+  {"instance_child_map_dealloc", NULL, 0, 0, 0, TRUE},
   {"instance_copy_helper", NULL, 0, 0, 0, TRUE},
   {"instance_copy", NULL, 0, 0, 0, TRUE},
   {"instance_parse_add", NULL, 0, 0, 0, TRUE},
@@ -586,6 +653,8 @@ profiler profiles[NUM_PROFILES] = {
   {"instance_db_write", NULL, 0, 0, 0, TRUE},
   {"instance_only_db_read", NULL, 0, 0, 0, TRUE},
   {"instance_only_db_merge", NULL, 0, 0, 0, TRUE},
+  {"instance_db_write_stats", NULL, 0, 0, 0, TRUE},
+  {"instance_db_read_stats", NULL, 0, 0, 0, TRUE},
   {"instance_remove_stmt_blks_calling_stmt", NULL, 0, 0, 0, TRUE},
   {"instance_remove_parms_with_expr", NULL, 0, 0, 0, TRUE},
   {"instance_dealloc_single", NULL, 0, 0, 0, TRUE},
@@ -673,6 +742,11 @@ profiler profiles[NUM_PROFILES] = {
   {"memory_funit_verbose", NULL, 0, 0, 0, TRUE},
   {"memory_report", NULL, 0, 0, 0, TRUE},
   {"merge_check", NULL, 0, 0, 0, TRUE},
+  {"merge_check_same_design", NULL, 0, 0, 0, TRUE},
+  {"merge_read_cdd", NULL, 0, 0, 0, TRUE},
+  {"merge_worker", NULL, 0, 0, 0, TRUE},
+  {"merge_remove_temps", NULL, 0, 0, 0, TRUE},
+  {"merge_parallel", NULL, 0, 0, 0, TRUE},
   {"command_merge", NULL, 0, 0, 0, TRUE},
   {"obfuscate_set_mode", NULL, 0, 0, 0, TRUE},
   {"obfuscate_name", NULL, 0, 0, 0, TRUE},
@@ -777,6 +851,33 @@ profiler profiles[NUM_PROFILES] = {
   {"perf_output_mod_stats", NULL, 0, 0, 0, TRUE},
   {"perf_output_inst_report_helper", NULL, 0, 0, 0, TRUE},
   {"perf_output_inst_report", NULL, 0, 0, 0, TRUE},
+  {"ppcache_file_sig", NULL, 0, 0, 0, TRUE},
+  {"ppcache_can_open", NULL, 0, 0, 0, TRUE},
+  {"ppcache_key_add", NULL, 0, 0, 0, TRUE},
+  {"ppcache_key_add_str", NULL, 0, 0, 0, TRUE},
+  {"ppcache_count_changes", NULL, 0, 0, 0, TRUE},
+  {"ppcache_write_str", NULL, 0, 0, 0, TRUE},
+  {"ppcache_write_define", NULL, 0, 0, 0, TRUE},
+  {"ppcache_write_changes", NULL, 0, 0, 0, TRUE},
+  {"ppcache_count_defines", NULL, 0, 0, 0, TRUE},
+  {"ppcache_write_defines", NULL, 0, 0, 0, TRUE},
+  {"ppcache_read_str", NULL, 0, 0, 0, TRUE},
+  {"ppcache_read_define", NULL, 0, 0, 0, TRUE},
+  {"ppcache_read_defines", NULL, 0, 0, 0, TRUE},
+  {"ppcache_entry_name", NULL, 0, 0, 0, TRUE},
+  {"ppcache_read_entry", NULL, 0, 0, 0, TRUE},
+  {"ppcache_load", NULL, 0, 0, 0, TRUE},
+  {"ppcache_add_include", NULL, 0, 0, 0, TRUE},
+  {"ppcache_add_missing", NULL, 0, 0, 0, TRUE},
+  {"ppcache_use_define", NULL, 0, 0, 0, TRUE},
+  {"ppcache_change_define", NULL, 0, 0, 0, TRUE},
+  {"ppcache_store", NULL, 0, 0, 0, TRUE},
+  {"ppcache_cancel", NULL, 0, 0, 0, TRUE},
+  {"ppcache_preprocess", NULL, 0, 0, 0, TRUE},
+  {"ppcache_preprocess_group", NULL, 0, 0, 0, TRUE},
+  {"ppcache_worker", NULL, 0, 0, 0, TRUE},
+  {"ppcache_populate", NULL, 0, 0, 0, TRUE},
+  {"ppcache_dealloc", NULL, 0, 0, 0, TRUE},
   {"def_lookup", NULL, 0, 0, 0, TRUE},
   {"is_defined", NULL, 0, 0, 0, TRUE},
   {"def_match", NULL, 0, 0, 0, TRUE},
@@ -791,8 +892,10 @@ profiler profiles[NUM_PROFILES] = {
   {"yywrap", NULL, 0, 0, 0, TRUE},
   {"reset_pplexer", NULL, 0, 0, 0, TRUE},
   {"race_blk_create", NULL, 0, 0, 0, TRUE},
-  {"race_find_head_statement_containing_statement_helper", NULL, 0, 0, 0, TRUE},
-  {"race_find_head_statement_containing_statement", NULL, 0, 0, 0, TRUE},
+  {"race_map_slot", NULL, 0, 0, 0, TRUE},
+  {"race_map_add", NULL, 0, 0, 0, TRUE},
+  {"race_map_dealloc", NULL, 0, 0, 0, TRUE},
+  {"race_map_find", NULL, 0, 0, 0, TRUE},
   {"race_get_head_statement", NULL, 0, 0, 0, TRUE},
   {"race_find_head_statement", NULL, 0, 0, 0, TRUE},
   {"race_calc_stmt_blk_type", NULL, 0, 0, 0, TRUE},
@@ -821,9 +924,23 @@ profiler profiles[NUM_PROFILES] = {
   {"rank_calc_num_cps", NULL, 0, 0, 0, TRUE},
   {"rank_gather_comp_cdd_cov", NULL, 0, 0, 0, TRUE},
   {"rank_read_cdd", NULL, 0, 0, 0, TRUE},
+  {"rank_worker", NULL, 0, 0, 0, TRUE},
+  {"rank_cache_close", NULL, 0, 0, 0, TRUE},
+  {"rank_cache_open", NULL, 0, 0, 0, TRUE},
+  {"rank_cache_find", NULL, 0, 0, 0, TRUE},
+  {"rank_cache_read_cdd", NULL, 0, 0, 0, TRUE},
+  {"rank_read_first_cdd", NULL, 0, 0, 0, TRUE},
+  {"rank_read_next_cdd", NULL, 0, 0, 0, TRUE},
+  {"rank_cache_write", NULL, 0, 0, 0, TRUE},
+  {"rank_read_cdds_parallel", NULL, 0, 0, 0, TRUE},
   {"rank_selected_cdd_cov", NULL, 0, 0, 0, TRUE},
   {"rank_perform_weighted_selection", NULL, 0, 0, 0, TRUE},
   {"rank_perform_greedy_sort", NULL, 0, 0, 0, TRUE},
+  {"rank_reset_need_masks", NULL, 0, 0, 0, TRUE},
+  {"rank_calc_needed_cps", NULL, 0, 0, 0, TRUE},
+  {"rank_add_ranked_cps", NULL, 0, 0, 0, TRUE},
+  {"rank_heap_sift_down", NULL, 0, 0, 0, TRUE},
+  {"rank_perform_lazy_greedy_sort", NULL, 0, 0, 0, TRUE},
   {"rank_count_cps", NULL, 0, 0, 0, TRUE},
   {"rank_perform", NULL, 0, 0, 0, TRUE},
   {"rank_output", NULL, 0, 0, 0, TRUE},
@@ -836,6 +953,12 @@ profiler profiles[NUM_PROFILES] = {
   {"report_parse_metrics", NULL, 0, 0, 0, TRUE},
   {"report_parse_args", NULL, 0, 0, 0, TRUE},
   {"report_gather_instance_stats", NULL, 0, 0, 0, TRUE},
+  {"report_collect_instances", NULL, 0, 0, 0, TRUE},
+  {"report_stats_worker", NULL, 0, 0, 0, TRUE},
+  {"report_gather_instance_stats_parallel", NULL, 0, 0, 0, TRUE},
+  {"report_section_worker", NULL, 0, 0, 0, TRUE},
+  {"report_start_section_worker", NULL, 0, 0, 0, TRUE},
+  {"report_generate_sections_parallel", NULL, 0, 0, 0, TRUE},
   {"report_gather_funit_stats", NULL, 0, 0, 0, TRUE},
   {"report_print_header", NULL, 0, 0, 0, TRUE},
   {"report_generate", NULL, 0, 0, 0, TRUE},
@@ -864,6 +987,14 @@ profiler profiles[NUM_PROFILES] = {
   {"search_add_file", NULL, 0, 0, 0, FALSE},
   {"search_add_no_score_funit", NULL, 0, 0, 0, FALSE},
   {"search_add_extensions", NULL, 0, 0, 0, FALSE},
+  {"search_dir_index_name", NULL, 0, 0, 0, TRUE},
+  {"search_scan_directory", NULL, 0, 0, 0, TRUE},
+  {"search_read_str", NULL, 0, 0, 0, TRUE},
+  {"search_read_dir_index", NULL, 0, 0, 0, TRUE},
+  {"search_write_dir_index", NULL, 0, 0, 0, TRUE},
+  {"search_read_directory", NULL, 0, 0, 0, TRUE},
+  {"search_add_vfile", NULL, 0, 0, 0, TRUE},
+  {"search_load_files", NULL, 0, 0, 0, TRUE},
   {"search_free_lists", NULL, 0, 0, 0, TRUE},
   {"sim_current_thread", NULL, 0, 0, 0, FALSE},
   {"sim_thread_pop_head", NULL, 0, 0, 0, TRUE},
@@ -1024,6 +1155,7 @@ profiler profiles[NUM_PROFILES] = {
   {"tree_find", NULL, 0, 0, 0, TRUE},
   {"tree_remove", NULL, 0, 0, 0, TRUE},
   {"tree_dealloc", NULL, 0, 0, 0, TRUE},
+  {"tree_rebalance", NULL, 0, 0, 0, TRUE},
   {"check_option_value", NULL, 0, 0, 0, TRUE},
   {"is_variable", NULL, 0, 0, 0, TRUE},
   {"is_func_unit", NULL, 0, 0, 0, TRUE},
@@ -1054,6 +1186,20 @@ profiler profiles[NUM_PROFILES] = {
   {"convert_str_to_uint64", NULL, 0, 0, 0, TRUE},
   {"convert_int_to_str", NULL, 0, 0, 0, TRUE},
   {"calc_num_bits_to_store", NULL, 0, 0, 0, TRUE},
+  {"util_hash", NULL, 0, 0, 0, TRUE},
+  {"util_hash_string", NULL, 0, 0, 0, TRUE},
+  {"util_hash_uint32", NULL, 0, 0, 0, TRUE},
+  {"util_hash64", NULL, 0, 0, 0, TRUE},
+  {"util_hash64_string", NULL, 0, 0, 0, TRUE},
+  {"util_hash64_uint32", NULL, 0, 0, 0, TRUE},
+  {"str_arena_alloc", NULL, 0, 0, 0, TRUE},
+  {"name_index_insert", NULL, 0, 0, 0, TRUE},
+  {"name_index_add", NULL, 0, 0, 0, TRUE},
+  {"name_index_find", NULL, 0, 0, 0, TRUE},
+  {"name_index_dealloc", NULL, 0, 0, 0, TRUE},
+  {"str_arena_strdup", NULL, 0, 0, 0, TRUE},
+  {"str_arena_reset", NULL, 0, 0, 0, TRUE},
+  {"str_arena_dealloc", NULL, 0, 0, 0, TRUE},
   {"vcd_calc_index", NULL, 0, 0, 0, TRUE},
   {"vcd_getch_fetch", NULL, 0, 0, 0, TRUE},
   {"vcd_get_token", NULL, 0, 0, 0, TRUE},
@@ -1182,6 +1328,7 @@ profiler profiles[NUM_PROFILES] = {
   {"vsignal_db_write", NULL, 0, 0, 0, TRUE},
   {"vsignal_db_read", NULL, 0, 0, 0, TRUE},
   {"vsignal_db_merge", NULL, 0, 0, 0, TRUE},
+  {"vsignal_db_merge_coverage", NULL, 0, 0, 0, TRUE},
   {"vsignal_merge", NULL, 0, 0, 0, TRUE},
   {"vsignal_propagate", NULL, 0, 0, 0, TRUE},
   {"vsignal_vcd_assign", NULL, 0, 0, 0, TRUE},
@@ -24,7 +24,7 @@
 
 #include "defines.h"
 
-#define NUM_PROFILES 1173
+#define NUM_PROFILES 1320
 
 #ifdef DEBUG
 #define UNREGISTERED 0
@@ -64,1142 +64,1289 @@
 #define ATTRIBUTE_PARSE 34
 #define ATTRIBUTE_DEALLOC 35
 #define BIND_ADD 36
-#define BIND_APPEND_FSM_EXPR 37
-#define BIND_REMOVE 38
-#define BIND_FIND_SIG_NAME 39
-#define BIND_PARAM 40
-#define BIND_SIGNAL 41
-#define BIND_TASK_FUNCTION_PORTS 42
-#define BIND_TASK_FUNCTION_NAMEDBLOCK 43
-#define BIND_PERFORM 44
-#define BIND_DEALLOC 45
-#define CODEGEN_CREATE_EXPR_HELPER 46
-#define CODEGEN_CREATE_EXPR 47
-#define CODEGEN_GEN_EXPR1 48
-#define CODEGEN_GEN_EXPR 49
-#define CODEGEN_GEN_EXPR_ONE_LINE 50
-#define COMBINATION_CALC_DEPTH 51
-#define COMBINATION_DOES_MULTI_EXP_NEED_UL 52
-#define COMBINATION_MULTI_EXPR_CALC 53
-#define COMBINATION_IS_EXPR_MULTI_NODE 54
-#define COMBINATION_GET_TREE_STATS 55
-#define COMBINATION_RESET_COUNTED_EXPRS 56
-#define COMBINATION_RESET_COUNTED_EXPR_TREE 57
-#define COMBINATION_GET_STATS 58
-#define COMBINATION_GET_FUNIT_SUMMARY 59
-#define COMBINATION_GET_INST_SUMMARY 60
-#define COMBINATION_DISPLAY_INSTANCE_SUMMARY 61
-#define COMBINATION_INSTANCE_SUMMARY 62
-#define COMBINATION_DISPLAY_FUNIT_SUMMARY 63
-#define COMBINATION_FUNIT_SUMMARY 64
-#define COMBINATION_DRAW_LINE 65
-#define COMBINATION_DRAW_CENTERED_LINE 66
-#define COMBINATION_PARENTHESIZE 67
-#define COMBINATION_UNDERLINE_TREE 68
-#define COMBINATION_PREP_LINE 69
-#define COMBINATION_UNDERLINE 70
-#define COMBINATION_UNARY 71
-#define COMBINATION_EVENT 72
-#define COMBINATION_TWO_VARS 73
-#define COMBINATION_MULTI_VAR_EXPRS 74
-#define COMBINATION_MULTI_EXPR_OUTPUT_LENGTH 75
-#define COMBINATION_MULTI_EXPR_OUTPUT 76
-#define COMBINATION_MULTI_VARS 77
-#define COMBINATION_GET_MISSED_EXPR 78
-#define COMBINATION_LIST_MISSED 79
-#define COMBINATION_OUTPUT_EXPR 80
-#define COMBINATION_DISPLAY_VERBOSE 81
-#define COMBINATION_INSTANCE_VERBOSE 82
-#define COMBINATION_FUNIT_VERBOSE 83
-#define COMBINATION_COLLECT 84
-#define COMBINATION_GET_EXCLUDE_LIST 85
-#define COMBINATION_GET_EXPRESSION 86
-#define COMBINATION_GET_COVERAGE 87
-#define COMBINATION_REPORT 88
-#define DB_CREATE 89
-#define DB_CLOSE 90
-#define DB_CHECK_FOR_TOP_MODULE 91
-#define DB_WRITE 92
-#define DB_READ 93
-#define DB_ASSIGN_IDS 94
-#define DB_MERGE_INSTANCE_TREES 95
-#define DB_MERGE_FUNITS 96
-#define DB_SCALE_TO_PRECISION 97
-#define DB_CREATE_UNNAMED_SCOPE 98
-#define DB_IS_UNNAMED_SCOPE 99
-#define DB_SET_TIMESCALE 100
-#define DB_FIND_AND_SET_CURR_FUNIT 101
-#define DB_GET_CURR_FUNIT 102
-#define DB_GET_FUNIT_BY_POSITION 103
-#define DB_GET_EXCLUSION_ID_SIZE 104
-#define DB_GEN_EXCLUSION_ID 105
-#define DB_ADD_FILE_VERSION 106
-#define DB_OUTPUT_DUMPVARS 107
-#define DB_ADD_INSTANCE 108
-#define DB_ADD_MODULE 109
-#define DB_END_MODULE 110
-#define DB_ADD_FUNCTION_TASK_NAMEDBLOCK 111
-#define DB_END_FUNCTION_TASK_NAMEDBLOCK 112
-#define DB_ADD_DECLARED_PARAM 113
-#define DB_ADD_OVERRIDE_PARAM 114
-#define DB_ADD_VECTOR_PARAM 115
-#define DB_ADD_DEFPARAM 116
-#define DB_ADD_SIGNAL 117
-#define DB_ADD_ENUM 118
-#define DB_END_ENUM_LIST 119
-#define DB_ADD_TYPEDEF 120
-#define DB_FIND_SIGNAL 121
-#define DB_ADD_GEN_ITEM_BLOCK 122
-#define DB_FIND_GEN_ITEM 123
-#define DB_FIND_TYPEDEF 124
-#define DB_GET_CURR_GEN_BLOCK 125
-#define DB_CURR_SIGNAL_COUNT 126
-#define DB_CREATE_EXPRESSION 127
-#define DB_BIND_EXPR_TREE 128
-#define DB_CREATE_EXPR_FROM_STATIC 129
-#define DB_ADD_EXPRESSION 130
-#define DB_CREATE_SENSITIVITY_LIST 131
-#define DB_PARALLELIZE_STATEMENT 132
-#define DB_CREATE_STATEMENT 133
-#define DB_ADD_STATEMENT 134
-#define DB_REMOVE_STATEMENT_FROM_CURRENT_FUNIT 135
-#define DB_REMOVE_STATEMENT 136
-#define DB_CONNECT_STATEMENT_TRUE 137
-#define DB_CONNECT_STATEMENT_FALSE 138
-#define DB_GEN_ITEM_CONNECT_TRUE 139
-#define DB_GEN_ITEM_CONNECT_FALSE 140
-#define DB_GEN_ITEM_CONNECT 141
-#define DB_STATEMENT_CONNECT 142
-#define DB_CREATE_ATTR_PARAM 143
-#define DB_PARSE_ATTRIBUTE 144
-#define DB_REMOVE_STMT_BLKS_CALLING_STATEMENT 145
-#define DB_GEN_CURR_INST_SCOPE 146
-#define DB_SYNC_CURR_INSTANCE 147
-#define DB_SET_VCD_SCOPE 148
-#define DB_VCD_UPSCOPE 149
-#define DB_ASSIGN_SYMBOL 150
-#define DB_SET_SYMBOL_CHAR 151
-#define DB_SET_SYMBOL_STRING 152
-#define DB_DO_TIMESTEP 153
-#define DB_CHECK_DUMPFILE_SCOPES 154
-#define DB_VERILATOR_INITIALIZE 155
-#define DB_VERILATOR_CLOSE 156
-#define DB_ADD_LINE_COVERAGE 157
-#define ENUMERATE_ADD_ITEM 158
-#define ENUMERATE_END_LIST 159
-#define ENUMERATE_RESOLVE 160
-#define ENUMERATE_DEALLOC 161
-#define ENUMERATE_DEALLOC_LIST 162
-#define EXCLUDE_EXPR_ASSIGN_AND_RECALC 163
-#define EXCLUDE_SIG_ASSIGN_AND_RECALC 164
-#define EXCLUDE_ARC_ASSIGN_AND_RECALC 165
-#define EXCLUDE_ADD_EXCLUDE_REASON 166
-#define EXCLUDE_REMOVE_EXCLUDE_REASON 167
-#define EXCLUDE_IS_LINE_EXCLUDED 168
-#define EXCLUDE_SET_LINE_EXCLUDE 169
-#define EXCLUDE_IS_TOGGLE_EXCLUDED 170
-#define EXCLUDE_SET_TOGGLE_EXCLUDE 171
-#define EXCLUDE_IS_COMB_EXCLUDED 172
-#define EXCLUDE_SET_COMB_EXCLUDE 173
-#define EXCLUDE_IS_FSM_EXCLUDED 174
-#define EXCLUDE_SET_FSM_EXCLUDE 175
-#define EXCLUDE_IS_ASSERT_EXCLUDED 176
-#define EXCLUDE_SET_ASSERT_EXCLUDE 177
-#define EXCLUDE_FIND_EXCLUDE_REASON 178
-#define EXCLUDE_DB_WRITE 179
-#define EXCLUDE_DB_READ 180
-#define EXCLUDE_RESOLVE_REASON 181
-#define EXCLUDE_DB_MERGE 182
-#define EXCLUDE_MERGE 183
-#define EXCLUDE_FIND_SIGNAL 184
-#define EXCLUDE_FIND_EXPRESSION 185
-#define EXCLUDE_FIND_FSM_ARC 186
-#define EXCLUDE_FORMAT_REASON 187
-#define EXCLUDED_GET_MESSAGE 188
-#define EXCLUDE_HANDLE_EXCLUDE_REASON 189
-#define EXCLUDE_PRINT_EXCLUSION 190
-#define EXCLUDE_LINE_FROM_ID 191
-#define EXCLUDE_TOGGLE_FROM_ID 192
-#define EXCLUDE_MEMORY_FROM_ID 193
-#define EXCLUDE_EXPR_FROM_ID 194
-#define EXCLUDE_FSM_FROM_ID 195
-#define EXCLUDE_ASSERT_FROM_ID 196
-#define EXCLUDE_APPLY_EXCLUSIONS 197
-#define COMMAND_EXCLUDE 198
-#define EXPRESSION_CREATE_TMP_VECS 199
-#define EXPRESSION_CREATE_NBA 200
-#define EXPRESSION_IS_NBA_LHS 201
-#define EXPRESSION_CREATE_VALUE 202
-#define EXPRESSION_CREATE 203
-#define EXPRESSION_SET_VALUE 204
-#define EXPRESSION_SET_SIGNED 205
-#define EXPRESSION_RESIZE 206
-#define EXPRESSION_GET_ID 207
-#define EXPRESSION_GET_FIRST_LINE_EXPR 208
-#define EXPRESSION_GET_LAST_LINE_EXPR 209
-#define EXPRESSION_GET_CURR_DIMENSION 210
-#define EXPRESSION_FIND_RHS_SIGS 211
-#define EXPRESSION_FIND_PARAMS 212
-#define EXPRESSION_FIND_ULINE_ID 213
-#define EXPRESSION_FIND_EXPR 214
-#define EXPRESSION_CONTAINS_EXPR_CALLING_STMT 215
-#define EXPRESSION_GET_ROOT_STATEMENT 216
-#define EXPRESSION_ASSIGN_EXPR_IDS 217
-#define EXPRESSION_DB_WRITE 218
-#define EXPRESSION_DB_WRITE_TREE 219
-#define EXPRESSION_DB_READ 220
-#define EXPRESSION_DB_MERGE 221
-#define EXPRESSION_MERGE 222
-#define EXPRESSION_STRING_OP 223
-#define EXPRESSION_STRING 224
-#define EXPRESSION_OP_FUNC__XOR 225
-#define EXPRESSION_OP_FUNC__XOR_A 226
-#define EXPRESSION_OP_FUNC__MULTIPLY 227
-#define EXPRESSION_OP_FUNC__MULTIPLY_A 228
-#define EXPRESSION_OP_FUNC__DIVIDE 229
-#define EXPRESSION_OP_FUNC__DIVIDE_A 230
-#define EXPRESSION_OP_FUNC__MOD 231
-#define EXPRESSION_OP_FUNC__MOD_A 232
-#define EXPRESSION_OP_FUNC__ADD 233
-#define EXPRESSION_OP_FUNC__ADD_A 234
-#define EXPRESSION_OP_FUNC__SUBTRACT 235
-#define EXPRESSION_OP_FUNC__SUB_A 236
-#define EXPRESSION_OP_FUNC__AND 237
-#define EXPRESSION_OP_FUNC__AND_A 238
-#define EXPRESSION_OP_FUNC__OR 239
-#define EXPRESSION_OP_FUNC__OR_A 240
-#define EXPRESSION_OP_FUNC__NAND 241
-#define EXPRESSION_OP_FUNC__NOR 242
-#define EXPRESSION_OP_FUNC__NXOR 243
-#define EXPRESSION_OP_FUNC__LT 244
-#define EXPRESSION_OP_FUNC__GT 245
-#define EXPRESSION_OP_FUNC__LSHIFT 246
-#define EXPRESSION_OP_FUNC__LSHIFT_A 247
-#define EXPRESSION_OP_FUNC__RSHIFT 248
-#define EXPRESSION_OP_FUNC__RSHIFT_A 249
-#define EXPRESSION_OP_FUNC__ARSHIFT 250
-#define EXPRESSION_OP_FUNC__ARSHIFT_A 251
-#define EXPRESSION_OP_FUNC__TIME 252
-#define EXPRESSION_OP_FUNC__RANDOM 253
-#define EXPRESSION_OP_FUNC__SASSIGN 254
-#define EXPRESSION_OP_FUNC__SRANDOM 255
-#define EXPRESSION_OP_FUNC__URANDOM 256
-#define EXPRESSION_OP_FUNC__URANDOM_RANGE 257
-#define EXPRESSION_OP_FUNC__REALTOBITS 258
-#define EXPRESSION_OP_FUNC__BITSTOREAL 259
-#define EXPRESSION_OP_FUNC__SHORTREALTOBITS 260
-#define EXPRESSION_OP_FUNC__BITSTOSHORTREAL 261
-#define EXPRESSION_OP_FUNC__ITOR 262
-#define EXPRESSION_OP_FUNC__RTOI 263
-#define EXPRESSION_OP_FUNC__TEST_PLUSARGS 264
-#define EXPRESSION_OP_FUNC__VALUE_PLUSARGS 265
-#define EXPRESSION_OP_FUNC__SIGNED 266
-#define EXPRESSION_OP_FUNC__UNSIGNED 267
-#define EXPRESSION_OP_FUNC__CLOG2 268
-#define EXPRESSION_OP_FUNC__EQ 269
-#define EXPRESSION_OP_FUNC__CEQ 270
-#define EXPRESSION_OP_FUNC__LE 271
-#define EXPRESSION_OP_FUNC__GE 272
-#define EXPRESSION_OP_FUNC__NE 273
-#define EXPRESSION_OP_FUNC__CNE 274
-#define EXPRESSION_OP_FUNC__LOR 275
-#define EXPRESSION_OP_FUNC__LAND 276
-#define EXPRESSION_OP_FUNC__COND 277
-#define EXPRESSION_OP_FUNC__COND_SEL 278
-#define EXPRESSION_OP_FUNC__UINV 279
-#define EXPRESSION_OP_FUNC__UAND 280
-#define EXPRESSION_OP_FUNC__UNOT 281
-#define EXPRESSION_OP_FUNC__UOR 282
-#define EXPRESSION_OP_FUNC__UXOR 283
-#define EXPRESSION_OP_FUNC__UNAND 284
-#define EXPRESSION_OP_FUNC__UNOR 285
-#define EXPRESSION_OP_FUNC__UNXOR 286
-#define EXPRESSION_OP_FUNC__NULL 287
-#define EXPRESSION_OP_FUNC__SIG 288
-#define EXPRESSION_OP_FUNC__SBIT 289
-#define EXPRESSION_OP_FUNC__MBIT 290
-#define EXPRESSION_OP_FUNC__EXPAND 291
-#define EXPRESSION_OP_FUNC__LIST 292
-#define EXPRESSION_OP_FUNC__CONCAT 293
-#define EXPRESSION_OP_FUNC__PEDGE 294
-#define EXPRESSION_OP_FUNC__NEDGE 295
-#define EXPRESSION_OP_FUNC__AEDGE 296
-#define EXPRESSION_OP_FUNC__EOR 297
-#define EXPRESSION_OP_FUNC__SLIST 298
-#define EXPRESSION_OP_FUNC__DELAY 299
-#define EXPRESSION_OP_FUNC__TRIGGER 300
-#define EXPRESSION_OP_FUNC__CASE 301
-#define EXPRESSION_OP_FUNC__CASEX 302
-#define EXPRESSION_OP_FUNC__CASEZ 303
-#define EXPRESSION_OP_FUNC__DEFAULT 304
-#define EXPRESSION_OP_FUNC__BASSIGN 305
-#define EXPRESSION_OP_FUNC__FUNC_CALL 306
-#define EXPRESSION_OP_FUNC__TASK_CALL 307
-#define EXPRESSION_OP_FUNC__NB_CALL 308
-#define EXPRESSION_OP_FUNC__FORK 309
-#define EXPRESSION_OP_FUNC__JOIN 310
-#define EXPRESSION_OP_FUNC__DISABLE 311
-#define EXPRESSION_OP_FUNC__REPEAT 312
-#define EXPRESSION_OP_FUNC__EXPONENT 313
-#define EXPRESSION_OP_FUNC__PASSIGN 314
-#define EXPRESSION_OP_FUNC__MBIT_POS 315
-#define EXPRESSION_OP_FUNC__MBIT_NEG 316
-#define EXPRESSION_OP_FUNC__NEGATE 317
-#define EXPRESSION_OP_FUNC__IINC 318
-#define EXPRESSION_OP_FUNC__PINC 319
-#define EXPRESSION_OP_FUNC__IDEC 320
-#define EXPRESSION_OP_FUNC__PDEC 321
-#define EXPRESSION_OP_FUNC__DLY_ASSIGN 322
-#define EXPRESSION_OP_FUNC__DLY_OP 323
-#define EXPRESSION_OP_FUNC__REPEAT_DLY 324
-#define EXPRESSION_OP_FUNC__DIM 325
-#define EXPRESSION_OP_FUNC__WAIT 326
-#define EXPRESSION_OP_FUNC__FINISH 327
-#define EXPRESSION_OP_FUNC__STOP 328
-#define EXPRESSION_OPERATE 329
-#define EXPRESSION_OPERATE_RECURSIVELY 330
-#define EXPRESSION_SET_LINE_COVERAGE 331
-#define EXPRESSION_VCD_ASSIGN 332
-#define EXPRESSION_IS_STATIC_ONLY_HELPER 333
-#define EXPRESSION_IS_ASSIGNED 334
-#define EXPRESSION_IS_BIT_SELECT 335
-#define EXPRESSION_IS_LAST_SELECT 336
-#define EXPRESSION_GET_FIRST_SELECT 337
-#define EXPRESSION_IS_IN_RASSIGN 338
-#define EXPRESSION_SET_ASSIGNED 339
-#define EXPRESSION_SET_CHANGED 340
-#define EXPRESSION_ASSIGN 341
-#define EXPRESSION_DEALLOC 342
-#define FSM_CREATE 343
-#define FSM_ADD_ARC 344
-#define FSM_CREATE_TABLES 345
-#define FSM_DB_WRITE 346
-#define FSM_DB_READ 347
-#define FSM_DB_MERGE 348
-#define FSM_MERGE 349
-#define FSM_TABLE_SET 350
-#define FSM_VCD_ASSIGN 351
-#define FSM_GET_STATS 352
-#define FSM_GET_FUNIT_SUMMARY 353
-#define FSM_GET_INST_SUMMARY 354
-#define FSM_GATHER_SIGNALS 355
-#define FSM_COLLECT 356
-#define FSM_GET_COVERAGE 357
-#define FSM_DISPLAY_INSTANCE_SUMMARY 358
-#define FSM_INSTANCE_SUMMARY 359
-#define FSM_DISPLAY_FUNIT_SUMMARY 360
-#define FSM_FUNIT_SUMMARY 361
-#define FSM_DISPLAY_STATE_VERBOSE 362
-#define FSM_DISPLAY_ARC_VERBOSE 363
-#define FSM_DISPLAY_VERBOSE 364
-#define FSM_INSTANCE_VERBOSE 365
-#define FSM_FUNIT_VERBOSE 366
-#define FSM_REPORT 367
-#define FSM_DEALLOC 368
-#define FSM_ARG_PARSE_STATE 369
-#define FSM_ARG_PARSE 370
-#define FSM_ARG_PARSE_VALUE 371
-#define FSM_ARG_PARSE_TRANS 372
-#define FSM_ARG_PARSE_ATTR 373
-#define FSM_VAR_ADD 374
-#define FSM_VAR_IS_OUTPUT_STATE 375
-#define FSM_VAR_BIND_EXPR 376
-#define FSM_VAR_ADD_EXPR 377
-#define FSM_VAR_BIND_STMT 378
-#define FSM_VAR_BIND_ADD 379
-#define FSM_VAR_STMT_ADD 380
-#define FSM_VAR_BIND 381
-#define FSM_VAR_DEALLOC 382
-#define FSM_VAR_REMOVE 383
-#define FSM_VAR_CLEANUP 384
-#define FST_READER_PROCESS_HIER 385
-#define FST_CALLBACK 386
-#define FST_PARSE 387
-#define FUNC_ITER_DISPLAY 388
-#define FUNC_ITER_SORT 389
-#define FUNC_ITER_COUNT_STMT_ITERS 390
-#define FUNC_ITER_ADD_STMT_ITERS 391
-#define FUNC_ITER_ADD_SIG_LINKS 392
-#define FUNC_ITER_INIT 393
-#define FUNC_ITER_GET_NEXT_STATEMENT 394
-#define FUNC_ITER_GET_NEXT_SIGNAL 395
-#define FUNC_ITER_DEALLOC 396
-#define FUNIT_INIT 397
-#define FUNIT_CREATE 398
-#define FUNIT_GET_CURR_MODULE 399
-#define FUNIT_GET_CURR_MODULE_SAFE 400
-#define FUNIT_GET_CURR_FUNCTION 401
-#define FUNIT_GET_CURR_TASK 402
-#define FUNIT_GET_PORT_COUNT 403
-#define FUNIT_FIND_PARAM 404
-#define FUNIT_FIND_SIGNAL 405
-#define FUNIT_REMOVE_STMT_BLKS_CALLING_STMT 406
-#define FUNIT_GEN_TASK_FUNCTION_NAMEDBLOCK_NAME 407
-#define FUNIT_SIZE_ELEMENTS 408
-#define FUNIT_DB_WRITE 409
-#define FUNIT_DB_READ 410
-#define FUNIT_VERSION_DB_READ 411
-#define FUNIT_DB_MERGE 412
-#define FUNIT_MERGE 413
-#define FUNIT_FLATTEN_NAME 414
-#define FUNIT_FIND_BY_ID 415
-#define FUNIT_IS_TOP_MODULE 416
-#define FUNIT_IS_UNNAMED 417
-#define FUNIT_IS_UNNAMED_CHILD_OF 418
-#define FUNIT_IS_CHILD_OF 419
-#define FUNIT_DISPLAY_SIGNALS 420
-#define FUNIT_DISPLAY_EXPRESSIONS 421
-#define STATEMENT_ADD_THREAD 422
-#define FUNIT_PUSH_THREADS 423
-#define STATEMENT_DELETE_THREAD 424
-#define FUNIT_OUTPUT_DUMPVARS 425
-#define FUNIT_IS_ONE_SIGNAL_ASSIGNED 426
-#define FUNIT_CLEAN 427
-#define FUNIT_DEALLOC 428
-#define GEN_ITEM_STRINGIFY 429
-#define GEN_ITEM_DISPLAY 430
-#define GEN_ITEM_DISPLAY_BLOCK_HELPER 431
-#define GEN_ITEM_DISPLAY_BLOCK 432
-#define GEN_ITEM_COMPARE 433
-#define GEN_ITEM_FIND 434
-#define GEN_ITEM_REMOVE_IF_CONTAINS_EXPR_CALLING_STMT 435
-#define GEN_ITEM_GET_GENVAR 436
-#define GEN_ITEM_VARNAME_CONTAINS_GENVAR 437
-#define GEN_ITEM_CALC_SIGNAL_NAME 438
-#define GEN_ITEM_CREATE_EXPR 439
-#define GEN_ITEM_CREATE_SIG 440
-#define GEN_ITEM_CREATE_STMT 441
-#define GEN_ITEM_CREATE_INST 442
-#define GEN_ITEM_CREATE_TFN 443
-#define GEN_ITEM_CREATE_BIND 444
-#define GEN_ITEM_RESIZE_STMTS_AND_SIGS 445
-#define GEN_ITEM_ASSIGN_IDS 446
-#define GEN_ITEM_DB_WRITE 447
-#define GEN_ITEM_DB_WRITE_EXPR_TREE 448
-#define GEN_ITEM_CONNECT 449
-#define GEN_ITEM_RESOLVE 450
-#define GEN_ITEM_BIND 451
-#define GENERATE_RESOLVE_INST 452
-#define GENERATE_REMOVE_STMT_HELPER 453
-#define GENERATE_REMOVE_STMT 454
-#define GENERATE_FIND_STMT_BY_POSITION_HELPER 455
-#define GENERATE_FIND_STMT_BY_POSITION 456
-#define GENERATE_FIND_TFN_BY_POSITION_HELPER 457
-#define GENERATE_FIND_TFN_BY_POSITION 458
-#define GEN_ITEM_DEALLOC 459
-#define GENERATOR_GET_RELATIVE_SCOPE 460
-#define GENERATOR_CLEAR_REPLACE_PTRS 461
-#define GENERATOR_IS_STATIC_FUNCTION_ONLY 462
-#define GENERATOR_IS_STATIC_FUNCTION 463
-#define GENERATOR_REPLACE 464
-#define GENERATOR_PUSH_REG_INSERT 465
-#define GENERATOR_POP_REG_INSERT 466
-#define GENERATOR_IS_BASE_REG_INSERT 467
-#define GENERATOR_INSERT_REG 468
-#define GENERATOR_PUSH_FUNIT 469
-#define GENERATOR_POP_FUNIT 470
-#define GENERATOR_EXPR_NEEDS_TO_BE_SUBSTITUTED 471
-#define GENERATOR_EXPR_COV_NEEDED 472
-#define GENERATOR_CLEAR_COMB_CNTD 473
-#define GENERATOR_CREATE_EXPR_NAME 474
-#define GENERATOR_SORT_FUNIT_BY_FILENAME 475
-#define GENERATOR_SET_NEXT_FUNIT 476
-#define GENERATOR_DEALLOC_FNAME_LIST 477
-#define GENERATOR_OUTPUT_FUNIT 478
-#define GENERATOR_WRITE_VERILATOR_INST_IDS 479
-#define GENERATOR_OUTPUT 480
-#define GENERATOR_INIT_FUNIT 481
-#define GENERATOR_PREPEND_TO_WORK_CODE 482
-#define GENERATOR_ADD_TO_WORK_CODE 483
-#define GENERATOR_FLUSH_WORK_CODE1 484
-#define GENERATOR_ADD_TO_HOLD_CODE 485
-#define GENERATOR_FLUSH_HOLD_CODE1 486
-#define GENERATOR_FLUSH_ALL1 487
-#define GENERATOR_FIND_STATEMENT 488
-#define GENERATOR_FIND_CASE_STATEMENT 489
-#define GENERATOR_INSERT_LINE_COV_WITH_STMT 490
-#define GENERATOR_INSERT_LINE_COV 491
-#define GENERATOR_INSERT_EVENT_COMB_COV 492
-#define GENERATOR_INSERT_UNARY_COMB_COV 493
-#define GENERATOR_INSERT_AND_COMB_COV 494
-#define GENERATOR_MBIT_GEN_VALUE 495
-#define GENERATOR_IS_RHS_OF_ASSIGNMENT 496
-#define GENERATOR_GEN_SIZE 497
-#define GENERATOR_CREATE_LHS 498
-#define GENERATOR_INSERT_SUBEXP 499
-#define GENERATOR_COMB_COV_HELPER2 500
-#define GENERATOR_INSERT_COMB_COV_HELPER 501
-#define GENERATOR_GEN_MEM_INDEX_HELPER 502
-#define GENERATOR_GEN_MEM_INDEX 503
-#define GENERATOR_GEN_MEM_SIZE 504
-#define GENERATOR_GET_LHS_LSB_HELPER 505
-#define GENERATOR_GET_LHS_LSB 506
-#define GENERATOR_MEM_COV 507
-#define GENERATOR_MEM_COV_HELPER 508
-#define GENERATOR_COMB_COV 509
-#define GENERATOR_INSERT_COMB_COV_FROM_STMT_STACK 510
-#define GENERATOR_INSERT_COMB_COV_WITH_STMT 511
-#define GENERATOR_INSERT_CASE_COMB_COV 512
-#define GENERATOR_FSM_COVS 513
-#define GENERATOR_HANDLE_EVENT_TYPE 514
-#define GENERATOR_HANDLE_EVENT_TRIGGER 515
-#define GENERATOR_HOLD_LAST_TOKEN 516
-#define GENERATOR_FLUSH_HELD_TOKEN 517
-#define GENERATOR_INST_ID_PARAM 518
-#define GENERATOR_INST_ID_OVERRIDES_HELPER 519
-#define GENERATOR_INST_ID_OVERRIDES 520
-#define GENERATOR_BEGIN_PARALLEL_STATEMENT 521
-#define GENERATOR_END_PARALLEL_STATEMENT 522
-#define GENERATOR_BUILD 523
-#define GENERATOR_BUILD2 524
-#define GENERATOR_DESTROY2 525
-#define GENERATOR_TMP_REGS 526
-#define GENERATOR_CREATE_TMP_REGS 527
-#define GENERROR 528
-#define GENERATOR_WRITE_TO_FILE 529
-#define SCORE_ADD_ARGS 530
-#define INFO_SET_VECTOR_ELEM_SIZE 531
-#define INFO_SET_SCORED 532
-#define INFO_DB_WRITE 533
-#define INFO_DB_READ 534
-#define ARGS_DB_READ 535
-#define MESSAGE_DB_READ 536
-#define MERGED_CDD_DB_READ 537
-#define INFO_DEALLOC 538
-#define INSTANCE_DISPLAY_TREE_HELPER 539
-#define INSTANCE_DISPLAY_TREE 540
-#define INSTANCE_CREATE 541
-#define INSTANCE_ASSIGN_IDS 542
-#define INSTANCE_GEN_SCOPE 543
-#define INSTANCE_GEN_VERILATOR_SCOPE 544
-#define INSTANCE_COMPARE 545
-#define INSTANCE_FIND_SCOPE 546
-#define INSTANCE_FIND_BY_FUNIT 547
-#define INSTANCE_FIND_BY_FUNIT_NAME_IF_ONE_HELPER 548
-#define INSTANCE_FIND_BY_FUNIT_NAME_IF_ONE 549
-#define INSTANCE_FIND_SIGNAL_BY_EXCLUSION_ID 550
-#define INSTANCE_FIND_EXPRESSION_BY_EXCLUSION_ID 551
-#define INSTANCE_FIND_FSM_ARC_INDEX_BY_EXCLUSION_ID 552
-#define INSTANCE_ADD_CHILD 553
-#define INSTANCE_COPY_HELPER 554
-#define INSTANCE_COPY 555
-#define INSTANCE_PARSE_ADD 556
-#define INSTANCE_RESOLVE_INST 557
-#define INSTANCE_RESOLVE_HELPER 558
-#define INSTANCE_RESOLVE 559
-#define INSTANCE_READ_ADD 560
-#define INSTANCE_MERGE 561
-#define INSTANCE_GET_LEADING_HIERARCHY 562
-#define INSTANCE_GET_VERILATOR_LEADING_HIERARCHY 563
-#define INSTANCE_MARK_LHIER_DIFFS 564
-#define INSTANCE_MERGE_TWO_TREES 565
-#define INSTANCE_DB_WRITE 566
-#define INSTANCE_ONLY_DB_READ 567
-#define INSTANCE_ONLY_DB_MERGE 568
-#define INSTANCE_REMOVE_STMT_BLKS_CALLING_STMT 569
-#define INSTANCE_REMOVE_PARMS_WITH_EXPR 570
-#define INSTANCE_DEALLOC_SINGLE 571
-#define INSTANCE_OUTPUT_DUMPVARS 572
-#define INSTANCE_DEALLOC_TREE 573
-#define INSTANCE_DEALLOC 574
-#define LINE_GET_STATS 575
-#define LINE_COLLECT 576
-#define LINE_GET_FUNIT_SUMMARY 577
-#define LINE_GET_INST_SUMMARY 578
-#define LINE_DISPLAY_INSTANCE_SUMMARY 579
-#define LINE_INSTANCE_SUMMARY 580
-#define LINE_DISPLAY_FUNIT_SUMMARY 581
-#define LINE_FUNIT_SUMMARY 582
-#define LINE_DISPLAY_VERBOSE 583
-#define LINE_INSTANCE_VERBOSE 584
-#define LINE_FUNIT_VERBOSE 585
-#define LINE_REPORT 586
-#define STR_LINK_ADD 587
-#define STMT_LINK_ADD_HEAD 588
-#define EXP_LINK_ADD 589
-#define SIG_LINK_ADD 590
-#define FSM_LINK_ADD 591
-#define FUNIT_LINK_ADD 592
-#define GITEM_LINK_ADD 593
-#define INST_LINK_ADD 594
-#define STR_LINK_FIND 595
-#define STMT_LINK_FIND 596
-#define STMT_LINK_FIND_BY_POSITION 597
-#define EXP_LINK_FIND 598
-#define SIG_LINK_FIND 599
-#define FSM_LINK_FIND 600
-#define FUNIT_LINK_FIND 601
-#define GITEM_LINK_FIND 602
-#define INST_LINK_FIND_BY_SCOPE 603
-#define INST_LINK_FIND_BY_FUNIT 604
-#define STR_LINK_REMOVE 605
-#define EXP_LINK_REMOVE 606
-#define GITEM_LINK_REMOVE 607
-#define FUNIT_LINK_REMOVE 608
-#define STR_LINK_DELETE_LIST 609
-#define STMT_LINK_UNLINK 610
-#define STMT_LINK_DELETE_LIST 611
-#define EXP_LINK_DELETE_LIST 612
-#define SIG_LINK_DELETE_LIST 613
-#define FSM_LINK_DELETE_LIST 614
-#define FUNIT_LINK_DELETE_LIST 615
-#define GITEM_LINK_DELETE_LIST 616
-#define INST_LINK_DELETE_LIST 617
-#define VCDID 618
-#define VCD_CALLBACK 619
-#define LXT_PARSE 620
-#define LXT2_RD_EXPAND_INTEGER_TO_BITS 621
-#define LXT2_RD_EXPAND_BITS_TO_INTEGER 622
-#define LXT2_RD_ITER_RADIX 623
-#define LXT2_RD_ITER_RADIX0 624
-#define LXT2_RD_BUILD_RADIX 625
-#define LXT2_RD_REGENERATE_PROCESS_MASK 626
-#define LXT2_RD_PROCESS_BLOCK 627
-#define LXT2_RD_INIT 628
-#define LXT2_RD_CLOSE 629
-#define LXT2_RD_GET_FACNAME 630
-#define LXT2_RD_ITER_BLOCKS 631
-#define LXT2_RD_LIMIT_TIME_RANGE 632
-#define LXT2_RD_UNLIMIT_TIME_RANGE 633
-#define MEMORY_GET_STAT 634
-#define MEMORY_GET_STATS 635
-#define MEMORY_GET_FUNIT_SUMMARY 636
-#define MEMORY_GET_INST_SUMMARY 637
-#define MEMORY_CREATE_PDIM_BIT_ARRAY 638
-#define MEMORY_GET_MEM_COVERAGE 639
-#define MEMORY_GET_COVERAGE 640
-#define MEMORY_COLLECT 641
-#define MEMORY_DISPLAY_TOGGLE_INSTANCE_SUMMARY 642
-#define MEMORY_TOGGLE_INSTANCE_SUMMARY 643
-#define MEMORY_DISPLAY_AE_INSTANCE_SUMMARY 644
-#define MEMORY_AE_INSTANCE_SUMMARY 645
-#define MEMORY_DISPLAY_TOGGLE_FUNIT_SUMMARY 646
-#define MEMORY_TOGGLE_FUNIT_SUMMARY 647
-#define MEMORY_DISPLAY_AE_FUNIT_SUMMARY 648
-#define MEMORY_AE_FUNIT_SUMMARY 649
-#define MEMORY_DISPLAY_MEMORY 650
-#define MEMORY_DISPLAY_VERBOSE 651
-#define MEMORY_INSTANCE_VERBOSE 652
-#define MEMORY_FUNIT_VERBOSE 653
-#define MEMORY_REPORT 654
-#define MERGE_CHECK 655
-#define COMMAND_MERGE 656
-#define OBFUSCATE_SET_MODE 657
-#define OBFUSCATE_NAME 658
-#define OBFUSCATE_DEALLOC 659
-#define OVL_IS_ASSERTION_NAME 660
-#define OVL_IS_ASSERTION_MODULE 661
-#define OVL_IS_COVERAGE_POINT 662
-#define OVL_ADD_ASSERTIONS_TO_NO_SCORE_LIST 663
-#define OVL_GET_FUNIT_STATS 664
-#define OVL_GET_COVERAGE_POINT 665
-#define OVL_DISPLAY_VERBOSE 666
-#define OVL_COLLECT 667
-#define OVL_GET_COVERAGE 668
-#define MOD_PARM_FIND 669
-#define MOD_PARM_FIND_EXPR_AND_REMOVE 670
-#define MOD_PARM_GEN_SIZE_CODE 671
-#define MOD_PARM_GEN_LSB_CODE 672
-#define MOD_PARM_ADD 673
-#define INST_PARM_FIND 674
-#define INST_PARM_ADD 675
-#define INST_PARM_ADD_GENVAR 676
-#define INST_PARM_BIND 677
-#define DEFPARAM_ADD 678
-#define DEFPARAM_DEALLOC 679
-#define PARAM_FIND_AND_SET_EXPR_VALUE 680
-#define PARAM_SET_SIG_SIZE 681
-#define PARAM_SIZE_FUNCTION 682
-#define PARAM_EXPR_EVAL 683
-#define PARAM_HAS_OVERRIDE 684
-#define PARAM_HAS_DEFPARAM 685
-#define PARAM_RESOLVE_DECLARED 686
-#define PARAM_RESOLVE_OVERRIDE 687
-#define PARAM_RESOLVE_INST 688
-#define PARAM_RESOLVE 689
-#define PARAM_DB_WRITE 690
-#define MOD_PARM_DEALLOC 691
-#define INST_PARM_DEALLOC 692
-#define PARSE_READLINE 693
-#define PARSE_DESIGN 694
-#define PARSE_AND_SCORE_DUMPFILE 695
-#define PARSER_STATIC_EXPR_PRIMARY_A 696
-#define PARSER_STATIC_EXPR_PRIMARY_B 697
-#define PARSER_EXPRESSION_LIST_A 698
-#define PARSER_EXPRESSION_LIST_B 699
-#define PARSER_EXPRESSION_LIST_C 700
-#define PARSER_EXPRESSION_LIST_D 701
-#define PARSER_IDENTIFIER_A 702
-#define PARSER_GENERATE_CASE_ITEM_A 703
-#define PARSER_GENERATE_CASE_ITEM_B 704
-#define PARSER_GENERATE_CASE_ITEM_C 705
-#define PARSER_STATEMENT_BEGIN_A 706
-#define PARSER_STATEMENT_FORK_A 707
-#define PARSER_STATEMENT_FOR_A 708
-#define PARSER_CASE_ITEM_A 709
-#define PARSER_CASE_ITEM_B 710
-#define PARSER_CASE_ITEM_C 711
-#define PARSER_DELAY_VALUE_A 712
-#define PARSER_DELAY_VALUE_B 713
-#define PARSER_PARAMETER_VALUE_BYNAME_A 714
-#define PARSER_GATE_INSTANCE_A 715
-#define PARSER_GATE_INSTANCE_B 716
-#define PARSER_GATE_INSTANCE_C 717
-#define PARSER_GATE_INSTANCE_D 718
-#define PARSER_LIST_OF_NAMES_A 719
-#define PARSER_LIST_OF_NAMES_B 720
-#define PARSER_CHECK_PSTAR 721
-#define PARSER_CHECK_ATTRIBUTE 722
-#define PARSER_CREATE_ATTR_LIST 723
-#define PARSER_CREATE_ATTR 724
-#define PARSER_CREATE_TASK_DECL 725
-#define PARSER_CREATE_TASK_BODY 726
-#define PARSER_CREATE_FUNCTION_DECL 727
-#define PARSER_CREATE_FUNCTION_BODY 728
-#define PARSER_END_TASK_FUNCTION 729
-#define PARSER_CREATE_PORT 730
-#define PARSER_HANDLE_INLINE_PORT_ERROR 731
-#define PARSER_CREATE_SIMPLE_NUMBER 732
-#define PARSER_CREATE_COMPLEX_NUMBER 733
-#define PARSER_APPEND_SE_PORT_LIST 734
-#define PARSER_CREATE_SE_PORT_LIST 735
-#define PARSER_CREATE_UNARY_SE 736
-#define PARSER_CREATE_SYSCALL_SE 737
-#define PARSER_CREATE_UNARY_EXP 738
-#define PARSER_CREATE_BINARY_EXP 739
-#define PARSER_CREATE_OP_AND_ASSIGN_EXP 740
-#define PARSER_CREATE_SYSCALL_EXP 741
-#define PARSER_CREATE_SYSCALL_W_PARAMS_EXP 742
-#define PARSER_CREATE_OP_AND_ASSIGN_W_DIM_EXP 743
-#define PARSER_HANDLE_CASE_STATEMENT 744
-#define PARSER_HANDLE_CASE_STATEMENT_LIST 745
-#define PARSER_HANDLE_GENERATE_CASE_STATEMENT 746
-#define PARSER_HANDLE_GENERATE_CASE_STATEMENT_LIST 747
-#define VLERROR 748
-#define VLWARN 749
-#define PARSER_DEALLOC_SIG_RANGE 750
-#define PARSER_COPY_CURR_RANGE 751
-#define PARSER_COPY_RANGE_TO_CURR_RANGE 752
-#define PARSER_EXPLICITLY_SET_CURR_RANGE 753
-#define PARSER_IMPLICITLY_SET_CURR_RANGE 754
-#define PARSER_CHECK_GENERATION 755
-#define PERF_GEN_STATS 756
-#define PERF_OUTPUT_MOD_STATS 757
-#define PERF_OUTPUT_INST_REPORT_HELPER 758
-#define PERF_OUTPUT_INST_REPORT 759
-#define DEF_LOOKUP 760
-#define IS_DEFINED 761
-#define DEF_MATCH 762
-#define DEF_START 763
-#define DEFINE_MACRO 764
-#define DO_DEFINE 765
-#define DEF_IS_DONE 766
-#define DEF_FINISH 767
-#define DEF_UNDEFINE 768
-#define INCLUDE_FILENAME 769
-#define DO_INCLUDE 770
-#define YYWRAP 771
-#define RESET_PPLEXER 772
-#define RACE_BLK_CREATE 773
-#define RACE_FIND_HEAD_STATEMENT_CONTAINING_STATEMENT_HELPER 774
-#define RACE_FIND_HEAD_STATEMENT_CONTAINING_STATEMENT 775
-#define RACE_GET_HEAD_STATEMENT 776
-#define RACE_FIND_HEAD_STATEMENT 777
-#define RACE_CALC_STMT_BLK_TYPE 778
-#define RACE_CALC_EXPR_ASSIGNMENT 779
-#define RACE_CALC_ASSIGNMENTS 780
-#define RACE_HANDLE_RACE_CONDITION 781
-#define RACE_CHECK_ASSIGNMENT_TYPES 782
-#define RACE_CHECK_ONE_BLOCK_ASSIGNMENT 783
-#define RACE_CHECK_RACE_COUNT 784
-#define RACE_CHECK_MODULES 785
-#define RACE_DB_WRITE 786
-#define RACE_DB_READ 787
-#define RACE_GET_STATS 788
-#define RACE_REPORT_SUMMARY 789
-#define RACE_REPORT_VERBOSE 790
-#define RACE_REPORT 791
-#define RACE_COLLECT_LINES 792
-#define RACE_BLK_DELETE_LIST 793
-#define RANK_CREATE_COMP_CDD_COV 794
-#define RANK_DEALLOC_COMP_CDD_COV 795
-#define RANK_CHECK_INDEX 796
-#define RANK_GATHER_SIGNAL_COV 797
-#define RANK_GATHER_COMB_COV 798
-#define RANK_GATHER_EXPRESSION_COV 799
-#define RANK_GATHER_FSM_COV 800
-#define RANK_CALC_NUM_CPS 801
-#define RANK_GATHER_COMP_CDD_COV 802
-#define RANK_READ_CDD 803
-#define RANK_SELECTED_CDD_COV 804
-#define RANK_PERFORM_WEIGHTED_SELECTION 805
-#define RANK_PERFORM_GREEDY_SORT 806
-#define RANK_COUNT_CPS 807
-#define RANK_PERFORM 808
-#define RANK_OUTPUT 809
-#define COMMAND_RANK 810
-#define REENTRANT_COUNT_AFU_BITS 811
-#define REENTRANT_STORE_DATA_BITS 812
-#define REENTRANT_RESTORE_DATA_BITS 813
-#define REENTRANT_CREATE 814
-#define REENTRANT_DEALLOC 815
-#define REPORT_PARSE_METRICS 816
-#define REPORT_PARSE_ARGS 817
-#define REPORT_GATHER_INSTANCE_STATS 818
-#define REPORT_GATHER_FUNIT_STATS 819
-#define REPORT_PRINT_HEADER 820
-#define REPORT_GENERATE 821
-#define REPORT_READ_CDD_AND_READY 822
-#define REPORT_CLOSE_CDD 823
-#define REPORT_SAVE_CDD 824
-#define REPORT_FORMAT_EXCLUSION_REASON 825
-#define REPORT_OUTPUT_EXCLUSION_REASON 826
-#define COMMAND_REPORT 827
-#define SCOPE_FIND_FUNIT_FROM_SCOPE 828
-#define SCOPE_FIND_PARAM 829
-#define SCOPE_FIND_SIGNAL 830
-#define SCOPE_FIND_TASK_FUNCTION_NAMEDBLOCK 831
-#define SCOPE_GET_PARENT_FUNIT 832
-#define SCOPE_GET_PARENT_MODULE 833
-#define SCORE_GENERATE_TOP_VPI_MODULE 834
-#define SCORE_GENERATE_TOP_DUMPVARS_MODULE 835
-#define SCORE_GENERATE_PLI_TAB_FILE 836
-#define SCORE_PARSE_DEFINE 837
-#define SCORE_PARSE_METRICS 838
-#define SCORE_PARSE_ARGS 839
-#define COMMAND_SCORE 840
-#define SEARCH_INIT 841
-#define SEARCH_ADD_INCLUDE_PATH 842
-#define SEARCH_ADD_DIRECTORY_PATH 843
-#define SEARCH_ADD_FILE 844
-#define SEARCH_ADD_NO_SCORE_FUNIT 845
-#define SEARCH_ADD_EXTENSIONS 846
-#define SEARCH_FREE_LISTS 847
-#define SIM_CURRENT_THREAD 848
-#define SIM_THREAD_POP_HEAD 849
-#define SIM_THREAD_INSERT_INTO_DELAY_QUEUE 850
-#define SIM_THREAD_PUSH 851
-#define SIM_EXPR_CHANGED 852
-#define SIM_CREATE_THREAD 853
-#define SIM_ADD_THREAD 854
-#define SIM_KILL_THREAD 855
-#define SIM_KILL_THREAD_WITH_FUNIT 856
-#define SIM_ADD_STATICS 857
-#define SIM_EXPRESSION 858
-#define SIM_THREAD 859
-#define SIM_SIMULATE 860
-#define SIM_INITIALIZE 861
-#define SIM_STOP 862
-#define SIM_FINISH 863
-#define SIM_ADD_NONBLOCK_ASSIGN 864
-#define SIM_PERFORM_NBA 865
-#define SIM_DEALLOC 866
-#define STATISTIC_CREATE 867
-#define STATISTIC_IS_EMPTY 868
-#define STATISTIC_DEALLOC 869
-#define STATEMENT_CREATE 870
-#define STATEMENT_QUEUE_ADD 871
-#define STATEMENT_QUEUE_COMPARE 872
-#define STATEMENT_SIZE_ELEMENTS 873
-#define STATEMENT_DB_WRITE 874
-#define STATEMENT_DB_WRITE_TREE 875
-#define STATEMENT_DB_WRITE_EXPR_TREE 876
-#define STATEMENT_DB_READ 877
-#define STATEMENT_ASSIGN_EXPR_IDS 878
-#define STATEMENT_CONNECT 879
-#define STATEMENT_GET_LAST_LINE_HELPER 880
-#define STATEMENT_GET_LAST_LINE 881
-#define STATEMENT_FIND_RHS_SIGS 882
-#define STATEMENT_FIND_STATEMENT 883
-#define STATEMENT_FIND_STATEMENT_BY_POSITION 884
-#define STATEMENT_CONTAINS_EXPR_CALLING_STMT 885
-#define STATEMENT_ADD_TO_STMT_LINK 886
-#define STATEMENT_DEALLOC_RECURSIVE 887
-#define STATEMENT_DEALLOC 888
-#define STATIC_EXPR_GEN_UNARY 889
-#define STATIC_EXPR_GEN 890
-#define STATIC_EXPR_GEN_TERNARY 891
-#define STATIC_EXPR_CALC_LSB_AND_WIDTH_PRE 892
-#define STATIC_EXPR_CALC_LSB_AND_WIDTH_POST 893
-#define STATIC_EXPR_DEALLOC 894
-#define STMT_BLK_ADD_TO_REMOVE_LIST 895
-#define STMT_BLK_REMOVE 896
-#define STMT_BLK_SPECIFY_REMOVAL_REASON 897
-#define STRUCT_UNION_LENGTH 898
-#define STRUCT_UNION_ADD_MEMBER 899
-#define STRUCT_UNION_ADD_MEMBER_VOID 900
-#define STRUCT_UNION_ADD_MEMBER_SIG 901
-#define STRUCT_UNION_ADD_MEMBER_TYPEDEF 902
-#define STRUCT_UNION_ADD_MEMBER_ENUM 903
-#define STRUCT_UNION_ADD_MEMBER_STRUCT_UNION 904
-#define STRUCT_UNION_CREATE 905
-#define STRUCT_UNION_MEMBER_DEALLOC 906
-#define STRUCT_UNION_DEALLOC 907
-#define STRUCT_UNION_DEALLOC_LIST 908
-#define SYMTABLE_ADD_SYM_SIG 909
-#define SYMTABLE_ADD_SYM_EXP 910
-#define SYMTABLE_ADD_SYM_FSM 911
-#define SYMTABLE_INIT 912
-#define SYMTABLE_CREATE 913
-#define SYMTABLE_GET_TABLE 914
-#define SYMTABLE_ADD_SIGNAL 915
-#define SYMTABLE_ADD_EXPRESSION 916
-#define SYMTABLE_ADD_MEMORY 917
-#define SYMTABLE_ADD_FSM 918
-#define SYMTABLE_SET_VALUE 919
-#define SYMTABLE_ASSIGN 920
-#define SYMTABLE_DEALLOC 921
-#define SYS_TASK_UNIFORM 922
-#define SYS_TASK_RTL_DIST_UNIFORM 923
-#define SYS_TASK_SRANDOM 924
-#define SYS_TASK_RANDOM 925
-#define SYS_TASK_URANDOM 926
-#define SYS_TASK_URANDOM_RANGE 927
-#define SYS_TASK_REALTOBITS 928
-#define SYS_TASK_BITSTOREAL 929
-#define SYS_TASK_SHORTREALTOBITS 930
-#define SYS_TASK_BITSTOSHORTREAL 931
-#define SYS_TASK_ITOR 932
-#define SYS_TASK_RTOI 933
-#define SYS_TASK_STORE_PLUSARGS 934
-#define SYS_TASK_TEST_PLUSARG 935
-#define SYS_TASK_VALUE_PLUSARGS 936
-#define SYS_TASK_DEALLOC 937
-#define TCL_FUNC_GET_RACE_REASON_MSGS 938
-#define TCL_FUNC_GET_FUNIT_LIST 939
-#define TCL_FUNC_GET_INSTANCES 940
-#define TCL_FUNC_GET_INSTANCE_LIST 941
-#define TCL_FUNC_IS_FUNIT 942
-#define TCL_FUNC_GET_FUNIT 943
-#define TCL_FUNC_GET_INST 944
-#define TCL_FUNC_GET_FUNIT_NAME 945
-#define TCL_FUNC_GET_FILENAME 946
-#define TCL_FUNC_INST_SCOPE 947
-#define TCL_FUNC_GET_FUNIT_START_AND_END 948
-#define TCL_FUNC_COLLECT_UNCOVERED_LINES 949
-#define TCL_FUNC_COLLECT_COVERED_LINES 950
-#define TCL_FUNC_COLLECT_RACE_LINES 951
-#define TCL_FUNC_COLLECT_UNCOVERED_TOGGLES 952
-#define TCL_FUNC_COLLECT_COVERED_TOGGLES 953
-#define TCL_FUNC_COLLECT_UNCOVERED_MEMORIES 954
-#define TCL_FUNC_COLLECT_COVERED_MEMORIES 955
-#define TCL_FUNC_GET_TOGGLE_COVERAGE 956
-#define TCL_FUNC_GET_MEMORY_COVERAGE 957
-#define TCL_FUNC_COLLECT_UNCOVERED_COMBS 958
-#define TCL_FUNC_COLLECT_COVERED_COMBS 959
-#define TCL_FUNC_GET_COMB_EXPRESSION 960
-#define TCL_FUNC_GET_COMB_COVERAGE 961
-#define TCL_FUNC_COLLECT_UNCOVERED_FSMS 962
-#define TCL_FUNC_COLLECT_COVERED_FSMS 963
-#define TCL_FUNC_GET_FSM_COVERAGE 964
-#define TCL_FUNC_COLLECT_UNCOVERED_ASSERTIONS 965
-#define TCL_FUNC_COLLECT_COVERED_ASSERTIONS 966
-#define TCL_FUNC_GET_ASSERT_COVERAGE 967
-#define TCL_FUNC_OPEN_CDD 968
-#define TCL_FUNC_CLOSE_CDD 969
-#define TCL_FUNC_SAVE_CDD 970
-#define TCL_FUNC_MERGE_CDD 971
-#define TCL_FUNC_GET_LINE_SUMMARY 972
-#define TCL_FUNC_GET_TOGGLE_SUMMARY 973
-#define TCL_FUNC_GET_MEMORY_SUMMARY 974
-#define TCL_FUNC_GET_COMB_SUMMARY 975
-#define TCL_FUNC_GET_FSM_SUMMARY 976
-#define TCL_FUNC_GET_ASSERT_SUMMARY 977
-#define TCL_FUNC_PREPROCESS_VERILOG 978
-#define TCL_FUNC_GET_SCORE_PATH 979
-#define TCL_FUNC_GET_INCLUDE_PATHNAME 980
-#define TCL_FUNC_GET_GENERATION 981
-#define TCL_FUNC_SET_LINE_EXCLUDE 982
-#define TCL_FUNC_SET_TOGGLE_EXCLUDE 983
-#define TCL_FUNC_SET_MEMORY_EXCLUDE 984
-#define TCL_FUNC_SET_COMB_EXCLUDE 985
-#define TCL_FUNC_FSM_EXCLUDE 986
-#define TCL_FUNC_SET_ASSERT_EXCLUDE 987
-#define TCL_FUNC_GENERATE_REPORT 988
-#define TCL_FUNC_INITIALIZE 989
-#define TOGGLE_GET_STATS 990
-#define TOGGLE_COLLECT 991
-#define TOGGLE_GET_COVERAGE 992
-#define TOGGLE_GET_FUNIT_SUMMARY 993
-#define TOGGLE_GET_INST_SUMMARY 994
-#define TOGGLE_DISPLAY_INSTANCE_SUMMARY 995
-#define TOGGLE_INSTANCE_SUMMARY 996
-#define TOGGLE_DISPLAY_FUNIT_SUMMARY 997
-#define TOGGLE_FUNIT_SUMMARY 998
-#define TOGGLE_DISPLAY_VERBOSE 999
-#define TOGGLE_INSTANCE_VERBOSE 1000
-#define TOGGLE_FUNIT_VERBOSE 1001
-#define TOGGLE_REPORT 1002
-#define TREE_ADD 1003
-#define TREE_FIND 1004
-#define TREE_REMOVE 1005
-#define TREE_DEALLOC 1006
-#define CHECK_OPTION_VALUE 1007
-#define IS_VARIABLE 1008
-#define IS_FUNC_UNIT 1009
-#define IS_LEGAL_FILENAME 1010
-#define GET_BASENAME 1011
-#define GET_DIRNAME 1012
-#define GET_ABSOLUTE_PATH 1013
-#define GET_RELATIVE_PATH 1014
-#define DIRECTORY_EXISTS 1015
-#define DIRECTORY_LOAD 1016
-#define FILE_EXISTS 1017
-#define UTIL_READLINE 1018
-#define GET_QUOTED_STRING 1019
-#define SUBSTITUTE_ENV_VARS 1020
-#define SCOPE_EXTRACT_FRONT 1021
-#define SCOPE_EXTRACT_BACK 1022
-#define SCOPE_EXTRACT_SCOPE 1023
-#define SCOPE_GEN_PRINTABLE 1024
-#define SCOPE_COMPARE 1025
-#define SCOPE_LOCAL 1026
-#define CONVERT_FILE_TO_MODULE 1027
-#define GET_NEXT_VFILE 1028
-#define GEN_SPACE 1029
-#define REMOVE_UNDERSCORES 1030
-#define GET_FUNIT_TYPE 1031
-#define CALC_MISS_PERCENT 1032
-#define READ_COMMAND_FILE 1033
-#define CONVERT_STR_TO_UINT64 1034
-#define CONVERT_INT_TO_STR 1035
-#define CALC_NUM_BITS_TO_STORE 1036
-#define VCD_CALC_INDEX 1037
-#define VCD_GETCH_FETCH 1038
-#define VCD_GET_TOKEN 1039
-#define VCD_SYNC_END 1040
-#define VCD_PARSE_DEF_VAR 1041
-#define VCD_PARSE_DEF 1042
-#define VCD_PARSE_SIM_VECTOR 1043
-#define VCD_PARSE_SIM_REAL 1044
-#define VCD_PARSE_SIM 1045
-#define VCD_PARSE 1046
-#define VECTOR_INIT_ULONG 1047
-#define VECTOR_INT_R64 1048
-#define VECTOR_INT_R32 1049
-#define VECTOR_CREATE 1050
-#define VECTOR_COPY 1051
-#define VECTOR_COPY_RANGE 1052
-#define VECTOR_CLONE 1053
-#define VECTOR_DB_WRITE 1054
-#define VECTOR_DB_READ 1055
-#define VECTOR_DB_MERGE 1056
-#define VECTOR_MERGE 1057
-#define VECTOR_GET_EVAL_A 1058
-#define VECTOR_GET_EVAL_B 1059
-#define VECTOR_GET_EVAL_C 1060
-#define VECTOR_GET_EVAL_D 1061
-#define VECTOR_GET_EVAL_AB_COUNT 1062
-#define VECTOR_GET_EVAL_ABC_COUNT 1063
-#define VECTOR_GET_EVAL_ABCD_COUNT 1064
-#define VECTOR_GET_TOGGLE01_ULONG 1065
-#define VECTOR_GET_TOGGLE10_ULONG 1066
-#define VECTOR_DISPLAY_TOGGLE01_ULONG 1067
-#define VECTOR_DISPLAY_TOGGLE10_ULONG 1068
-#define VECTOR_TOGGLE_COUNT 1069
-#define VECTOR_MEM_RW_COUNT 1070
-#define VECTOR_SET_ASSIGNED 1071
-#define VECTOR_SET_COVERAGE_AND_ASSIGN 1072
-#define VECTOR_GET_SIGN_EXTEND_VECTOR_ULONG 1073
-#define VECTOR_SIGN_EXTEND_ULONG 1074
-#define VECTOR_LSHIFT_ULONG 1075
-#define VECTOR_RSHIFT_ULONG 1076
-#define VECTOR_SET_VALUE 1077
-#define VECTOR_SET_MEM_RD 1078
-#define VECTOR_PART_SELECT_PULL 1079
-#define VECTOR_PART_SELECT_PUSH 1080
-#define VECTOR_SET_UNARY_EVALS 1081
-#define VECTOR_SET_AND_COMB_EVALS 1082
-#define VECTOR_SET_OR_COMB_EVALS 1083
-#define VECTOR_SET_OTHER_COMB_EVALS 1084
-#define VECTOR_IS_UKNOWN 1085
-#define VECTOR_IS_NOT_ZERO 1086
-#define VECTOR_SET_TO_X 1087
-#define VECTOR_TO_INT 1088
-#define VECTOR_TO_UINT64 1089
-#define VECTOR_TO_REAL64 1090
-#define VECTOR_TO_SIM_TIME 1091
-#define VECTOR_FROM_INT 1092
-#define VECTOR_FROM_UINT64 1093
-#define VECTOR_FROM_REAL64 1094
-#define VECTOR_SET_STATIC 1095
-#define VECTOR_TO_STRING 1096
-#define VECTOR_FROM_STRING_FIXED 1097
-#define VECTOR_FROM_STRING 1098
-#define VECTOR_VCD_ASSIGN 1099
-#define VECTOR_VCD_ASSIGN2 1100
-#define VECTOR_BITWISE_AND_OP 1101
-#define VECTOR_BITWISE_NAND_OP 1102
-#define VECTOR_BITWISE_OR_OP 1103
-#define VECTOR_BITWISE_NOR_OP 1104
-#define VECTOR_BITWISE_XOR_OP 1105
-#define VECTOR_BITWISE_NXOR_OP 1106
-#define VECTOR_OP_LT 1107
-#define VECTOR_OP_LE 1108
-#define VECTOR_OP_GT 1109
-#define VECTOR_OP_GE 1110
-#define VECTOR_OP_EQ 1111
-#define VECTOR_CEQ_ULONG 1112
-#define VECTOR_OP_CEQ 1113
-#define VECTOR_OP_CXEQ 1114
-#define VECTOR_OP_CZEQ 1115
-#define VECTOR_OP_NE 1116
-#define VECTOR_OP_CNE 1117
-#define VECTOR_OP_LOR 1118
-#define VECTOR_OP_LAND 1119
-#define VECTOR_OP_LSHIFT 1120
-#define VECTOR_OP_RSHIFT 1121
-#define VECTOR_OP_ARSHIFT 1122
-#define VECTOR_OP_ADD 1123
-#define VECTOR_OP_NEGATE 1124
-#define VECTOR_OP_SUBTRACT 1125
-#define VECTOR_OP_MULTIPLY 1126
-#define VECTOR_OP_DIVIDE 1127
-#define VECTOR_OP_MODULUS 1128
-#define VECTOR_OP_INC 1129
-#define VECTOR_OP_DEC 1130
-#define VECTOR_UNARY_INV 1131
-#define VECTOR_UNARY_AND 1132
-#define VECTOR_UNARY_NAND 1133
-#define VECTOR_UNARY_OR 1134
-#define VECTOR_UNARY_NOR 1135
-#define VECTOR_UNARY_XOR 1136
-#define VECTOR_UNARY_NXOR 1137
-#define VECTOR_UNARY_NOT 1138
-#define VECTOR_OP_EXPAND 1139
-#define VECTOR_OP_LIST 1140
-#define VECTOR_OP_CLOG2 1141
-#define VECTOR_DEALLOC_VALUE 1142
-#define VECTOR_DEALLOC 1143
-#define SYM_VALUE_STORE 1144
-#define ADD_SYM_VALUES_TO_SIM 1145
-#define COVERED_ROSYNCH 1146
-#define COVERED_VALUE_CHANGE_BIN 1147
-#define COVERED_VALUE_CHANGE_REAL 1148
-#define COVERED_END_OF_SIM 1149
-#define COVERED_CB_ERROR_HANDLER 1150
-#define GEN_NEXT_SYMBOL 1151
-#define COVERED_CREATE_VALUE_CHANGE_CB 1152
-#define COVERED_PARSE_TASK_FUNC 1153
-#define COVERED_PARSE_SIGNALS 1154
-#define COVERED_PARSE_INSTANCE 1155
-#define COVERED_SIM_CALLTF 1156
-#define COVERED_REGISTER 1157
-#define VSIGNAL_INIT 1158
-#define VSIGNAL_CREATE 1159
-#define VSIGNAL_CREATE_VEC 1160
-#define VSIGNAL_DUPLICATE 1161
-#define VSIGNAL_DB_WRITE 1162
-#define VSIGNAL_DB_READ 1163
-#define VSIGNAL_DB_MERGE 1164
-#define VSIGNAL_MERGE 1165
-#define VSIGNAL_PROPAGATE 1166
-#define VSIGNAL_VCD_ASSIGN 1167
-#define VSIGNAL_ADD_EXPRESSION 1168
-#define VSIGNAL_FROM_STRING 1169
-#define VSIGNAL_CALC_WIDTH_FOR_EXPR 1170
-#define VSIGNAL_CALC_LSB_FOR_EXPR 1171
-#define VSIGNAL_DEALLOC 1172
+#define BIND_ADD_INDEXED 37
+#define BIND_APPEND_FSM_EXPR 38
+#define BIND_REMOVE 39
+#define BIND_FIND_SIG_NAME 40
+#define BIND_PARAM 41
+#define BIND_SIGNAL 42
+#define BIND_SIGNAL_LINK 43
+#define BIND_FIND_INDEXED_SIGNAL 44
+#define BIND_TASK_FUNCTION_PORTS 45
+#define BIND_TASK_FUNCTION_NAMEDBLOCK 46
+#define BIND_PERFORM 47
+#define BIND_DEALLOC 48
+#define CODEGEN_CREATE_EXPR_HELPER 49
+#define CODEGEN_ADOPT 50
+#define CODEGEN_EXPORT 51
+#define CODEGEN_CREATE_EXPR 52
+#define CODEGEN_GEN_EXPR1 53
+#define CODEGEN_GEN_EXPR 54
+#define CODEGEN_GEN_EXPR_ONE_LINE 55
+#define CODEGEN_DEALLOC 56
+#define COMBINATION_CALC_DEPTH 57
+#define COMBINATION_DOES_MULTI_EXP_NEED_UL 58
+#define COMBINATION_MULTI_EXPR_CALC 59
+#define COMBINATION_IS_EXPR_MULTI_NODE 60
+#define COMBINATION_GET_TREE_STATS 61
+#define COMBINATION_RESET_COUNTED_EXPRS 62
+#define COMBINATION_RESET_COUNTED_EXPR_TREE 63
+#define COMBINATION_GET_STATS 64
+#define COMBINATION_COPY_TREE_ULIDS 65
+#define COMBINATION_COPY_ULIDS 66
+#define COMBINATION_WRITE_ULIDS 67
+#define COMBINATION_READ_ULIDS 68
+#define COMBINATION_GET_FUNIT_SUMMARY 69
+#define COMBINATION_GET_INST_SUMMARY 70
+#define COMBINATION_DISPLAY_INSTANCE_SUMMARY 71
+#define COMBINATION_INSTANCE_SUMMARY 72
+#define COMBINATION_DISPLAY_FUNIT_SUMMARY 73
+#define COMBINATION_FUNIT_SUMMARY 74
+#define COMBINATION_DRAW_LINE 75
+#define COMBINATION_DRAW_CENTERED_LINE 76
+#define COMBINATION_PARENTHESIZE 77
+#define COMBINATION_UNDERLINE_TREE 78
+#define COMBINATION_PREP_LINE 79
+#define COMBINATION_UNDERLINE 80
+#define COMBINATION_GEN_CODE 81
+#define COMBINATION_DEALLOC_CACHES 82
+#define COMBINATION_UNARY 83
+#define COMBINATION_EVENT 84
+#define COMBINATION_TWO_VARS 85
+#define COMBINATION_MULTI_VAR_EXPRS 86
+#define COMBINATION_MULTI_EXPR_OUTPUT_LENGTH 87
+#define COMBINATION_MULTI_EXPR_OUTPUT 88
+#define COMBINATION_MULTI_VARS 89
+#define COMBINATION_GET_MISSED_EXPR 90
+#define COMBINATION_LIST_MISSED 91
+#define COMBINATION_OUTPUT_EXPR 92
+#define COMBINATION_DISPLAY_VERBOSE 93
+#define COMBINATION_INSTANCE_VERBOSE 94
+#define COMBINATION_FUNIT_VERBOSE 95
+#define COMBINATION_COLLECT 96
+#define COMBINATION_GET_EXCLUDE_LIST 97
+#define COMBINATION_GET_EXPRESSION 98
+#define COMBINATION_GET_COVERAGE 99
+#define COMBINATION_REPORT 100
+#define DB_CREATE 101
+#define DB_CLOSE 102
+#define DB_CHECK_FOR_TOP_MODULE 103
+#define DB_WRITE 104
+#define DB_READ 105
+#define DB_ASSIGN_IDS 106
+#define DB_MERGE_INSTANCE_TREES 107
+#define DB_MERGE_FUNITS 108
+#define DB_SCALE_TO_PRECISION 109
+#define DB_CREATE_UNNAMED_SCOPE 110
+#define DB_IS_UNNAMED_SCOPE 111
+#define DB_SET_TIMESCALE 112
+#define DB_FIND_AND_SET_CURR_FUNIT 113
+#define DB_GET_CURR_FUNIT 114
+#define DB_GET_FUNIT_BY_POSITION 115
+#define DB_GET_EXCLUSION_ID_SIZE 116
+#define DB_GEN_EXCLUSION_ID 117
+#define DB_ADD_FILE_VERSION 118
+#define DB_OUTPUT_DUMPVARS 119
+#define DB_ADD_INSTANCE 120
+#define DB_ADD_MODULE 121
+#define DB_END_MODULE 122
+#define DB_ADD_FUNCTION_TASK_NAMEDBLOCK 123
+#define DB_END_FUNCTION_TASK_NAMEDBLOCK 124
+#define DB_ADD_DECLARED_PARAM 125
+#define DB_ADD_OVERRIDE_PARAM 126
+#define DB_ADD_VECTOR_PARAM 127
+#define DB_ADD_DEFPARAM 128
+#define DB_ADD_SIGNAL 129
+#define DB_ADD_ENUM 130
+#define DB_END_ENUM_LIST 131
+#define DB_ADD_TYPEDEF 132
+#define DB_FIND_SIGNAL 133
+#define DB_ADD_GEN_ITEM_BLOCK 134
+#define DB_FIND_GEN_ITEM 135
+#define DB_FIND_TYPEDEF 136
+#define DB_GET_CURR_GEN_BLOCK 137
+#define DB_CURR_SIGNAL_COUNT 138
+#define DB_CREATE_EXPRESSION 139
+#define DB_BIND_EXPR_TREE 140
+#define DB_CREATE_EXPR_FROM_STATIC 141
+#define DB_ADD_EXPRESSION 142
+#define DB_CREATE_SENSITIVITY_LIST 143
+#define DB_PARALLELIZE_STATEMENT 144
+#define DB_CREATE_STATEMENT 145
+#define DB_ADD_STATEMENT 146
+#define DB_REMOVE_STATEMENT_FROM_CURRENT_FUNIT 147
+#define DB_REMOVE_STATEMENT 148
+#define DB_CONNECT_STATEMENT_TRUE 149
+#define DB_CONNECT_STATEMENT_FALSE 150
+#define DB_GEN_ITEM_CONNECT_TRUE 151
+#define DB_GEN_ITEM_CONNECT_FALSE 152
+#define DB_GEN_ITEM_CONNECT 153
+#define DB_STATEMENT_CONNECT 154
+#define DB_CREATE_ATTR_PARAM 155
+#define DB_PARSE_ATTRIBUTE 156
+#define DB_REMOVE_STMT_BLKS_CALLING_STATEMENT 157
+#define DB_GEN_CURR_INST_SCOPE 158
+#define DB_SYNC_CURR_INSTANCE 159
+#define DB_SET_VCD_SCOPE 160
+#define DB_VCD_SCOPE_INDEX_DEALLOC 161
+#define DB_VCD_UPSCOPE 162
+#define DB_ASSIGN_SYMBOL 163
+#define DB_SET_SYMBOL_CHAR 164
+#define DB_SET_SYMBOL_STRING 165
+#define DB_DO_TIMESTEP 166
+#define DB_CHECK_DUMPFILE_SCOPES 167
+#define DB_VERILATOR_INITIALIZE 168
+#define DB_VERILATOR_CLOSE 169
+#define DB_ADD_LINE_COVERAGE 170
+#define ENUMERATE_ADD_ITEM 171
+#define ENUMERATE_END_LIST 172
+#define ENUMERATE_RESOLVE 173
+#define ENUMERATE_DEALLOC 174
+#define ENUMERATE_DEALLOC_LIST 175
+#define EXCLUDE_EXPR_ASSIGN_AND_RECALC 176
+#define EXCLUDE_SIG_ASSIGN_AND_RECALC 177
+#define EXCLUDE_ARC_ASSIGN_AND_RECALC 178
+#define EXCLUDE_CLEAR_STORED_STATS 179
+#define EXCLUDE_ADD_EXCLUDE_REASON 180
+#define EXCLUDE_REMOVE_EXCLUDE_REASON 181
+#define EXCLUDE_IS_LINE_EXCLUDED 182
+#define EXCLUDE_SET_LINE_EXCLUDE 183
+#define EXCLUDE_IS_TOGGLE_EXCLUDED 184
+#define EXCLUDE_SET_TOGGLE_EXCLUDE 185
+#define EXCLUDE_IS_COMB_EXCLUDED 186
+#define EXCLUDE_SET_COMB_EXCLUDE 187
+#define EXCLUDE_IS_FSM_EXCLUDED 188
+#define EXCLUDE_SET_FSM_EXCLUDE 189
+#define EXCLUDE_IS_ASSERT_EXCLUDED 190
+#define EXCLUDE_SET_ASSERT_EXCLUDE 191
+#define EXCLUDE_FIND_EXCLUDE_REASON 192
+#define EXCLUDE_DB_WRITE 193
+#define EXCLUDE_DB_READ 194
+#define EXCLUDE_RESOLVE_REASON 195
+#define EXCLUDE_DB_MERGE 196
+#define EXCLUDE_MERGE 197
+#define EXCLUDE_FIND_SIGNAL 198
+#define EXCLUDE_INDEX_ADD 199
+#define EXCLUDE_INDEX_ADD_INSTANCE 200
+#define EXCLUDE_INDEX_DEALLOC 201
+#define EXCLUDE_INDEX_BUILD 202
+#define EXCLUDE_READ_BATCH_FILE 203
+#define EXCLUDE_FIND_EXPRESSION 204
+#define EXCLUDE_FIND_FSM_ARC 205
+#define EXCLUDE_FORMAT_REASON 206
+#define EXCLUDED_GET_MESSAGE 207
+#define EXCLUDE_HANDLE_EXCLUDE_REASON 208
+#define EXCLUDE_PRINT_EXCLUSION 209
+#define EXCLUDE_LINE_FROM_ID 210
+#define EXCLUDE_TOGGLE_FROM_ID 211
+#define EXCLUDE_MEMORY_FROM_ID 212
+#define EXCLUDE_EXPR_FROM_ID 213
+#define EXCLUDE_FSM_FROM_ID 214
+#define EXCLUDE_ASSERT_FROM_ID 215
+#define EXCLUDE_APPLY_EXCLUSIONS 216
+#define COMMAND_EXCLUDE 217
+#define COMMAND_SERVE 218
+#define SERVE_APPENDF 219
+#define SERVE_LIST_INSTANCES 220
+#define SERVE_FIND_FUNIT 221
+#define SERVE_SUMMARY 222
+#define SERVE_COLLECT 223
+#define SERVE_PARSE_INT 224
+#define SERVE_FIND_SIGNAL 225
+#define SERVE_FIND_STATEMENT 226
+#define SERVE_FIND_ASSERTION 227
+#define SERVE_FSM_COVERAGE 228
+#define SERVE_DETAIL 229
+#define SERVE_APPEND_EXCLUSION 230
+#define SERVE_EXCLUDED 231
+#define SERVE_RSP_DEALLOC 232
+#define SERVE_PROCESS_REQUEST 233
+#define SERVE_WRITE_RSP 234
+#define SERVE_QUEUE 235
+#define SERVE_WRITE 236
+#define SERVE_CLOSE_CLIENT 237
+#define SERVE_HANDLE_CLIENT 238
+#define SERVE_RUN 239
+#define EXPRESSION_CREATE_TMP_VECS 240
+#define EXPRESSION_CREATE_NBA 241
+#define EXPRESSION_IS_NBA_LHS 242
+#define EXPRESSION_CREATE_VALUE 243
+#define EXPRESSION_CREATE 244
+#define EXPRESSION_SET_VALUE 245
+#define EXPRESSION_SET_SIGNED 246
+#define EXPRESSION_RESIZE 247
+#define EXPRESSION_GET_ID 248
+#define EXPRESSION_GET_FIRST_LINE_EXPR 249
+#define EXPRESSION_GET_LAST_LINE_EXPR 250
+#define EXPRESSION_GET_CURR_DIMENSION 251
+#define EXPRESSION_FIND_RHS_SIGS 252
+#define EXPRESSION_FIND_PARAMS 253
+#define EXPRESSION_FIND_ULINE_ID 254
+#define EXPRESSION_FIND_EXPR 255
+#define EXPRESSION_CONTAINS_EXPR_CALLING_STMT 256
+#define EXPRESSION_GET_ROOT_STATEMENT 257
+#define EXPRESSION_ASSIGN_EXPR_IDS 258
+#define EXPRESSION_DB_WRITE 259
+#define EXPRESSION_DB_WRITE_TREE 260
+#define EXPRESSION_DB_READ 261
+#define EXPRESSION_DB_MERGE 262
+#define EXPRESSION_DB_MERGE_COVERAGE 263
+#define EXPRESSION_MERGE 264
+#define EXPRESSION_STRING_OP 265
+#define EXPRESSION_STRING 266
+#define EXPRESSION_OP_FUNC__XOR 267
+#define EXPRESSION_OP_FUNC__XOR_A 268
+#define EXPRESSION_OP_FUNC__MULTIPLY 269
+#define EXPRESSION_OP_FUNC__MULTIPLY_A 270
+#define EXPRESSION_OP_FUNC__DIVIDE 271
+#define EXPRESSION_OP_FUNC__DIVIDE_A 272
+#define EXPRESSION_OP_FUNC__MOD 273
+#define EXPRESSION_OP_FUNC__MOD_A 274
+#define EXPRESSION_OP_FUNC__ADD 275
+#define EXPRESSION_OP_FUNC__ADD_A 276
+#define EXPRESSION_OP_FUNC__SUBTRACT 277
+#define EXPRESSION_OP_FUNC__SUB_A 278
+#define EXPRESSION_OP_FUNC__AND 279
+#define EXPRESSION_OP_FUNC__AND_A 280
+#define EXPRESSION_OP_FUNC__OR 281
+#define EXPRESSION_OP_FUNC__OR_A 282
+#define EXPRESSION_OP_FUNC__NAND 283
+#define EXPRESSION_OP_FUNC__NOR 284
+#define EXPRESSION_OP_FUNC__NXOR 285
+#define EXPRESSION_OP_FUNC__LT 286
+#define EXPRESSION_OP_FUNC__GT 287
+#define EXPRESSION_OP_FUNC__LSHIFT 288
+#define EXPRESSION_OP_FUNC__LSHIFT_A 289
+#define EXPRESSION_OP_FUNC__RSHIFT 290
+#define EXPRESSION_OP_FUNC__RSHIFT_A 291
+#define EXPRESSION_OP_FUNC__ARSHIFT 292
+#define EXPRESSION_OP_FUNC__ARSHIFT_A 293
+#define EXPRESSION_OP_FUNC__TIME 294
+#define EXPRESSION_OP_FUNC__RANDOM 295
+#define EXPRESSION_OP_FUNC__SASSIGN 296
+#define EXPRESSION_OP_FUNC__SRANDOM 297
+#define EXPRESSION_OP_FUNC__URANDOM 298
+#define EXPRESSION_OP_FUNC__URANDOM_RANGE 299
+#define EXPRESSION_OP_FUNC__REALTOBITS 300
+#define EXPRESSION_OP_FUNC__BITSTOREAL 301
+#define EXPRESSION_OP_FUNC__SHORTREALTOBITS 302
+#define EXPRESSION_OP_FUNC__BITSTOSHORTREAL 303
+#define EXPRESSION_OP_FUNC__ITOR 304
+#define EXPRESSION_OP_FUNC__RTOI 305
+#define EXPRESSION_OP_FUNC__TEST_PLUSARGS 306
+#define EXPRESSION_OP_FUNC__VALUE_PLUSARGS 307
+#define EXPRESSION_OP_FUNC__SIGNED 308
+#define EXPRESSION_OP_FUNC__UNSIGNED 309
+#define EXPRESSION_OP_FUNC__CLOG2 310
+#define EXPRESSION_OP_FUNC__EQ 311
+#define EXPRESSION_OP_FUNC__CEQ 312
+#define EXPRESSION_OP_FUNC__LE 313
+#define EXPRESSION_OP_FUNC__GE 314
+#define EXPRESSION_OP_FUNC__NE 315
+#define EXPRESSION_OP_FUNC__CNE 316
+#define EXPRESSION_OP_FUNC__LOR 317
+#define EXPRESSION_OP_FUNC__LAND 318
+#define EXPRESSION_OP_FUNC__COND 319
+#define EXPRESSION_OP_FUNC__COND_SEL 320
+#define EXPRESSION_OP_FUNC__UINV 321
+#define EXPRESSION_OP_FUNC__UAND 322
+#define EXPRESSION_OP_FUNC__UNOT 323
+#define EXPRESSION_OP_FUNC__UOR 324
+#define EXPRESSION_OP_FUNC__UXOR 325
+#define EXPRESSION_OP_FUNC__UNAND 326
+#define EXPRESSION_OP_FUNC__UNOR 327
+#define EXPRESSION_OP_FUNC__UNXOR 328
+#define EXPRESSION_OP_FUNC__NULL 329
+#define EXPRESSION_OP_FUNC__SIG 330
+#define EXPRESSION_OP_FUNC__SBIT 331
+#define EXPRESSION_OP_FUNC__MBIT 332
+#define EXPRESSION_OP_FUNC__EXPAND 333
+#define EXPRESSION_OP_FUNC__LIST 334
+#define EXPRESSION_OP_FUNC__CONCAT 335
+#define EXPRESSION_OP_FUNC__PEDGE 336
+#define EXPRESSION_OP_FUNC__NEDGE 337
+#define EXPRESSION_OP_FUNC__AEDGE 338
+#define EXPRESSION_OP_FUNC__EOR 339
+#define EXPRESSION_OP_FUNC__SLIST 340
+#define EXPRESSION_OP_FUNC__DELAY 341
+#define EXPRESSION_OP_FUNC__TRIGGER 342
+#define EXPRESSION_OP_FUNC__CASE 343
+#define EXPRESSION_OP_FUNC__CASEX 344
+#define EXPRESSION_OP_FUNC__CASEZ 345
+#define EXPRESSION_OP_FUNC__DEFAULT 346
+#define EXPRESSION_OP_FUNC__BASSIGN 347
+#define EXPRESSION_OP_FUNC__FUNC_CALL 348
+#define EXPRESSION_OP_FUNC__TASK_CALL 349
+#define EXPRESSION_OP_FUNC__NB_CALL 350
+#define EXPRESSION_OP_FUNC__FORK 351
+#define EXPRESSION_OP_FUNC__JOIN 352
+#define EXPRESSION_OP_FUNC__DISABLE 353
+#define EXPRESSION_OP_FUNC__REPEAT 354
+#define EXPRESSION_OP_FUNC__EXPONENT 355
+#define EXPRESSION_OP_FUNC__PASSIGN 356
+#define EXPRESSION_OP_FUNC__MBIT_POS 357
+#define EXPRESSION_OP_FUNC__MBIT_NEG 358
+#define EXPRESSION_OP_FUNC__NEGATE 359
+#define EXPRESSION_OP_FUNC__IINC 360
+#define EXPRESSION_OP_FUNC__PINC 361
+#define EXPRESSION_OP_FUNC__IDEC 362
+#define EXPRESSION_OP_FUNC__PDEC 363
+#define EXPRESSION_OP_FUNC__DLY_ASSIGN 364
+#define EXPRESSION_OP_FUNC__DLY_OP 365
+#define EXPRESSION_OP_FUNC__REPEAT_DLY 366
+#define EXPRESSION_OP_FUNC__DIM 367
+#define EXPRESSION_OP_FUNC__WAIT 368
+#define EXPRESSION_OP_FUNC__FINISH 369
+#define EXPRESSION_OP_FUNC__STOP 370
+#define EXPRESSION_OPERATE 371
+#define EXPRESSION_OPERATE_RECURSIVELY 372
+#define EXPRESSION_SET_LINE_COVERAGE 373
+#define EXPRESSION_VCD_ASSIGN 374
+#define EXPRESSION_IS_STATIC_ONLY_HELPER 375
+#define EXPRESSION_IS_ASSIGNED 376
+#define EXPRESSION_IS_BIT_SELECT 377
+#define EXPRESSION_IS_LAST_SELECT 378
+#define EXPRESSION_GET_FIRST_SELECT 379
+#define EXPRESSION_IS_IN_RASSIGN 380
+#define EXPRESSION_SET_ASSIGNED 381
+#define EXPRESSION_SET_CHANGED 382
+#define EXPRESSION_ASSIGN 383
+#define EXPRESSION_DEALLOC 384
+#define FSM_CREATE 385
+#define FSM_ADD_ARC 386
+#define FSM_CREATE_TABLES 387
+#define FSM_DB_WRITE 388
+#define FSM_DB_READ 389
+#define FSM_DB_MERGE 390
+#define FSM_MERGE 391
+#define FSM_TABLE_SET 392
+#define FSM_VCD_ASSIGN 393
+#define FSM_GET_STATS 394
+#define FSM_GET_FUNIT_SUMMARY 395
+#define FSM_GET_INST_SUMMARY 396
+#define FSM_GATHER_SIGNALS 397
+#define FSM_COLLECT 398
+#define FSM_GET_COVERAGE 399
+#define FSM_DISPLAY_INSTANCE_SUMMARY 400
+#define FSM_INSTANCE_SUMMARY 401
+#define FSM_DISPLAY_FUNIT_SUMMARY 402
+#define FSM_FUNIT_SUMMARY 403
+#define FSM_DISPLAY_STATE_VERBOSE 404
+#define FSM_DISPLAY_ARC_VERBOSE 405
+#define FSM_DISPLAY_VERBOSE 406
+#define FSM_INSTANCE_VERBOSE 407
+#define FSM_FUNIT_VERBOSE 408
+#define FSM_REPORT 409
+#define FSM_DEALLOC 410
+#define FSM_ARG_PARSE_STATE 411
+#define FSM_ARG_PARSE 412
+#define FSM_ARG_PARSE_VALUE 413
+#define FSM_ARG_PARSE_TRANS 414
+#define FSM_ARG_PARSE_ATTR 415
+#define FSM_VAR_ADD 416
+#define FSM_VAR_IS_OUTPUT_STATE 417
+#define FSM_VAR_BIND_EXPR 418
+#define FSM_VAR_ADD_EXPR 419
+#define FSM_VAR_BIND_STMT 420
+#define FSM_VAR_BIND_ADD 421
+#define FSM_VAR_STMT_ADD 422
+#define FSM_VAR_BIND 423
+#define FSM_VAR_DEALLOC 424
+#define FSM_VAR_REMOVE 425
+#define FSM_VAR_CLEANUP 426
+#define FST_READER_PROCESS_HIER 427
+#define FST_CALLBACK 428
+#define FST_PARSE 429
+#define FUNC_ITER_DISPLAY 430
+#define FUNC_ITER_SORT 431
+#define FUNC_ITER_COUNT_STMT_ITERS 432
+#define FUNC_ITER_ADD_STMT_ITERS 433
+#define FUNC_ITER_ADD_SIG_LINKS 434
+#define FUNC_ITER_INIT 435
+#define FUNC_ITER_GET_NEXT_STATEMENT 436
+#define FUNC_ITER_GET_NEXT_SIGNAL 437
+#define FUNC_ITER_DEALLOC 438
+#define FUNIT_INIT 439
+#define FUNIT_CREATE 440
+#define FUNIT_GET_CURR_MODULE 441
+#define FUNIT_GET_CURR_MODULE_SAFE 442
+#define FUNIT_GET_CURR_FUNCTION 443
+#define FUNIT_GET_CURR_TASK 444
+#define FUNIT_GET_PORT_COUNT 445
+#define FUNIT_FIND_PARAM 446
+#define FUNIT_FIND_SIGNAL 447
+#define FUNIT_FIND_SIGNAL_REF 448
+#define FUNIT_FIND_LOCAL_SIGNAL 449
+#define FUNIT_FIND_LOCAL_SIGNAL_INDEX 450
+#define FUNIT_REMOVE_STMT_BLKS_CALLING_STMT 451
+#define FUNIT_GEN_TASK_FUNCTION_NAMEDBLOCK_NAME 452
+#define FUNIT_SIZE_ELEMENTS 453
+#define FUNIT_DB_WRITE 454
+#define FUNIT_INST_PARMS_MATCH 455
+#define FUNIT_IS_SIZED_FOR 456
+#define FUNIT_DB_READ 457
+#define FUNIT_VERSION_DB_READ 458
+#define FUNIT_DB_MERGE 459
+#define FUNIT_DB_MERGE_READ_LINE 460
+#define FUNIT_DB_MERGE_COVERAGE 461
+#define FUNIT_MERGE 462
+#define FUNIT_FLATTEN_NAME 463
+#define FUNIT_FIND_BY_ID 464
+#define FUNIT_IS_TOP_MODULE 465
+#define FUNIT_IS_UNNAMED 466
+#define FUNIT_IS_UNNAMED_CHILD_OF 467
+#define FUNIT_IS_CHILD_OF 468
+#define FUNIT_DISPLAY_SIGNALS 469
+#define FUNIT_DISPLAY_EXPRESSIONS 470
+#define STATEMENT_ADD_THREAD 471
+#define FUNIT_PUSH_THREADS 472
+#define STATEMENT_DELETE_THREAD 473
+#define FUNIT_OUTPUT_DUMPVARS 474
+#define FUNIT_IS_ONE_SIGNAL_ASSIGNED 475
+#define FUNIT_CLEAN 476
+#define FUNIT_DEALLOC 477
+#define GEN_ITEM_STRINGIFY 478
+#define GEN_ITEM_DISPLAY 479
+#define GEN_ITEM_DISPLAY_BLOCK_HELPER 480
+#define GEN_ITEM_DISPLAY_BLOCK 481
+#define GEN_ITEM_COMPARE 482
+#define GEN_ITEM_FIND 483
+#define GEN_ITEM_REMOVE_IF_CONTAINS_EXPR_CALLING_STMT 484
+#define GEN_ITEM_GET_GENVAR 485
+#define GEN_ITEM_VARNAME_CONTAINS_GENVAR 486
+#define GEN_ITEM_CALC_SIGNAL_NAME 487
+#define GEN_ITEM_GENVAR_VALUE 488
+#define GEN_ITEM_IS_IDENTIFIER 489
+#define GEN_ITEM_CREATE_EXPR 490
+#define GEN_ITEM_CREATE_SIG 491
+#define GEN_ITEM_CREATE_STMT 492
+#define GEN_ITEM_CREATE_INST 493
+#define GEN_ITEM_CREATE_TFN 494
+#define GEN_ITEM_CREATE_BIND 495
+#define GEN_ITEM_RESIZE_STMTS_AND_SIGS 496
+#define GEN_ITEM_ASSIGN_IDS 497
+#define GEN_ITEM_DB_WRITE 498
+#define GEN_ITEM_DB_WRITE_EXPR_TREE 499
+#define GEN_ITEM_CONNECT 500
+#define GEN_ITEM_RESOLVE 501
+#define GEN_ITEM_BIND 502
+#define GENERATE_RESOLVE_INST 503
+#define GENERATE_REMOVE_STMT_HELPER 504
+#define GENERATE_REMOVE_STMT 505
+#define GENERATE_FIND_STMT_BY_POSITION_HELPER 506
+#define GENERATE_FIND_STMT_BY_POSITION 507
+#define GENERATE_FIND_TFN_BY_POSITION_HELPER 508
+#define GENERATE_FIND_TFN_BY_POSITION 509
+#define GEN_ITEM_DEALLOC 510
+#define GENERATOR_GET_RELATIVE_SCOPE 511
+#define GENERATOR_CLEAR_REPLACE_PTRS 512
+#define GENERATOR_IS_STATIC_FUNCTION_ONLY 513
+#define GENERATOR_IS_STATIC_FUNCTION 514
+#define GENERATOR_REPLACE 515
+#define GENERATOR_PUSH_REG_INSERT 516
+#define GENERATOR_POP_REG_INSERT 517
+#define GENERATOR_IS_BASE_REG_INSERT 518
+#define GENERATOR_INSERT_REG 519
+#define GENERATOR_PUSH_FUNIT 520
+#define GENERATOR_POP_FUNIT 521
+#define GENERATOR_EXPR_NEEDS_TO_BE_SUBSTITUTED 522
+#define GENERATOR_EXPR_COV_NEEDED 523
+#define GENERATOR_CLEAR_COMB_CNTD 524
+#define GENERATOR_CREATE_EXPR_NAME 525
+#define GENERATOR_SORT_FUNIT_BY_FILENAME 526
+#define GENERATOR_SET_NEXT_FUNIT 527
+#define GENERATOR_DEALLOC_FNAME_LIST 528
+#define GENERATOR_OUTPUT_FUNIT 529
+#define GENERATOR_WRITE_VERILATOR_INST_IDS 530
+#define GENERATOR_OUTPUT 531
+#define GENERATOR_INIT_FUNIT 532
+#define GENERATOR_PREPEND_TO_WORK_CODE 533
+#define GENERATOR_ADD_TO_WORK_CODE 534
+#define GENERATOR_FLUSH_WORK_CODE1 535
+#define GENERATOR_ADD_TO_HOLD_CODE 536
+#define GENERATOR_FLUSH_HOLD_CODE1 537
+#define GENERATOR_FLUSH_ALL1 538
+#define GENERATOR_FIND_STATEMENT 539
+#define GENERATOR_FIND_CASE_STATEMENT 540
+#define GENERATOR_INSERT_LINE_COV_WITH_STMT 541
+#define GENERATOR_INSERT_LINE_COV 542
+#define GENERATOR_INSERT_EVENT_COMB_COV 543
+#define GENERATOR_INSERT_UNARY_COMB_COV 544
+#define GENERATOR_INSERT_AND_COMB_COV 545
+#define GENERATOR_MBIT_GEN_VALUE 546
+#define GENERATOR_IS_RHS_OF_ASSIGNMENT 547
+#define GENERATOR_GEN_SIZE 548
+#define GENERATOR_CREATE_LHS 549
+#define GENERATOR_INSERT_SUBEXP 550
+#define GENERATOR_COMB_COV_HELPER2 551
+#define GENERATOR_INSERT_COMB_COV_HELPER 552
+#define GENERATOR_GEN_MEM_INDEX_HELPER 553
+#define GENERATOR_GEN_MEM_INDEX 554
+#define GENERATOR_GEN_MEM_SIZE 555
+#define GENERATOR_GET_LHS_LSB_HELPER 556
+#define GENERATOR_GET_LHS_LSB 557
+#define GENERATOR_MEM_COV 558
+#define GENERATOR_MEM_COV_HELPER 559
+#define GENERATOR_COMB_COV 560
+#define GENERATOR_INSERT_COMB_COV_FROM_STMT_STACK 561
+#define GENERATOR_INSERT_COMB_COV_WITH_STMT 562
+#define GENERATOR_INSERT_CASE_COMB_COV 563
+#define GENERATOR_FSM_COVS 564
+#define GENERATOR_HANDLE_EVENT_TYPE 565
+#define GENERATOR_HANDLE_EVENT_TRIGGER 566
+#define GENERATOR_HOLD_LAST_TOKEN 567
+#define GENERATOR_FLUSH_HELD_TOKEN 568
+#define GENERATOR_INST_ID_PARAM 569
+#define GENERATOR_INST_ID_OVERRIDES_HELPER 570
+#define GENERATOR_INST_ID_OVERRIDES 571
+#define GENERATOR_BEGIN_PARALLEL_STATEMENT 572
+#define GENERATOR_END_PARALLEL_STATEMENT 573
+#define GENERATOR_BUILD 574
+#define GENERATOR_BUILD2 575
+#define GENERATOR_DESTROY2 576
+#define GENERATOR_TMP_REGS 577
+#define GENERATOR_CREATE_TMP_REGS 578
+#define GENERROR 579
+#define GENERATOR_WRITE_TO_FILE 580
+#define SCORE_ADD_ARGS 581
+#define INFO_SET_VECTOR_ELEM_SIZE 582
+#define INFO_SET_SCORED 583
+#define INFO_DB_WRITE 584
+#define INFO_DB_WRITE_FINGERPRINT 585
+#define INFO_DB_READ 586
+#define INFO_READ_FINGERPRINT 587
+#define ARGS_DB_READ 588
+#define MESSAGE_DB_READ 589
+#define MERGED_CDD_DB_READ 590
+#define INFO_DEALLOC 591
+#define INSTANCE_DISPLAY_TREE_HELPER 592
+#define INSTANCE_DISPLAY_TREE 593
+#define INSTANCE_CREATE 594
+#define INSTANCE_ASSIGN_IDS 595
+#define INSTANCE_GEN_SCOPE 596
+#define INSTANCE_GEN_VERILATOR_SCOPE 597
+#define INSTANCE_COMPARE 598
+#define INSTANCE_FIND_SCOPE 599
+#define INSTANCE_INDEX_HASH 600
+#define INSTANCE_INDEX_INSERT 601
+#define INSTANCE_INDEX_ADD 602
+#define INSTANCE_INDEX_ADD_CANDIDATE 603
+#define INSTANCE_INDEX_ADD_TREE 604
+#define INSTANCE_INDEX_CREATE 605
+#define INSTANCE_INDEX_LOOKUP 606
+#define INSTANCE_INDEX_FIND 607
+#define INSTANCE_INDEX_DEALLOC 608
+#define INSTANCE_FIND_BY_FUNIT 609
+#define INSTANCE_FIND_BY_FUNIT_NAME_IF_ONE_HELPER 610
+#define INSTANCE_FIND_BY_FUNIT_NAME_IF_ONE 611
+#define INSTANCE_FIND_SIGNAL_BY_EXCLUSION_ID 612
+#define INSTANCE_FIND_EXPRESSION_BY_EXCLUSION_ID 613
+#define INSTANCE_FIND_FSM_ARC_INDEX_BY_EXCLUSION_ID 614
+#define INSTANCE_ADD_CHILD 615
+#define INSTANCE_CHILD_MAP_SLOT 616
+#define INSTANCE_CHILD_MAP_ADD 617
+#define INSTANCE_CHILD_MAP_FIND 618
+#define INSTANCE_CHILD_MAP_CREATE 619
+#define INSTANCE_CHILD_MAP_DEALLOC 620
+#define INSTANCE_COPY_HELPER 621
+#define INSTANCE_COPY 622
+#define INSTANCE_PARSE_ADD 623
+#define INSTANCE_RESOLVE_INST 624
+#define INSTANCE_RESOLVE_HELPER 625
+#define INSTANCE_RESOLVE 626
+#define INSTANCE_READ_ADD 627
+#define INSTANCE_MERGE 628
+#define INSTANCE_GET_LEADING_HIERARCHY 629
+#define INSTANCE_GET_VERILATOR_LEADING_HIERARCHY 630
+#define INSTANCE_MARK_LHIER_DIFFS 631
+#define INSTANCE_MERGE_TWO_TREES 632
+#define INSTANCE_DB_WRITE 633
+#define INSTANCE_ONLY_DB_READ 634
+#define INSTANCE_ONLY_DB_MERGE 635
+#define INSTANCE_DB_WRITE_STATS 636
+#define INSTANCE_DB_READ_STATS 637
+#define INSTANCE_REMOVE_STMT_BLKS_CALLING_STMT 638
+#define INSTANCE_REMOVE_PARMS_WITH_EXPR 639
+#define INSTANCE_DEALLOC_SINGLE 640
+#define INSTANCE_OUTPUT_DUMPVARS 641
+#define INSTANCE_DEALLOC_TREE 642
+#define INSTANCE_DEALLOC 643
+#define LINE_GET_STATS 644
+#define LINE_COLLECT 645
+#define LINE_GET_FUNIT_SUMMARY 646
+#define LINE_GET_INST_SUMMARY 647
+#define LINE_DISPLAY_INSTANCE_SUMMARY 648
+#define LINE_INSTANCE_SUMMARY 649
+#define LINE_DISPLAY_FUNIT_SUMMARY 650
+#define LINE_FUNIT_SUMMARY 651
+#define LINE_DISPLAY_VERBOSE 652
+#define LINE_INSTANCE_VERBOSE 653
+#define LINE_FUNIT_VERBOSE 654
+#define LINE_REPORT 655
+#define STR_LINK_ADD 656
+#define STMT_LINK_ADD_HEAD 657
+#define EXP_LINK_ADD 658
+#define SIG_LINK_ADD 659
+#define FSM_LINK_ADD 660
+#define FUNIT_LINK_ADD 661
+#define GITEM_LINK_ADD 662
+#define INST_LINK_ADD 663
+#define STR_LINK_FIND 664
+#define STMT_LINK_FIND 665
+#define STMT_LINK_FIND_BY_POSITION 666
+#define EXP_LINK_FIND 667
+#define SIG_LINK_FIND 668
+#define FSM_LINK_FIND 669
+#define FUNIT_LINK_FIND 670
+#define GITEM_LINK_FIND 671
+#define INST_LINK_FIND_BY_SCOPE 672
+#define INST_LINK_FIND_BY_FUNIT 673
+#define STR_LINK_REMOVE 674
+#define EXP_LINK_REMOVE 675
+#define GITEM_LINK_REMOVE 676
+#define FUNIT_LINK_REMOVE 677
+#define STR_LINK_DELETE_LIST 678
+#define STMT_LINK_UNLINK 679
+#define STMT_LINK_DELETE_LIST 680
+#define EXP_LINK_DELETE_LIST 681
+#define SIG_LINK_DELETE_LIST 682
+#define FSM_LINK_DELETE_LIST 683
+#define FUNIT_LINK_DELETE_LIST 684
+#define GITEM_LINK_DELETE_LIST 685
+#define INST_LINK_DELETE_LIST 686
+#define VCDID 687
+#define VCD_CALLBACK 688
+#define LXT_PARSE 689
+#define LXT2_RD_EXPAND_INTEGER_TO_BITS 690
+#define LXT2_RD_EXPAND_BITS_TO_INTEGER 691
+#define LXT2_RD_ITER_RADIX 692
+#define LXT2_RD_ITER_RADIX0 693
+#define LXT2_RD_BUILD_RADIX 694
+#define LXT2_RD_REGENERATE_PROCESS_MASK 695
+#define LXT2_RD_PROCESS_BLOCK 696
+#define LXT2_RD_INIT 697
+#define LXT2_RD_CLOSE 698
+#define LXT2_RD_GET_FACNAME 699
+#define LXT2_RD_ITER_BLOCKS 700
+#define LXT2_RD_LIMIT_TIME_RANGE 701
+#define LXT2_RD_UNLIMIT_TIME_RANGE 702
+#define MEMORY_GET_STAT 703
+#define MEMORY_GET_STATS 704
+#define MEMORY_GET_FUNIT_SUMMARY 705
+#define MEMORY_GET_INST_SUMMARY 706
+#define MEMORY_CREATE_PDIM_BIT_ARRAY 707
+#define MEMORY_GET_MEM_COVERAGE 708
+#define MEMORY_GET_COVERAGE 709
+#define MEMORY_COLLECT 710
+#define MEMORY_DISPLAY_TOGGLE_INSTANCE_SUMMARY 711
+#define MEMORY_TOGGLE_INSTANCE_SUMMARY 712
+#define MEMORY_DISPLAY_AE_INSTANCE_SUMMARY 713
+#define MEMORY_AE_INSTANCE_SUMMARY 714
+#define MEMORY_DISPLAY_TOGGLE_FUNIT_SUMMARY 715
+#define MEMORY_TOGGLE_FUNIT_SUMMARY 716
+#define MEMORY_DISPLAY_AE_FUNIT_SUMMARY 717
+#define MEMORY_AE_FUNIT_SUMMARY 718
+#define MEMORY_DISPLAY_MEMORY 719
+#define MEMORY_DISPLAY_VERBOSE 720
+#define MEMORY_INSTANCE_VERBOSE 721
+#define MEMORY_FUNIT_VERBOSE 722
+#define MEMORY_REPORT 723
+#define MERGE_CHECK 724
+#define MERGE_CHECK_SAME_DESIGN 725
+#define MERGE_READ_CDD 726
+#define MERGE_WORKER 727
+#define MERGE_REMOVE_TEMPS 728
+#define MERGE_PARALLEL 729
+#define COMMAND_MERGE 730
+#define OBFUSCATE_SET_MODE 731
+#define OBFUSCATE_NAME 732
+#define OBFUSCATE_DEALLOC 733
+#define OVL_IS_ASSERTION_NAME 734
+#define OVL_IS_ASSERTION_MODULE 735
+#define OVL_IS_COVERAGE_POINT 736
+#define OVL_ADD_ASSERTIONS_TO_NO_SCORE_LIST 737
+#define OVL_GET_FUNIT_STATS 738
+#define OVL_GET_COVERAGE_POINT 739
+#define OVL_DISPLAY_VERBOSE 740
+#define OVL_COLLECT 741
+#define OVL_GET_COVERAGE 742
+#define MOD_PARM_FIND 743
+#define MOD_PARM_FIND_EXPR_AND_REMOVE 744
+#define MOD_PARM_GEN_SIZE_CODE 745
+#define MOD_PARM_GEN_LSB_CODE 746
+#define MOD_PARM_ADD 747
+#define INST_PARM_FIND 748
+#define INST_PARM_ADD 749
+#define INST_PARM_ADD_GENVAR 750
+#define INST_PARM_BIND 751
+#define DEFPARAM_ADD 752
+#define DEFPARAM_DEALLOC 753
+#define PARAM_FIND_AND_SET_EXPR_VALUE 754
+#define PARAM_SET_SIG_SIZE 755
+#define PARAM_SIZE_FUNCTION 756
+#define PARAM_EXPR_EVAL 757
+#define PARAM_HAS_OVERRIDE 758
+#define PARAM_HAS_DEFPARAM 759
+#define PARAM_RESOLVE_DECLARED 760
+#define PARAM_RESOLVE_OVERRIDE 761
+#define PARAM_RESOLVE_INST 762
+#define PARAM_RESOLVE 763
+#define PARAM_DB_WRITE 764
+#define MOD_PARM_DEALLOC 765
+#define INST_PARM_DEALLOC 766
+#define PARSE_READLINE 767
+#define PARSE_DESIGN 768
+#define PARSE_AND_SCORE_DUMPFILE 769
+#define PARSER_STATIC_EXPR_PRIMARY_A 770
+#define PARSER_STATIC_EXPR_PRIMARY_B 771
+#define PARSER_EXPRESSION_LIST_A 772
+#define PARSER_EXPRESSION_LIST_B 773
+#define PARSER_EXPRESSION_LIST_C 774
+#define PARSER_EXPRESSION_LIST_D 775
+#define PARSER_IDENTIFIER_A 776
+#define PARSER_GENERATE_CASE_ITEM_A 777
+#define PARSER_GENERATE_CASE_ITEM_B 778
+#define PARSER_GENERATE_CASE_ITEM_C 779
+#define PARSER_STATEMENT_BEGIN_A 780
+#define PARSER_STATEMENT_FORK_A 781
+#define PARSER_STATEMENT_FOR_A 782
+#define PARSER_CASE_ITEM_A 783
+#define PARSER_CASE_ITEM_B 784
+#define PARSER_CASE_ITEM_C 785
+#define PARSER_DELAY_VALUE_A 786
+#define PARSER_DELAY_VALUE_B 787
+#define PARSER_PARAMETER_VALUE_BYNAME_A 788
+#define PARSER_GATE_INSTANCE_A 789
+#define PARSER_GATE_INSTANCE_B 790
+#define PARSER_GATE_INSTANCE_C 791
+#define PARSER_GATE_INSTANCE_D 792
+#define PARSER_LIST_OF_NAMES_A 793
+#define PARSER_LIST_OF_NAMES_B 794
+#define PARSER_CHECK_PSTAR 795
+#define PARSER_CHECK_ATTRIBUTE 796
+#define PARSER_CREATE_ATTR_LIST 797
+#define PARSER_CREATE_ATTR 798
+#define PARSER_CREATE_TASK_DECL 799
+#define PARSER_CREATE_TASK_BODY 800
+#define PARSER_CREATE_FUNCTION_DECL 801
+#define PARSER_CREATE_FUNCTION_BODY 802
+#define PARSER_END_TASK_FUNCTION 803
+#define PARSER_CREATE_PORT 804
+#define PARSER_HANDLE_INLINE_PORT_ERROR 805
+#define PARSER_CREATE_SIMPLE_NUMBER 806
+#define PARSER_CREATE_COMPLEX_NUMBER 807
+#define PARSER_APPEND_SE_PORT_LIST 808
+#define PARSER_CREATE_SE_PORT_LIST 809
+#define PARSER_CREATE_UNARY_SE 810
+#define PARSER_CREATE_SYSCALL_SE 811
+#define PARSER_CREATE_UNARY_EXP 812
+#define PARSER_CREATE_BINARY_EXP 813
+#define PARSER_CREATE_OP_AND_ASSIGN_EXP 814
+#define PARSER_CREATE_SYSCALL_EXP 815
+#define PARSER_CREATE_SYSCALL_W_PARAMS_EXP 816
+#define PARSER_CREATE_OP_AND_ASSIGN_W_DIM_EXP 817
+#define PARSER_HANDLE_CASE_STATEMENT 818
+#define PARSER_HANDLE_CASE_STATEMENT_LIST 819
+#define PARSER_HANDLE_GENERATE_CASE_STATEMENT 820
+#define PARSER_HANDLE_GENERATE_CASE_STATEMENT_LIST 821
+#define VLERROR 822
+#define VLWARN 823
+#define PARSER_DEALLOC_SIG_RANGE 824
+#define PARSER_COPY_CURR_RANGE 825
+#define PARSER_COPY_RANGE_TO_CURR_RANGE 826
+#define PARSER_EXPLICITLY_SET_CURR_RANGE 827
+#define PARSER_IMPLICITLY_SET_CURR_RANGE 828
+#define PARSER_CHECK_GENERATION 829
+#define PERF_GEN_STATS 830
+#define PERF_OUTPUT_MOD_STATS 831
+#define PERF_OUTPUT_INST_REPORT_HELPER 832
+#define PERF_OUTPUT_INST_REPORT 833
+#define PPCACHE_FILE_SIG 834
+#define PPCACHE_CAN_OPEN 835
+#define PPCACHE_KEY_ADD 836
+#define PPCACHE_KEY_ADD_STR 837
+#define PPCACHE_COUNT_CHANGES 838
+#define PPCACHE_WRITE_STR 839
+#define PPCACHE_WRITE_DEFINE 840
+#define PPCACHE_WRITE_CHANGES 841
+#define PPCACHE_COUNT_DEFINES 842
+#define PPCACHE_WRITE_DEFINES 843
+#define PPCACHE_READ_STR 844
+#define PPCACHE_READ_DEFINE 845
+#define PPCACHE_READ_DEFINES 846
+#define PPCACHE_ENTRY_NAME 847
+#define PPCACHE_READ_ENTRY 848
+#define PPCACHE_LOAD 849
+#define PPCACHE_ADD_INCLUDE 850
+#define PPCACHE_ADD_MISSING 851
+#define PPCACHE_USE_DEFINE 852
+#define PPCACHE_CHANGE_DEFINE 853
+#define PPCACHE_STORE 854
+#define PPCACHE_CANCEL 855
+#define PPCACHE_PREPROCESS 856
+#define PPCACHE_PREPROCESS_GROUP 857
+#define PPCACHE_WORKER 858
+#define PPCACHE_POPULATE 859
+#define PPCACHE_DEALLOC 860
+#define DEF_LOOKUP 861
+#define IS_DEFINED 862
+#define DEF_MATCH 863
+#define DEF_START 864
+#define DEFINE_MACRO 865
+#define DO_DEFINE 866
+#define DEF_IS_DONE 867
+#define DEF_FINISH 868
+#define DEF_UNDEFINE 869
+#define INCLUDE_FILENAME 870
+#define DO_INCLUDE 871
+#define YYWRAP 872
+#define RESET_PPLEXER 873
+#define RACE_BLK_CREATE 874
+#define RACE_MAP_SLOT 875
+#define RACE_MAP_ADD 876
+#define RACE_MAP_DEALLOC 877
+#define RACE_MAP_FIND 878
+#define RACE_GET_HEAD_STATEMENT 879
+#define RACE_FIND_HEAD_STATEMENT 880
+#define RACE_CALC_STMT_BLK_TYPE 881
+#define RACE_CALC_EXPR_ASSIGNMENT 882
+#define RACE_CALC_ASSIGNMENTS 883
+#define RACE_HANDLE_RACE_CONDITION 884
+#define RACE_CHECK_ASSIGNMENT_TYPES 885
+#define RACE_CHECK_ONE_BLOCK_ASSIGNMENT 886
+#define RACE_CHECK_RACE_COUNT 887
+#define RACE_CHECK_MODULES 888
+#define RACE_DB_WRITE 889
+#define RACE_DB_READ 890
+#define RACE_GET_STATS 891
+#define RACE_REPORT_SUMMARY 892
+#define RACE_REPORT_VERBOSE 893
+#define RACE_REPORT 894
+#define RACE_COLLECT_LINES 895
+#define RACE_BLK_DELETE_LIST 896
+#define RANK_CREATE_COMP_CDD_COV 897
+#define RANK_DEALLOC_COMP_CDD_COV 898
+#define RANK_CHECK_INDEX 899
+#define RANK_GATHER_SIGNAL_COV 900
+#define RANK_GATHER_COMB_COV 901
+#define RANK_GATHER_EXPRESSION_COV 902
+#define RANK_GATHER_FSM_COV 903
+#define RANK_CALC_NUM_CPS 904
+#define RANK_GATHER_COMP_CDD_COV 905
+#define RANK_READ_CDD 906
+#define RANK_WORKER 907
+#define RANK_CACHE_CLOSE 908
+#define RANK_CACHE_OPEN 909
+#define RANK_CACHE_FIND 910
+#define RANK_CACHE_READ_CDD 911
+#define RANK_READ_FIRST_CDD 912
+#define RANK_READ_NEXT_CDD 913
+#define RANK_CACHE_WRITE 914
+#define RANK_READ_CDDS_PARALLEL 915
+#define RANK_SELECTED_CDD_COV 916
+#define RANK_PERFORM_WEIGHTED_SELECTION 917
+#define RANK_PERFORM_GREEDY_SORT 918
+#define RANK_RESET_NEED_MASKS 919
+#define RANK_CALC_NEEDED_CPS 920
+#define RANK_ADD_RANKED_CPS 921
+#define RANK_HEAP_SIFT_DOWN 922
+#define RANK_PERFORM_LAZY_GREEDY_SORT 923
+#define RANK_COUNT_CPS 924
+#define RANK_PERFORM 925
+#define RANK_OUTPUT 926
+#define COMMAND_RANK 927
+#define REENTRANT_COUNT_AFU_BITS 928
+#define REENTRANT_STORE_DATA_BITS 929
+#define REENTRANT_RESTORE_DATA_BITS 930
+#define REENTRANT_CREATE 931
+#define REENTRANT_DEALLOC 932
+#define REPORT_PARSE_METRICS 933
+#define REPORT_PARSE_ARGS 934
+#define REPORT_GATHER_INSTANCE_STATS 935
+#define REPORT_COLLECT_INSTANCES 936
+#define REPORT_STATS_WORKER 937
+#define REPORT_GATHER_INSTANCE_STATS_PARALLEL 938
+#define REPORT_SECTION_WORKER 939
+#define REPORT_START_SECTION_WORKER 940
+#define REPORT_GENERATE_SECTIONS_PARALLEL 941
+#define REPORT_GATHER_FUNIT_STATS 942
+#define REPORT_PRINT_HEADER 943
+#define REPORT_GENERATE 944
+#define REPORT_READ_CDD_AND_READY 945
+#define REPORT_CLOSE_CDD 946
+#define REPORT_SAVE_CDD 947
+#define REPORT_FORMAT_EXCLUSION_REASON 948
+#define REPORT_OUTPUT_EXCLUSION_REASON 949
+#define COMMAND_REPORT 950
+#define SCOPE_FIND_FUNIT_FROM_SCOPE 951
+#define SCOPE_FIND_PARAM 952
+#define SCOPE_FIND_SIGNAL 953
+#define SCOPE_FIND_TASK_FUNCTION_NAMEDBLOCK 954
+#define SCOPE_GET_PARENT_FUNIT 955
+#define SCOPE_GET_PARENT_MODULE 956
+#define SCORE_GENERATE_TOP_VPI_MODULE 957
+#define SCORE_GENERATE_TOP_DUMPVARS_MODULE 958
+#define SCORE_GENERATE_PLI_TAB_FILE 959
+#define SCORE_PARSE_DEFINE 960
+#define SCORE_PARSE_METRICS 961
+#define SCORE_PARSE_ARGS 962
+#define COMMAND_SCORE 963
+#define SEARCH_INIT 964
+#define SEARCH_ADD_INCLUDE_PATH 965
+#define SEARCH_ADD_DIRECTORY_PATH 966
+#define SEARCH_ADD_FILE 967
+#define SEARCH_ADD_NO_SCORE_FUNIT 968
+#define SEARCH_ADD_EXTENSIONS 969
+#define SEARCH_DIR_INDEX_NAME 970
+#define SEARCH_SCAN_DIRECTORY 971
+#define SEARCH_READ_STR 972
+#define SEARCH_READ_DIR_INDEX 973
+#define SEARCH_WRITE_DIR_INDEX 974
+#define SEARCH_READ_DIRECTORY 975
+#define SEARCH_ADD_VFILE 976
+#define SEARCH_LOAD_FILES 977
+#define SEARCH_FREE_LISTS 978
+#define SIM_CURRENT_THREAD 979
+#define SIM_THREAD_POP_HEAD 980
+#define SIM_THREAD_INSERT_INTO_DELAY_QUEUE 981
+#define SIM_THREAD_PUSH 982
+#define SIM_EXPR_CHANGED 983
+#define SIM_CREATE_THREAD 984
+#define SIM_ADD_THREAD 985
+#define SIM_KILL_THREAD 986
+#define SIM_KILL_THREAD_WITH_FUNIT 987
+#define SIM_ADD_STATICS 988
+#define SIM_EXPRESSION 989
+#define SIM_THREAD 990
+#define SIM_SIMULATE 991
+#define SIM_INITIALIZE 992
+#define SIM_STOP 993
+#define SIM_FINISH 994
+#define SIM_ADD_NONBLOCK_ASSIGN 995
+#define SIM_PERFORM_NBA 996
+#define SIM_DEALLOC 997
+#define STATISTIC_CREATE 998
+#define STATISTIC_IS_EMPTY 999
+#define STATISTIC_DEALLOC 1000
+#define STATEMENT_CREATE 1001
+#define STATEMENT_QUEUE_ADD 1002
+#define STATEMENT_QUEUE_COMPARE 1003
+#define STATEMENT_SIZE_ELEMENTS 1004
+#define STATEMENT_DB_WRITE 1005
+#define STATEMENT_DB_WRITE_TREE 1006
+#define STATEMENT_DB_WRITE_EXPR_TREE 1007
+#define STATEMENT_DB_READ 1008
+#define STATEMENT_ASSIGN_EXPR_IDS 1009
+#define STATEMENT_CONNECT 1010
+#define STATEMENT_GET_LAST_LINE_HELPER 1011
+#define STATEMENT_GET_LAST_LINE 1012
+#define STATEMENT_FIND_RHS_SIGS 1013
+#define STATEMENT_FIND_STATEMENT 1014
+#define STATEMENT_FIND_STATEMENT_BY_POSITION 1015
+#define STATEMENT_CONTAINS_EXPR_CALLING_STMT 1016
+#define STATEMENT_ADD_TO_STMT_LINK 1017
+#define STATEMENT_DEALLOC_RECURSIVE 1018
+#define STATEMENT_DEALLOC 1019
+#define STATIC_EXPR_GEN_UNARY 1020
+#define STATIC_EXPR_GEN 1021
+#define STATIC_EXPR_GEN_TERNARY 1022
+#define STATIC_EXPR_CALC_LSB_AND_WIDTH_PRE 1023
+#define STATIC_EXPR_CALC_LSB_AND_WIDTH_POST 1024
+#define STATIC_EXPR_DEALLOC 1025
+#define STMT_BLK_ADD_TO_REMOVE_LIST 1026
+#define STMT_BLK_REMOVE 1027
+#define STMT_BLK_SPECIFY_REMOVAL_REASON 1028
+#define STRUCT_UNION_LENGTH 1029
+#define STRUCT_UNION_ADD_MEMBER 1030
+#define STRUCT_UNION_ADD_MEMBER_VOID 1031
+#define STRUCT_UNION_ADD_MEMBER_SIG 1032
+#define STRUCT_UNION_ADD_MEMBER_TYPEDEF 1033
+#define STRUCT_UNION_ADD_MEMBER_ENUM 1034
+#define STRUCT_UNION_ADD_MEMBER_STRUCT_UNION 1035
+#define STRUCT_UNION_CREATE 1036
+#define STRUCT_UNION_MEMBER_DEALLOC 1037
+#define STRUCT_UNION_DEALLOC 1038
+#define STRUCT_UNION_DEALLOC_LIST 1039
+#define SYMTABLE_ADD_SYM_SIG 1040
+#define SYMTABLE_ADD_SYM_EXP 1041
+#define SYMTABLE_ADD_SYM_FSM 1042
+#define SYMTABLE_INIT 1043
+#define SYMTABLE_CREATE 1044
+#define SYMTABLE_GET_TABLE 1045
+#define SYMTABLE_ADD_SIGNAL 1046
+#define SYMTABLE_ADD_EXPRESSION 1047
+#define SYMTABLE_ADD_MEMORY 1048
+#define SYMTABLE_ADD_FSM 1049
+#define SYMTABLE_SET_VALUE 1050
+#define SYMTABLE_ASSIGN 1051
+#define SYMTABLE_DEALLOC 1052
+#define SYS_TASK_UNIFORM 1053
+#define SYS_TASK_RTL_DIST_UNIFORM 1054
+#define SYS_TASK_SRANDOM 1055
+#define SYS_TASK_RANDOM 1056
+#define SYS_TASK_URANDOM 1057
+#define SYS_TASK_URANDOM_RANGE 1058
+#define SYS_TASK_REALTOBITS 1059
+#define SYS_TASK_BITSTOREAL 1060
+#define SYS_TASK_SHORTREALTOBITS 1061
+#define SYS_TASK_BITSTOSHORTREAL 1062
+#define SYS_TASK_ITOR 1063
+#define SYS_TASK_RTOI 1064
+#define SYS_TASK_STORE_PLUSARGS 1065
+#define SYS_TASK_TEST_PLUSARG 1066
+#define SYS_TASK_VALUE_PLUSARGS 1067
+#define SYS_TASK_DEALLOC 1068
+#define TCL_FUNC_GET_RACE_REASON_MSGS 1069
+#define TCL_FUNC_GET_FUNIT_LIST 1070
+#define TCL_FUNC_GET_INSTANCES 1071
+#define TCL_FUNC_GET_INSTANCE_LIST 1072
+#define TCL_FUNC_IS_FUNIT 1073
+#define TCL_FUNC_GET_FUNIT 1074
+#define TCL_FUNC_GET_INST 1075
+#define TCL_FUNC_GET_FUNIT_NAME 1076
+#define TCL_FUNC_GET_FILENAME 1077
+#define TCL_FUNC_INST_SCOPE 1078
+#define TCL_FUNC_GET_FUNIT_START_AND_END 1079
+#define TCL_FUNC_COLLECT_UNCOVERED_LINES 1080
+#define TCL_FUNC_COLLECT_COVERED_LINES 1081
+#define TCL_FUNC_COLLECT_RACE_LINES 1082
+#define TCL_FUNC_COLLECT_UNCOVERED_TOGGLES 1083
+#define TCL_FUNC_COLLECT_COVERED_TOGGLES 1084
+#define TCL_FUNC_COLLECT_UNCOVERED_MEMORIES 1085
+#define TCL_FUNC_COLLECT_COVERED_MEMORIES 1086
+#define TCL_FUNC_GET_TOGGLE_COVERAGE 1087
+#define TCL_FUNC_GET_MEMORY_COVERAGE 1088
+#define TCL_FUNC_COLLECT_UNCOVERED_COMBS 1089
+#define TCL_FUNC_COLLECT_COVERED_COMBS 1090
+#define TCL_FUNC_GET_COMB_EXPRESSION 1091
+#define TCL_FUNC_GET_COMB_COVERAGE 1092
+#define TCL_FUNC_COLLECT_UNCOVERED_FSMS 1093
+#define TCL_FUNC_COLLECT_COVERED_FSMS 1094
+#define TCL_FUNC_GET_FSM_COVERAGE 1095
+#define TCL_FUNC_COLLECT_UNCOVERED_ASSERTIONS 1096
+#define TCL_FUNC_COLLECT_COVERED_ASSERTIONS 1097
+#define TCL_FUNC_GET_ASSERT_COVERAGE 1098
+#define TCL_FUNC_OPEN_CDD 1099
+#define TCL_FUNC_CLOSE_CDD 1100
+#define TCL_FUNC_SAVE_CDD 1101
+#define TCL_FUNC_MERGE_CDD 1102
+#define TCL_FUNC_GET_LINE_SUMMARY 1103
+#define TCL_FUNC_GET_TOGGLE_SUMMARY 1104
+#define TCL_FUNC_GET_MEMORY_SUMMARY 1105
+#define TCL_FUNC_GET_COMB_SUMMARY 1106
+#define TCL_FUNC_GET_FSM_SUMMARY 1107
+#define TCL_FUNC_GET_ASSERT_SUMMARY 1108
+#define TCL_FUNC_PREPROCESS_VERILOG 1109
+#define TCL_FUNC_GET_SCORE_PATH 1110
+#define TCL_FUNC_GET_INCLUDE_PATHNAME 1111
+#define TCL_FUNC_GET_GENERATION 1112
+#define TCL_FUNC_SET_LINE_EXCLUDE 1113
+#define TCL_FUNC_SET_TOGGLE_EXCLUDE 1114
+#define TCL_FUNC_SET_MEMORY_EXCLUDE 1115
+#define TCL_FUNC_SET_COMB_EXCLUDE 1116
+#define TCL_FUNC_FSM_EXCLUDE 1117
+#define TCL_FUNC_SET_ASSERT_EXCLUDE 1118
+#define TCL_FUNC_GENERATE_REPORT 1119
+#define TCL_FUNC_INITIALIZE 1120
+#define TOGGLE_GET_STATS 1121
+#define TOGGLE_COLLECT 1122
+#define TOGGLE_GET_COVERAGE 1123
+#define TOGGLE_GET_FUNIT_SUMMARY 1124
+#define TOGGLE_GET_INST_SUMMARY 1125
+#define TOGGLE_DISPLAY_INSTANCE_SUMMARY 1126
+#define TOGGLE_INSTANCE_SUMMARY 1127
+#define TOGGLE_DISPLAY_FUNIT_SUMMARY 1128
+#define TOGGLE_FUNIT_SUMMARY 1129
+#define TOGGLE_DISPLAY_VERBOSE 1130
+#define TOGGLE_INSTANCE_VERBOSE 1131
+#define TOGGLE_FUNIT_VERBOSE 1132
+#define TOGGLE_REPORT 1133
+#define TREE_ADD 1134
+#define TREE_FIND 1135
+#define TREE_REMOVE 1136
+#define TREE_DEALLOC 1137
+#define TREE_REBALANCE 1138
+#define CHECK_OPTION_VALUE 1139
+#define IS_VARIABLE 1140
+#define IS_FUNC_UNIT 1141
+#define IS_LEGAL_FILENAME 1142
+#define GET_BASENAME 1143
+#define GET_DIRNAME 1144
+#define GET_ABSOLUTE_PATH 1145
+#define GET_RELATIVE_PATH 1146
+#define DIRECTORY_EXISTS 1147
+#define DIRECTORY_LOAD 1148
+#define FILE_EXISTS 1149
+#define UTIL_READLINE 1150
+#define GET_QUOTED_STRING 1151
+#define SUBSTITUTE_ENV_VARS 1152
+#define SCOPE_EXTRACT_FRONT 1153
+#define SCOPE_EXTRACT_BACK 1154
+#define SCOPE_EXTRACT_SCOPE 1155
+#define SCOPE_GEN_PRINTABLE 1156
+#define SCOPE_COMPARE 1157
+#define SCOPE_LOCAL 1158
+#define CONVERT_FILE_TO_MODULE 1159
+#define GET_NEXT_VFILE 1160
+#define GEN_SPACE 1161
+#define REMOVE_UNDERSCORES 1162
+#define GET_FUNIT_TYPE 1163
+#define CALC_MISS_PERCENT 1164
+#define READ_COMMAND_FILE 1165
+#define CONVERT_STR_TO_UINT64 1166
+#define CONVERT_INT_TO_STR 1167
+#define CALC_NUM_BITS_TO_STORE 1168
+#define UTIL_HASH 1169
+#define UTIL_HASH_STRING 1170
+#define UTIL_HASH_UINT32 1171
+#define UTIL_HASH64 1172
+#define UTIL_HASH64_STRING 1173
+#define UTIL_HASH64_UINT32 1174
+#define STR_ARENA_ALLOC 1175
+#define NAME_INDEX_INSERT 1176
+#define NAME_INDEX_ADD 1177
+#define NAME_INDEX_FIND 1178
+#define NAME_INDEX_DEALLOC 1179
+#define STR_ARENA_STRDUP 1180
+#define STR_ARENA_RESET 1181
+#define STR_ARENA_DEALLOC 1182
+#define VCD_CALC_INDEX 1183
+#define VCD_GETCH_FETCH 1184
+#define VCD_GET_TOKEN 1185
+#define VCD_SYNC_END 1186
+#define VCD_PARSE_DEF_VAR 1187
+#define VCD_PARSE_DEF 1188
+#define VCD_PARSE_SIM_VECTOR 1189
+#define VCD_PARSE_SIM_REAL 1190
+#define VCD_PARSE_SIM 1191
+#define VCD_PARSE 1192
+#define VECTOR_INIT_ULONG 1193
+#define VECTOR_INT_R64 1194
+#define VECTOR_INT_R32 1195
+#define VECTOR_CREATE 1196
+#define VECTOR_COPY 1197
+#define VECTOR_COPY_RANGE 1198
+#define VECTOR_CLONE 1199
+#define VECTOR_DB_WRITE 1200
+#define VECTOR_DB_READ 1201
+#define VECTOR_DB_MERGE 1202
+#define VECTOR_MERGE 1203
+#define VECTOR_GET_EVAL_A 1204
+#define VECTOR_GET_EVAL_B 1205
+#define VECTOR_GET_EVAL_C 1206
+#define VECTOR_GET_EVAL_D 1207
+#define VECTOR_GET_EVAL_AB_COUNT 1208
+#define VECTOR_GET_EVAL_ABC_COUNT 1209
+#define VECTOR_GET_EVAL_ABCD_COUNT 1210
+#define VECTOR_GET_TOGGLE01_ULONG 1211
+#define VECTOR_GET_TOGGLE10_ULONG 1212
+#define VECTOR_DISPLAY_TOGGLE01_ULONG 1213
+#define VECTOR_DISPLAY_TOGGLE10_ULONG 1214
+#define VECTOR_TOGGLE_COUNT 1215
+#define VECTOR_MEM_RW_COUNT 1216
+#define VECTOR_SET_ASSIGNED 1217
+#define VECTOR_SET_COVERAGE_AND_ASSIGN 1218
+#define VECTOR_GET_SIGN_EXTEND_VECTOR_ULONG 1219
+#define VECTOR_SIGN_EXTEND_ULONG 1220
+#define VECTOR_LSHIFT_ULONG 1221
+#define VECTOR_RSHIFT_ULONG 1222
+#define VECTOR_SET_VALUE 1223
+#define VECTOR_SET_MEM_RD 1224
+#define VECTOR_PART_SELECT_PULL 1225
+#define VECTOR_PART_SELECT_PUSH 1226
+#define VECTOR_SET_UNARY_EVALS 1227
+#define VECTOR_SET_AND_COMB_EVALS 1228
+#define VECTOR_SET_OR_COMB_EVALS 1229
+#define VECTOR_SET_OTHER_COMB_EVALS 1230
+#define VECTOR_IS_UKNOWN 1231
+#define VECTOR_IS_NOT_ZERO 1232
+#define VECTOR_SET_TO_X 1233
+#define VECTOR_TO_INT 1234
+#define VECTOR_TO_UINT64 1235
+#define VECTOR_TO_REAL64 1236
+#define VECTOR_TO_SIM_TIME 1237
+#define VECTOR_FROM_INT 1238
+#define VECTOR_FROM_UINT64 1239
+#define VECTOR_FROM_REAL64 1240
+#define VECTOR_SET_STATIC 1241
+#define VECTOR_TO_STRING 1242
+#define VECTOR_FROM_STRING_FIXED 1243
+#define VECTOR_FROM_STRING 1244
+#define VECTOR_VCD_ASSIGN 1245
+#define VECTOR_VCD_ASSIGN2 1246
+#define VECTOR_BITWISE_AND_OP 1247
+#define VECTOR_BITWISE_NAND_OP 1248
+#define VECTOR_BITWISE_OR_OP 1249
+#define VECTOR_BITWISE_NOR_OP 1250
+#define VECTOR_BITWISE_XOR_OP 1251
+#define VECTOR_BITWISE_NXOR_OP 1252
+#define VECTOR_OP_LT 1253
+#define VECTOR_OP_LE 1254
+#define VECTOR_OP_GT 1255
+#define VECTOR_OP_GE 1256
+#define VECTOR_OP_EQ 1257
+#define VECTOR_CEQ_ULONG 1258
+#define VECTOR_OP_CEQ 1259
+#define VECTOR_OP_CXEQ 1260
+#define VECTOR_OP_CZEQ 1261
+#define VECTOR_OP_NE 1262
+#define VECTOR_OP_CNE 1263
+#define VECTOR_OP_LOR 1264
+#define VECTOR_OP_LAND 1265
+#define VECTOR_OP_LSHIFT 1266
+#define VECTOR_OP_RSHIFT 1267
+#define VECTOR_OP_ARSHIFT 1268
+#define VECTOR_OP_ADD 1269
+#define VECTOR_OP_NEGATE 1270
+#define VECTOR_OP_SUBTRACT 1271
+#define VECTOR_OP_MULTIPLY 1272
+#define VECTOR_OP_DIVIDE 1273
+#define VECTOR_OP_MODULUS 1274
+#define VECTOR_OP_INC 1275
+#define VECTOR_OP_DEC 1276
+#define VECTOR_UNARY_INV 1277
+#define VECTOR_UNARY_AND 1278
+#define VECTOR_UNARY_NAND 1279
+#define VECTOR_UNARY_OR 1280
+#define VECTOR_UNARY_NOR 1281
+#define VECTOR_UNARY_XOR 1282
+#define VECTOR_UNARY_NXOR 1283
+#define VECTOR_UNARY_NOT 1284
+#define VECTOR_OP_EXPAND 1285
+#define VECTOR_OP_LIST 1286
+#define VECTOR_OP_CLOG2 1287
+#define VECTOR_DEALLOC_VALUE 1288
+#define VECTOR_DEALLOC 1289
+#define SYM_VALUE_STORE 1290
+#define ADD_SYM_VALUES_TO_SIM 1291
+#define COVERED_ROSYNCH 1292
+#define COVERED_VALUE_CHANGE_BIN 1293
+#define COVERED_VALUE_CHANGE_REAL 1294
+#define COVERED_END_OF_SIM 1295
+#define COVERED_CB_ERROR_HANDLER 1296
+#define GEN_NEXT_SYMBOL 1297
+#define COVERED_CREATE_VALUE_CHANGE_CB 1298
+#define COVERED_PARSE_TASK_FUNC 1299
+#define COVERED_PARSE_SIGNALS 1300
+#define COVERED_PARSE_INSTANCE 1301
+#define COVERED_SIM_CALLTF 1302
+#define COVERED_REGISTER 1303
+#define VSIGNAL_INIT 1304
+#define VSIGNAL_CREATE 1305
+#define VSIGNAL_CREATE_VEC 1306
+#define VSIGNAL_DUPLICATE 1307
+#define VSIGNAL_DB_WRITE 1308
+#define VSIGNAL_DB_READ 1309
+#define VSIGNAL_DB_MERGE 1310
+#define VSIGNAL_DB_MERGE_COVERAGE 1311
+#define VSIGNAL_MERGE 1312
+#define VSIGNAL_PROPAGATE 1313
+#define VSIGNAL_VCD_ASSIGN 1314
+#define VSIGNAL_ADD_EXPRESSION 1315
+#define VSIGNAL_FROM_STRING 1316
+#define VSIGNAL_CALC_WIDTH_FOR_EXPR 1317
+#define VSIGNAL_CALC_LSB_FOR_EXPR 1318
+#define VSIGNAL_DEALLOC 1319
 
 extern profiler profiles[NUM_PROFILES];
 #endif
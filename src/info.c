@@ -76,6 +76,12 @@ char score_run_path[4096];
 */
 /*@null@*/ str_link* score_args_tail = NULL;
 
+/*!
+ File position of the design fingerprint field in the information line last written by info_db_write
+ (or -1 if the position is not known).
+*/
+static long info_fingerprint_pos = -1;
+
 
 /*!
  *  Adds the specified argument to the list of score arguments that will be written to the CDD file.
@@ -158,7 +164,8 @@ void info_set_scored() { PROFILE(INFO_SET_SCORED);
 }
 
 /*!
- Writes information line to specified file.
+ Writes information line to specified file.  The design fingerprint field is written as 0 and is filled in
+ by info_db_write_fingerprint once the rest of the design has been written.
 */
 void info_db_write(
   FILE* file  /*!< Pointer to file to write information to */
@@ -172,7 +179,7 @@ void info_db_write(
   info_set_vector_elem_size();
 
   /*@-formattype -formatcode -duplicatequals@*/
-  fprintf( file, "%d %x %" FMT32 "x %" FMT64 "u %u %x %s\n",
+  fprintf( file, "%d %x %" FMT32 "x %" FMT64 "u %u %x %s ",
            DB_TYPE_INFO,
            CDD_VERSION,
            info_suppl.all,
@@ -182,6 +189,10 @@ void info_db_write(
            db_list[curr_db]->leading_hierarchies[0] );
   /*@=formattype =formatcode =duplicatequals@*/
 
+  /* Write a fixed-width placeholder for the design fingerprint so that it can be overwritten in place */
+  info_fingerprint_pos = ftell( file );
+  fprintf( file, "%016x\n", 0 );
+
   /* Display score arguments */
   fprintf( file, "%d %s", DB_TYPE_SCORE_ARGS, score_run_path );
 
@@ -236,6 +247,30 @@ void info_db_write(
 
 }
 
+/*!
+ Overwrites the design fingerprint field of the information line last written to the given file by
+ info_db_write with the given fingerprint.  If the file is not seekable, the fingerprint is left as 0 (unknown).
+*/
+void info_db_write_fingerprint(
+  FILE*  file,        /*!< Pointer to file that the information line was written to */
+  uint64 fingerprint  /*!< Design fingerprint of the written design */
+) { PROFILE(INFO_DB_WRITE_FINGERPRINT);
+
+  long end_pos = ftell( file );
+
+  if( (info_fingerprint_pos >= 0) && (end_pos >= 0) && (fseek( file, info_fingerprint_pos, SEEK_SET ) == 0) ) {
+    /*@-formattype@*/
+    fprintf( file, "%016" FMT64 "x", fingerprint );
+    /*@=formattype@*/
+    (void)fseek( file, end_pos, SEEK_SET );
+  }
+
+  info_fingerprint_pos = -1;
+
+  PROFILE_END;
+
+}
+
 /*!
  \throws anonymous Throw Throw Throw
 
@@ -276,7 +311,7 @@ bool info_db_read(
       *line = *line + chars_read;
 
       /* If this CDD contains useful information, continue on */
-      if( (info.part.scored != 0) || (read_mode != READ_MODE_MERGE_NO_MERGE) ) {
+      if( (info.part.scored != 0) || ((read_mode != READ_MODE_MERGE_NO_MERGE) && (read_mode != READ_MODE_MERGE_HEADER) && (read_mode != READ_MODE_MERGE_STREAM)) ) {
 
         /* Create a new database element */
         (void)db_create();
@@ -332,6 +367,121 @@ bool info_db_read(
 
 }
 
+/*!
+ \return Returns TRUE if the specified CDD file contains scored data; otherwise, returns FALSE.
+
+ Reads the information line of the specified CDD file and retrieves its design fingerprint and number of instances.
+ If the CDD file could not be read or does not contain a fingerprint, the fingerprint is set to 0.  If the root
+ instance or merged indicator is requested, the header lines of the CDD file are read up to the first functional unit
+ of the first instance tree (the $root functional unit is skipped) to retrieve them.  None of the current database
+ information is modified.
+*/
+bool info_read_fingerprint(
+            const char*   file,         /*!< Name of CDD file to read */
+  /*@out@*/ uint64*       fingerprint,  /*!< Pointer to the read design fingerprint */
+  /*@out@*/ unsigned int* inst_num,     /*!< If not NULL, set to the number of instances in the CDD file */
+  /*@out@*/ char*         root_funit,   /*!< If not NULL, set to the name of the functional unit of the root instance (4096 bytes) */
+  /*@out@*/ char*         root_scope,   /*!< If not NULL, set to the scope of the root instance of the CDD file (4096 bytes) */
+  /*@out@*/ bool*         merged        /*!< If not NULL, set to TRUE if the CDD file was created by merging other CDD files */
+) { PROFILE(INFO_READ_FINGERPRINT);
+
+  FILE* handle;
+  bool  scored = FALSE;
+
+  *fingerprint = 0;
+  if( inst_num != NULL ) {
+    *inst_num = 0;
+  }
+  if( root_funit != NULL ) {
+    root_funit[0] = '\0';
+  }
+  if( root_scope != NULL ) {
+    root_scope[0] = '\0';
+  }
+  if( merged != NULL ) {
+    *merged = FALSE;
+  }
+
+  if( (handle = fopen( file, "r" )) != NULL ) {
+
+    char*        line = NULL;
+    unsigned int line_size;
+    unsigned int rv;
+
+    if( util_readline( handle, &line, &line_size ) ) {
+
+      int          type;
+      unsigned int version;
+      isuppl       info;
+      uint64       timesteps;
+      unsigned int num_insts;
+      unsigned int depth;
+      char         tmp[4096];
+      uint64       fp;
+
+      /*@-formattype -formatcode -duplicatequals@*/
+      int num = sscanf( line, "%d %x %" FMT32 "x %" FMT64 "u %u %x %s %" FMT64 "x", &type, &version, &(info.all), &timesteps, &num_insts, &depth, tmp, &fp );
+      /*@=formattype =formatcode =duplicatequals@*/
+
+      if( (num >= 7) && (type == DB_TYPE_INFO) && (version == CDD_VERSION) ) {
+
+        scored = (info.part.scored != 0);
+        if( num == 8 ) {
+          *fingerprint = fp;
+        }
+        if( inst_num != NULL ) {
+          *inst_num = num_insts;
+        }
+
+        /* Find the root instance and merged CDD lines in the header of the CDD file */
+        if( (root_funit != NULL) || (root_scope != NULL) || (merged != NULL) ) {
+          bool done = FALSE;
+          while( !done && util_readline( handle, &line, &line_size ) ) {
+            int chars_read;
+            if( sscanf( line, "%d%n", &type, &chars_read ) == 1 ) {
+              if( type == DB_TYPE_MERGED_CDD ) {
+                if( merged != NULL ) {
+                  *merged = TRUE;
+                }
+              } else if( type == DB_TYPE_FUNIT ) {
+                uint32 suppl;
+                char   scope[4096];
+                /*@-formattype@*/
+                if( (sscanf( (line + chars_read), "%" FMT32 "x %s \"%4095[^\"]\"", &suppl, tmp, scope ) == 3) && (strcmp( tmp, "$root" ) != 0) ) {
+                /*@=formattype@*/
+                  if( root_funit != NULL ) {
+                    strcpy( root_funit, tmp );
+                  }
+                  if( root_scope != NULL ) {
+                    strcpy( root_scope, scope );
+                  }
+                  done = TRUE;
+                }
+              }
+            }
+          }
+        }
+
+      }
+
+      /* The line buffer is shared by all of the lines read (util_readline deallocates it at the end of the file) */
+      if( line != NULL ) {
+        free_safe( line, line_size );
+      }
+
+    }
+
+    rv = fclose( handle );
+    assert( rv == 0 );
+
+  }
+
+  PROFILE_END;
+
+  return( scored );
+
+}
+
 /*!
  \throws anonymous Throw
 
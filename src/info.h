@@ -40,12 +40,28 @@ void info_db_write(
   FILE* file
 );
 
+/*! \brief Fills in the design fingerprint of the info line last written to the specified CDD file. */
+void info_db_write_fingerprint(
+  FILE*  file,
+  uint64 fingerprint
+);
+
 /*! \brief Reads info line from specified line and stores information. */
 bool info_db_read(
   char** line,
   int    read_mode
 );
 
+/*! \brief Reads the design fingerprint from the info line of the specified CDD file. */
+bool info_read_fingerprint(
+  const char*   file,
+  uint64*       fingerprint,
+  unsigned int* inst_num,
+  char*         root_funit,
+  char*         root_scope,
+  bool*         merged
+);
+
 /*! \brief Reads score args line from specified line and stores information. */
 void args_db_read(
   char** line
@@ -31,15 +31,22 @@
 #include <assert.h>
 
 #include "arc.h"
+#include "assertion.h"
 #include "db.h"
 #include "defines.h"
 #include "expr.h"
+#include "fsm.h"
 #include "func_unit.h"
 #include "gen_item.h"
 #include "instance.h"
+#include "line.h"
 #include "link.h"
+#include "memory.h"
+#include "ovl.h"
 #include "param.h"
+#include "stat.h"
 #include "static.h"
+#include "toggle.h"
 #include "util.h"
 
 
@@ -48,6 +55,7 @@ extern db**         db_list;
 extern unsigned int curr_db;
 extern char         user_msg[USER_MSG_LENGTH];
 extern bool         debug_mode;
+extern isuppl       info_suppl;
 
 
 /*!
@@ -55,6 +63,30 @@ extern bool         debug_mode;
 */
 int curr_sig_id = 1;
 
+/*!
+ Parent instance of each slot in the child map.  While generate items are being resolved, the child map
+ maps a parent instance and a child instance name to the first child of that parent with that name so that
+ large generate loops do not need to scan every sibling of each instance that they add.
+*/
+static funit_inst** child_map_parents = NULL;
+
+/*!
+ Child instance stored in each slot of the child map (NULL if the slot is empty).  A slot whose child is
+ the same as its parent marks that all of the children of that parent have been added to the map.
+*/
+static funit_inst** child_map_insts = NULL;
+
+/*!
+ Number of slots in the child_map_parents and child_map_insts arrays (always a power of two).  Set to 0
+ when the child map is not in use.
+*/
+static unsigned int child_map_size = 0;
+
+/*!
+ Number of used slots in the child map.
+*/
+static unsigned int child_map_num = 0;
+
 
 static bool instance_resolve_inst( funit_inst*, funit_inst* );
 static void instance_dealloc_single( funit_inst* );
@@ -149,7 +181,10 @@ funit_inst* instance_create(
   new_inst->suppl.name_diff  = name_diff;
   new_inst->suppl.ignore     = ignore;
   new_inst->suppl.gend_scope = gend_scope;
+  new_inst->suppl.stat_stored   = 0;
+  new_inst->suppl.stat_gathered = 0;
   new_inst->stat             = NULL;
+  new_inst->stored_stat      = NULL;
   new_inst->param_head       = NULL;
   new_inst->param_tail       = NULL;
   new_inst->gitem_head       = NULL;
@@ -388,6 +423,314 @@ funit_inst* instance_find_scope(
 
 }
 
+/*!
+ \return Returns the hash value of the given parent instance and printable child name pair.
+*/
+static uint32 instance_index_hash(
+  const funit_inst* parent,  /*!< Pointer to parent instance (NULL for top-level instances) */
+  const char*       pname    /*!< Printable name of child instance */
+) { PROFILE(INSTANCE_INDEX_HASH);
+
+  uint32 hash = util_hash_string( util_hash( HASH_INIT, &parent, sizeof( funit_inst* ) ), pname );
+
+  PROFILE_END;
+
+  return( hash );
+
+}
+
+/*!
+ Stores the given entry in the first empty slot of the specified instance index, starting at the slot
+ selected by its hash value.  The table must have at least one empty slot.
+*/
+static void instance_index_insert(
+  inst_index*  index,   /*!< Pointer to instance index to insert into */
+  funit_inst*  parent,  /*!< Pointer to parent instance (NULL for top-level instances) */
+  funit_inst*  inst,    /*!< Pointer to child instance */
+  char*        pname,   /*!< Printable name of child instance (ownership is passed to the index) */
+  uint32       hash,    /*!< Hash value of the parent/name pair */
+  uint8        kind     /*!< Specifies how the child is reached from its parent */
+) { PROFILE(INSTANCE_INDEX_INSERT);
+
+  unsigned int slot = hash & (index->size - 1);
+
+  while( index->insts[slot] != NULL ) {
+    slot = (slot + 1) & (index->size - 1);
+  }
+
+  index->parents[slot] = parent;
+  index->insts[slot]   = inst;
+  index->names[slot]   = pname;
+  index->hashes[slot]  = hash;
+  index->kinds[slot]   = kind;
+
+  PROFILE_END;
+
+}
+
+/*!
+ Adds the given child instance to the specified instance index under the given parent instance.  The
+ table is doubled in size when it becomes half full.
+*/
+static void instance_index_add(
+  inst_index* index,   /*!< Pointer to instance index to add to */
+  funit_inst* parent,  /*!< Pointer to parent instance (NULL for top-level instances) */
+  funit_inst* inst,    /*!< Pointer to child instance to add */
+  uint8       kind     /*!< Specifies how the child is reached from its parent */
+) { PROFILE(INSTANCE_INDEX_ADD);
+
+  char* pname = scope_gen_printable( inst->name );
+
+  /* Grow the table (rehashing all current entries) if it is half full */
+  if( ((index->num + 1) * 2) > index->size ) {
+
+    funit_inst** old_parents = index->parents;
+    funit_inst** old_insts   = index->insts;
+    char**       old_names   = index->names;
+    uint32*      old_hashes  = index->hashes;
+    uint8*       old_kinds   = index->kinds;
+    unsigned int old_size    = index->size;
+    unsigned int i;
+
+    index->size    = (old_size == 0) ? 64 : (old_size * 2);
+    index->parents = (funit_inst**)malloc_safe_nolimit( sizeof( funit_inst* ) * index->size );
+    index->insts   = (funit_inst**)malloc_safe_nolimit( sizeof( funit_inst* ) * index->size );
+    index->names   = (char**)malloc_safe_nolimit( sizeof( char* ) * index->size );
+    index->hashes  = (uint32*)malloc_safe_nolimit( sizeof( uint32 ) * index->size );
+    index->kinds   = (uint8*)malloc_safe_nolimit( sizeof( uint8 ) * index->size );
+
+    for( i=0; i<index->size; i++ ) {
+      index->insts[i] = NULL;
+    }
+
+    for( i=0; i<old_size; i++ ) {
+      if( old_insts[i] != NULL ) {
+        instance_index_insert( index, old_parents[i], old_insts[i], old_names[i], old_hashes[i], old_kinds[i] );
+      }
+    }
+
+    free_safe( old_parents, (sizeof( funit_inst* ) * old_size) );
+    free_safe( old_insts,   (sizeof( funit_inst* ) * old_size) );
+    free_safe( old_names,   (sizeof( char* ) * old_size) );
+    free_safe( old_hashes,  (sizeof( uint32 ) * old_size) );
+    free_safe( old_kinds,   (sizeof( uint8 ) * old_size) );
+
+  }
+
+  instance_index_insert( index, parent, inst, pname, instance_index_hash( parent, pname ), kind );
+  index->num++;
+
+  PROFILE_END;
+
+}
+
+/*!
+ Adds the given instance to the specified instance index as a candidate match for scopes below the given
+ parent instance.  Unnamed scopes are made transparent in the same way as instance_find_scope does when
+ it removes unnamed scopes:  the unnamed instance itself is only added when it is a direct child of the
+ parent, and its named descendants are added as if they were children of the parent.
+*/
+static void instance_index_add_candidate(
+  inst_index* index,   /*!< Pointer to instance index to add to */
+  funit_inst* parent,  /*!< Pointer to parent instance (NULL for top-level instances) */
+  funit_inst* inst,    /*!< Pointer to candidate instance */
+  bool        thru     /*!< Set to TRUE if inst was reached from parent through an unnamed scope */
+) { PROFILE(INSTANCE_INDEX_ADD_CANDIDATE);
+
+  if( funit_is_unnamed( inst->funit ) ) {
+
+    funit_inst* child = inst->child_head;
+
+    if( !thru ) {
+      instance_index_add( index, parent, inst, INST_INDEX_UNNAMED );
+    }
+
+    while( child != NULL ) {
+      instance_index_add_candidate( index, parent, child, TRUE );
+      child = child->next;
+    }
+
+  } else {
+
+    instance_index_add( index, parent, inst, (thru ? INST_INDEX_THRU_UNNAMED : INST_INDEX_NAMED) );
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Recursively adds the children of every instance in the given instance tree to the specified instance index.
+*/
+static void instance_index_add_tree(
+  inst_index* index,  /*!< Pointer to instance index to add to */
+  funit_inst* root    /*!< Pointer to root of instance tree to add */
+) { PROFILE(INSTANCE_INDEX_ADD_TREE);
+
+  funit_inst* child = root->child_head;
+
+  while( child != NULL ) {
+    instance_index_add_candidate( index, root, child, FALSE );
+    instance_index_add_tree( index, child );
+    child = child->next;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to the newly allocated instance index.
+
+ Creates an index of every instance tree in the given instance list that maps each instance and the name
+ of one of its child scopes to the matching child instance.  This allows a dumpfile scope to be resolved
+ one level at a time from the instance that its parent scope resolved to.
+*/
+inst_index* instance_index_create(
+  inst_link* head  /*!< Pointer to head of instance list to index */
+) { PROFILE(INSTANCE_INDEX_CREATE);
+
+  inst_index* index = (inst_index*)malloc_safe( sizeof( inst_index ) );
+  inst_link*  instl = head;
+
+  index->parents = NULL;
+  index->insts   = NULL;
+  index->names   = NULL;
+  index->hashes  = NULL;
+  index->kinds   = NULL;
+  index->size    = 0;
+  index->num     = 0;
+
+  while( instl != NULL ) {
+    instance_index_add_candidate( index, NULL, instl->inst, FALSE );
+    instance_index_add_tree( index, instl->inst );
+    instl = instl->next;
+  }
+
+  PROFILE_END;
+
+  return( index );
+
+}
+
+/*!
+ Looks up the given printable name under the given parent instance in the specified index, updating the
+ match information for each entry that instance_find_scope would also match.
+*/
+static void instance_index_lookup(
+            const inst_index* index,    /*!< Pointer to instance index to search */
+            const funit_inst* parent,   /*!< Pointer to parent instance (NULL for top-level instances) */
+            const char*       pname,    /*!< Printable name to search for */
+            char*             name,     /*!< Scope name being resolved */
+            bool              unnamed,  /*!< Set to TRUE if name is an unnamed scope name */
+  /*@out@*/ funit_inst**      inst,     /*!< Set to the matching instance */
+  /*@out@*/ unsigned int*     matches   /*!< Incremented for each distinct matching instance */
+) { PROFILE(INSTANCE_INDEX_LOOKUP);
+
+  uint32       hash = instance_index_hash( parent, pname );
+  unsigned int slot = hash & (index->size - 1);
+
+  while( index->insts[slot] != NULL ) {
+    if( (index->parents[slot] == parent) && (index->hashes[slot] == hash) && (strcmp( index->names[slot], pname ) == 0) &&
+        (index->kinds[slot] != (unnamed ? INST_INDEX_THRU_UNNAMED : INST_INDEX_UNNAMED)) &&
+        (index->insts[slot] != *inst) && instance_compare( name, index->insts[slot] ) ) {
+      *inst = index->insts[slot];
+      (*matches)++;
+    }
+    slot = (slot + 1) & (index->size - 1);
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if the given scope name could be resolved with the index; otherwise, returns FALSE
+         and the caller must search for the full scope with instance_find_scope instead.
+
+ Finds the child instance of the given parent instance that matches the given single level scope name,
+ using the same matching rules as instance_find_scope with unnamed scopes removed (including instance
+ array indices).  If the name spans more than one scope level or more than one instance matches it, the
+ first match found by a depth-first search may not be a child of the given parent, so FALSE is returned.
+*/
+bool instance_index_find(
+            const inst_index* index,   /*!< Pointer to instance index to search */
+            const funit_inst* parent,  /*!< Pointer to instance that the parent scope resolved to (NULL for a top-level scope) */
+            char*             name,    /*!< Name of the scope level to resolve */
+  /*@out@*/ funit_inst**      inst     /*!< Set to the matching child instance (NULL if no instance matches) */
+) { PROFILE(INSTANCE_INDEX_FIND);
+
+  bool retval = FALSE;
+
+  *inst = NULL;
+
+  if( (name[0] != '\0') && (strchr( name, '.' ) == NULL) && (strlen( name ) < 256) ) {
+
+    bool         unnamed = db_is_unnamed_scope( name );
+    unsigned int matches = 0;
+    char         bname[4096];
+    int          index_val;
+
+    if( index->num > 0 ) {
+
+      char* pname = scope_gen_printable( name );
+
+      instance_index_lookup( index, parent, pname, name, unnamed, inst, &matches );
+
+      /* If the name refers to an element of an instance array, also look for the array instance */
+      if( sscanf( name, "%[a-zA-Z0-9_]\[%d]", bname, &index_val ) == 2 ) {
+        char* pbname = scope_gen_printable( bname );
+        if( strcmp( pbname, pname ) != 0 ) {
+          instance_index_lookup( index, parent, pbname, name, unnamed, inst, &matches );
+        }
+        free_safe( pbname, (strlen( pbname ) + 1) );
+      }
+
+      free_safe( pname, (strlen( pname ) + 1) );
+
+    }
+
+    retval = (matches <= 1);
+
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ Deallocates all memory associated with the given instance index.
+*/
+void instance_index_dealloc(
+  inst_index* index  /*!< Pointer to instance index to deallocate */
+) { PROFILE(INSTANCE_INDEX_DEALLOC);
+
+  if( index != NULL ) {
+
+    unsigned int i;
+
+    for( i=0; i<index->size; i++ ) {
+      if( index->insts[i] != NULL ) {
+        free_safe( index->names[i], (strlen( index->names[i] ) + 1) );
+      }
+    }
+
+    free_safe( index->parents, (sizeof( funit_inst* ) * index->size) );
+    free_safe( index->insts,   (sizeof( funit_inst* ) * index->size) );
+    free_safe( index->names,   (sizeof( char* ) * index->size) );
+    free_safe( index->hashes,  (sizeof( uint32 ) * index->size) );
+    free_safe( index->kinds,   (sizeof( uint8 ) * index->size) );
+    free_safe( index, sizeof( inst_index ) );
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  \return Returns pointer to functional unit instance found by scope.
  
@@ -614,6 +957,157 @@ int instance_find_fsm_arc_index_by_exclusion_id(
 
 }
 
+/*!
+ \return Returns the slot in the child map that contains the given parent/name pair or the empty slot
+         that the pair would be stored in.
+*/
+static unsigned int instance_child_map_slot(
+  const funit_inst* parent,  /*!< Pointer to parent instance */
+  const char*       name     /*!< Name of child instance to find (NULL to find the marker slot of the parent) */
+) { PROFILE(INSTANCE_CHILD_MAP_SLOT);
+
+  uint32       hash = util_hash( HASH_INIT, &parent, sizeof( funit_inst* ) );
+  unsigned int slot;
+
+  if( name != NULL ) {
+    hash = util_hash_string( hash, name );
+  }
+
+  slot = hash & (child_map_size - 1);
+
+  while( (child_map_insts[slot] != NULL) &&
+         ((child_map_parents[slot] != parent) ||
+          ((name == NULL) ? (child_map_insts[slot] != parent) : ((child_map_insts[slot] == parent) || (strcmp( child_map_insts[slot]->name, name ) != 0)))) ) {
+    slot = (slot + 1) & (child_map_size - 1);
+  }
+
+  PROFILE_END;
+
+  return( slot );
+
+}
+
+/*!
+ Adds the given child instance of the given parent to the child map unless the parent already has a child
+ with the same name in the map.  If child is the same as parent, the marker slot of the parent is added.
+*/
+static void instance_child_map_add(
+  funit_inst* parent,  /*!< Pointer to parent instance */
+  funit_inst* child    /*!< Pointer to child instance to add */
+) { PROFILE(INSTANCE_CHILD_MAP_ADD);
+
+  unsigned int slot;
+
+  /* Grow the table (rehashing all current entries) if it is half full */
+  if( ((child_map_num + 1) * 2) > child_map_size ) {
+
+    funit_inst** old_parents = child_map_parents;
+    funit_inst** old_insts   = child_map_insts;
+    unsigned int old_size    = child_map_size;
+    unsigned int i;
+
+    child_map_size    = old_size * 2;
+    child_map_parents = (funit_inst**)malloc_safe_nolimit( sizeof( funit_inst* ) * child_map_size );
+    child_map_insts   = (funit_inst**)malloc_safe_nolimit( sizeof( funit_inst* ) * child_map_size );
+
+    for( i=0; i<child_map_size; i++ ) {
+      child_map_insts[i] = NULL;
+    }
+
+    for( i=0; i<old_size; i++ ) {
+      if( old_insts[i] != NULL ) {
+        slot = instance_child_map_slot( old_parents[i], ((old_insts[i] == old_parents[i]) ? NULL : old_insts[i]->name) );
+        child_map_parents[slot] = old_parents[i];
+        child_map_insts[slot]   = old_insts[i];
+      }
+    }
+
+    free_safe( old_parents, (sizeof( funit_inst* ) * old_size) );
+    free_safe( old_insts,   (sizeof( funit_inst* ) * old_size) );
+
+  }
+
+  slot = instance_child_map_slot( parent, ((child == parent) ? NULL : child->name) );
+
+  if( child_map_insts[slot] == NULL ) {
+    child_map_parents[slot] = parent;
+    child_map_insts[slot]   = child;
+    child_map_num++;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to the first child of the given parent instance with the given name if one exists;
+         otherwise, returns NULL.
+
+ Adds all current children of the given parent to the child map if this has not already been done.
+*/
+static funit_inst* instance_child_map_find(
+  funit_inst* parent,  /*!< Pointer to parent instance */
+  const char* name     /*!< Name of child instance to find */
+) { PROFILE(INSTANCE_CHILD_MAP_FIND);
+
+  funit_inst* child;
+
+  if( child_map_insts[instance_child_map_slot( parent, NULL )] == NULL ) {
+    instance_child_map_add( parent, parent );
+    child = parent->child_head;
+    while( child != NULL ) {
+      instance_child_map_add( parent, child );
+      child = child->next;
+    }
+  }
+
+  child = child_map_insts[instance_child_map_slot( parent, name )];
+
+  PROFILE_END;
+
+  return( child );
+
+}
+
+/*!
+ Starts using the child map to find existing child instances when instances are added.  While the child map
+ is in use, instance names must not change and child instances may only be added by instance_add_child.
+*/
+void instance_child_map_create() { PROFILE(INSTANCE_CHILD_MAP_CREATE);
+
+  unsigned int i;
+
+  assert( child_map_size == 0 );
+
+  child_map_size    = 256;
+  child_map_parents = (funit_inst**)malloc_safe_nolimit( sizeof( funit_inst* ) * child_map_size );
+  child_map_insts   = (funit_inst**)malloc_safe_nolimit( sizeof( funit_inst* ) * child_map_size );
+
+  for( i=0; i<child_map_size; i++ ) {
+    child_map_insts[i] = NULL;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Stops using the child map and deallocates its memory.
+*/
+void instance_child_map_dealloc() { PROFILE(INSTANCE_CHILD_MAP_DEALLOC);
+
+  free_safe( child_map_parents, (sizeof( funit_inst* ) * child_map_size) );
+  free_safe( child_map_insts,   (sizeof( funit_inst* ) * child_map_size) );
+
+  child_map_parents = NULL;
+  child_map_insts   = NULL;
+  child_map_size    = 0;
+  child_map_num     = 0;
+
+  PROFILE_END;
+
+}
+
 /*!
  \return Returns pointer to newly created functional unit instance if this instance name isn't already in
          use in the current instance; otherwise, returns NULL.
@@ -635,8 +1129,8 @@ static funit_inst* instance_add_child(
 
   funit_inst* new_inst;  /* Pointer to newly created instance to add */
 
-  /* Check to see if this instance already exists */
-  new_inst = inst->child_head;
+  /* Check to see if this instance already exists (the child map skips all children with a different name) */
+  new_inst = (child_map_size > 0) ? instance_child_map_find( inst, name ) : inst->child_head;
   while( (new_inst != NULL) && ((strcmp( new_inst->name, name ) != 0) || (new_inst->funit != child)) ) {
     new_inst = new_inst->next;
   }
@@ -667,6 +1161,10 @@ static funit_inst* instance_add_child(
       }
     }
 
+    if( child_map_size > 0 ) {
+      instance_child_map_add( inst, new_inst );
+    }
+
   } else {
 
     /* Set the ignore value in the instance to FALSE */
@@ -1291,7 +1789,8 @@ void instance_db_write(
   FILE*         file,        /*!< Output file to display contents to */
   char*         scope,       /*!< Scope of this functional unit */
   bool          parse_mode,  /*!< Specifies if we are parsing or scoring */
-  bool          issue_ids    /*!< Specifies that we need to issue expression and signal IDs */
+  bool          issue_ids,   /*!< Specifies that we need to issue expression and signal IDs */
+  uint64*       fingerprint  /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(INSTANCE_DB_WRITE);
 
   bool stop_recursive = FALSE;
@@ -1339,8 +1838,17 @@ void instance_db_write(
       }
 #endif /* RUNLIB */
 
+      /*
+       Fold the instance name into the design fingerprint.  The name of a top-level instance is its place in the
+       testbench hierarchy, so it is left out so that the same design instantiated under a different testbench has the
+       same fingerprint.
+      */
+      if( root->parent != NULL ) {
+        *fingerprint = util_hash64_string( *fingerprint, root->name );
+      }
+
       /* Display root functional unit */
-      funit_db_write( root->funit, scope, root->suppl.name_diff, file, curr, issue_ids );
+      funit_db_write( root->funit, scope, root->suppl.name_diff, file, curr, issue_ids, fingerprint );
 
     } else {
 
@@ -1350,6 +1858,9 @@ void instance_db_write(
 
   } else {
 
+    /* Instance-only placeholders form the leading hierarchy, so only their position is part of the design fingerprint */
+    *fingerprint = util_hash64_uint32( *fingerprint, DB_TYPE_INST_ONLY );
+
     /*@-formatcode@*/
     fprintf( file, "%d %s %hhu\n", DB_TYPE_INST_ONLY, scope, root->suppl.name_diff );
     /*@=formatcode@*/
@@ -1365,7 +1876,7 @@ void instance_db_write(
     while( curr != NULL ) {
       unsigned int rv = snprintf( tscope, 4096, "%s.%s", scope, curr->name );
       assert( rv < 4096 );
-      instance_db_write( curr, file, tscope, parse_mode, issue_ids );
+      instance_db_write( curr, file, tscope, parse_mode, issue_ids, fingerprint );
       curr = curr->next;
     }
 
@@ -1504,6 +2015,162 @@ void instance_only_db_merge(
 
 }
 
+#ifndef VPI_ONLY
+/*!
+ Writes the summary line, toggle, memory, FSM and assertion statistics of the given instance tree to the
+ specified CDD file so that the report command does not need to recalculate them when reading the file.
+ Combinational logic and race condition statistics depend on report options and are not stored.
+*/
+void instance_db_write_stats(
+  funit_inst* root,  /*!< Root of functional unit instance tree to write statistics for */
+  FILE*       file,  /*!< Output file to display contents to */
+  char*       scope  /*!< Scope of this functional unit */
+) { PROFILE(INSTANCE_DB_WRITE_STATS);
+
+  funit_inst* curr;
+  char        tscope[4096];
+
+  assert( root != NULL );
+
+  if( root->funit != NULL ) {
+
+    if( (root->funit->suppl.part.type == FUNIT_NO_SCORE) || root->suppl.ignore ) {
+      PROFILE_END;
+      return;
+    }
+
+    /* OVL assertion modules do not get coverage statistics so there is nothing to store for them */
+    if( (info_suppl.part.assert_ovl == 0) || !ovl_is_assertion_module( root->funit ) ) {
+
+      statistic* stat = NULL;
+
+      statistic_create( &stat );
+
+      if( info_suppl.part.scored_line == 1 ) {
+        line_get_stats( root->funit, &(stat->line_hit), &(stat->line_excluded), &(stat->line_total) );
+      }
+      if( info_suppl.part.scored_toggle == 1 ) {
+        toggle_get_stats( root->funit, &(stat->tog01_hit), &(stat->tog10_hit), &(stat->tog_excluded), &(stat->tog_total), &(stat->tog_cov_found) );
+      }
+      if( info_suppl.part.scored_fsm == 1 ) {
+        fsm_get_stats( root->funit->fsms, root->funit->fsm_size, &(stat->state_hit), &(stat->state_total), &(stat->arc_hit), &(stat->arc_total), &(stat->arc_excluded) );
+      }
+      if( info_suppl.part.scored_assert == 1 ) {
+        assertion_get_stats( root->funit, &(stat->assert_hit), &(stat->assert_excluded), &(stat->assert_total) );
+      }
+      if( info_suppl.part.scored_memory == 1 ) {
+        memory_get_stats( root->funit, &(stat->mem_wr_hit), &(stat->mem_rd_hit), &(stat->mem_ae_total), &(stat->mem_tog01_hit),
+                          &(stat->mem_tog10_hit), &(stat->mem_tog_total), &(stat->mem_excluded), &(stat->mem_cov_found) );
+      }
+
+      /*@-formatcode@*/
+      fprintf( file, "%d %s %u %u %u %u %u %u %u %d %d %d %d %d %d %u %u %u %u %u %u %u %u %u %d %u\n",
+               DB_TYPE_INST_STATS, scope,
+               stat->line_hit, stat->line_excluded, stat->line_total,
+               stat->tog01_hit, stat->tog10_hit, stat->tog_excluded, stat->tog_total, (stat->tog_cov_found ? 1 : 0),
+               stat->state_hit, stat->state_total, stat->arc_hit, stat->arc_total, stat->arc_excluded,
+               stat->assert_hit, stat->assert_excluded, stat->assert_total,
+               stat->mem_wr_hit, stat->mem_rd_hit, stat->mem_ae_total, stat->mem_tog01_hit, stat->mem_tog10_hit, stat->mem_tog_total,
+               (stat->mem_cov_found ? 1 : 0), stat->mem_excluded );
+      /*@=formatcode@*/
+
+      statistic_dealloc( stat );
+
+    }
+
+  }
+
+  /* Display children */
+  curr = root->child_head;
+  while( curr != NULL ) {
+    unsigned int rv = snprintf( tscope, 4096, "%s.%s", scope, curr->name );
+    assert( rv < 4096 );
+    instance_db_write_stats( curr, file, tscope );
+    curr = curr->next;
+  }
+
+  PROFILE_END;
+
+}
+
+#endif /* VPI_ONLY */
+
+/*!
+ \throws anonymous Throw
+
+ Parses an instance statistics line from the database file and stores the statistics in the matching
+ instance of the current database.  The stored statistics are used by each statistic gathering performed
+ by the report command in place of recalculating them until the coverage or exclusions of the instance's
+ module change.
+*/
+void instance_db_read_stats(
+  char** line  /*!< Pointer to line being read from database file */
+) { PROFILE(INSTANCE_DB_READ_STATS);
+
+  char        scope[4096];
+  statistic   tmp;
+  int         tog_cov_found;
+  int         mem_cov_found;
+  int         chars_read;
+  funit_inst* inst;
+
+  /*@-formatcode@*/
+  if( sscanf( *line, "%s %u %u %u %u %u %u %u %d %d %d %d %d %d %u %u %u %u %u %u %u %u %u %d %u%n", scope,
+              &(tmp.line_hit), &(tmp.line_excluded), &(tmp.line_total),
+              &(tmp.tog01_hit), &(tmp.tog10_hit), &(tmp.tog_excluded), &(tmp.tog_total), &tog_cov_found,
+              &(tmp.state_hit), &(tmp.state_total), &(tmp.arc_hit), &(tmp.arc_total), &(tmp.arc_excluded),
+              &(tmp.assert_hit), &(tmp.assert_excluded), &(tmp.assert_total),
+              &(tmp.mem_wr_hit), &(tmp.mem_rd_hit), &(tmp.mem_ae_total), &(tmp.mem_tog01_hit), &(tmp.mem_tog10_hit), &(tmp.mem_tog_total),
+              &mem_cov_found, &(tmp.mem_excluded), &chars_read ) == 25 ) {
+  /*@=formatcode@*/
+
+    *line += chars_read;
+
+    /* If the instance is not found, the statistics are simply recalculated by the report command */
+    if( (inst = inst_link_find_by_scope( scope, db_list[curr_db]->inst_head, FALSE )) != NULL ) {
+
+      statistic_create( &(inst->stored_stat) );
+
+      inst->stored_stat->line_hit        = tmp.line_hit;
+      inst->stored_stat->line_excluded   = tmp.line_excluded;
+      inst->stored_stat->line_total      = tmp.line_total;
+      inst->stored_stat->tog01_hit       = tmp.tog01_hit;
+      inst->stored_stat->tog10_hit       = tmp.tog10_hit;
+      inst->stored_stat->tog_excluded    = tmp.tog_excluded;
+      inst->stored_stat->tog_total       = tmp.tog_total;
+      inst->stored_stat->tog_cov_found   = (tog_cov_found == 1);
+      inst->stored_stat->state_hit       = tmp.state_hit;
+      inst->stored_stat->state_total     = tmp.state_total;
+      inst->stored_stat->arc_hit         = tmp.arc_hit;
+      inst->stored_stat->arc_total       = tmp.arc_total;
+      inst->stored_stat->arc_excluded    = tmp.arc_excluded;
+      inst->stored_stat->assert_hit      = tmp.assert_hit;
+      inst->stored_stat->assert_excluded = tmp.assert_excluded;
+      inst->stored_stat->assert_total    = tmp.assert_total;
+      inst->stored_stat->mem_wr_hit      = tmp.mem_wr_hit;
+      inst->stored_stat->mem_rd_hit      = tmp.mem_rd_hit;
+      inst->stored_stat->mem_ae_total    = tmp.mem_ae_total;
+      inst->stored_stat->mem_tog01_hit   = tmp.mem_tog01_hit;
+      inst->stored_stat->mem_tog10_hit   = tmp.mem_tog10_hit;
+      inst->stored_stat->mem_tog_total   = tmp.mem_tog_total;
+      inst->stored_stat->mem_cov_found   = (mem_cov_found == 1);
+      inst->stored_stat->mem_excluded    = tmp.mem_excluded;
+
+      inst->suppl.stat_stored = 1;
+
+    }
+
+  } else {
+
+    print_output( "Unable to read instance statistics line in database file.", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  Removes all statement blocks in the design that call that specified statement.
 */
@@ -1598,8 +2265,9 @@ void instance_dealloc_single(
     /* Free up memory allocated for name */
     free_safe( inst->name, (strlen( inst->name ) + 1) );
 
-    /* Free up memory allocated for statistic, if necessary */
+    /* Free up memory allocated for statistics, if necessary */
     free_safe( inst->stat, sizeof( statistic ) );
+    free_safe( inst->stored_stat, sizeof( statistic ) );
 
     /* Free up memory for range, if necessary */
     if( inst->range != NULL ) {
@@ -69,6 +69,24 @@ funit_inst* instance_find_scope(
   bool        rm_unnamed
 );
 
+/*! \brief Creates an index of the child scopes of every instance in the given instance trees. */
+inst_index* instance_index_create(
+  inst_link* head
+);
+
+/*! \brief Finds the child instance matching a single scope level below the given parent instance. */
+bool instance_index_find(
+            const inst_index* index,
+            const funit_inst* parent,
+            char*             name,
+  /*@out@*/ funit_inst**      inst
+);
+
+/*! \brief Deallocates the given instance index. */
+void instance_index_dealloc(
+  inst_index* index
+);
+
 /*! \brief Returns instance that points to specified functional unit for each instance. */
 funit_inst* instance_find_by_funit(
             funit_inst*      root,
@@ -98,6 +116,12 @@ int instance_find_fsm_arc_index_by_exclusion_id(
   /*@out@*/ func_unit** found_funit
 );
 
+/*! \brief Starts using a hash map to find existing child instances when instances are added. */
+void instance_child_map_create();
+
+/*! \brief Stops using the child instance hash map and deallocates it. */
+void instance_child_map_dealloc();
+
 /*! \brief Copies the given from_inst as a child of the given to_inst */
 funit_inst* instance_copy(
   funit_inst*   from_inst,
@@ -163,7 +187,8 @@ void instance_db_write(
   FILE*       file,
   char*       scope,
   bool        parse_mode,
-  bool        issue_ids
+  bool        issue_ids,
+  uint64*     fingerprint
 );
 
 /*! \brief Reads in and handles an instance-only line from the database */
@@ -176,6 +201,18 @@ void instance_only_db_merge(
   char** line
 );
 
+/*! \brief Writes the summary coverage statistics of the given instance tree to the database */
+void instance_db_write_stats(
+  funit_inst* root,
+  FILE*       file,
+  char*       scope
+);
+
+/*! \brief Reads in an instance statistics line from the database and stores it in the matching instance */
+void instance_db_read_stats(
+  char** line
+);
+
 /*! \brief Removes all statement blocks that contain expressions that call the given statement */
 void instance_remove_stmt_blks_calling_stmt(
   funit_inst* root,
@@ -40,6 +40,7 @@
 #include "rank.h"
 #include "report.h"
 #include "score.h"
+#include "serve.h"
 #include "util.h"
 
 
@@ -95,6 +96,7 @@ static void usage() {
   printf( "      report                  Generates human-readable coverage reports from database file.\n" );
   printf( "      rank                    Generates ranked list of CDD files to run for optimal coverage in a regression run.\n" );
   printf( "      exclude                 Excludes coverage points from a given CDD and saves the modified CDD for further commands.\n" );
+  printf( "      serve                   Keeps a database file loaded and answers coverage queries from clients over a local socket.\n" );
   printf( "\n" );
   printf( "   For individual help information for each of the above commands, enter:\n" );
   printf( "      covered <command> -h\n" );
@@ -215,6 +217,11 @@ int main( int argc, const char** argv ) {
             command_exclude( argc, curr_arg, argv );
             cmd_found = TRUE;
 
+          } else if( strncmp( "serve", argv[curr_arg], 5 ) == 0 ) {
+
+            command_serve( argc, curr_arg, argv );
+            cmd_found = TRUE;
+
           } else {
 
             unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Unknown command/global option \"%s\".  Please see \"covered -h\" for usage.", argv[curr_arg] );
@@ -230,7 +237,7 @@ int main( int argc, const char** argv ) {
 
         if( !cmd_found ) {
  
-          print_output( "Must specify a command (score, merge, report, rank, exclude, -v, or -h)", FATAL, __FILE__, __LINE__ );
+          print_output( "Must specify a command (score, merge, report, rank, exclude, serve, -v, or -h)", FATAL, __FILE__, __LINE__ );
           Throw 0;
 
         }
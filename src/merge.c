@@ -27,11 +27,15 @@
 #include <string.h>
 #endif
 #include <stdlib.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include "binding.h"
 #include "db.h"
 #include "defines.h"
 #include "info.h"
+#include "link.h"
 #include "merge.h"
 #include "sim.h"
 #include "util.h"
@@ -74,6 +78,16 @@ int merge_in_num  = 0;
 */
 int merge_er_value = MERGE_ER_NONE;
 
+/*!
+ Specifies the maximum number of merge jobs that may run in parallel (value of the -j option).
+*/
+static unsigned int merge_jobs = 0;
+
+/*!
+ Set to TRUE if all of the scored input CDD files contain the same design fingerprint.
+*/
+static bool merge_same_design = FALSE;
+
 
 /*!
  Outputs usage informaiton to standard output for merge command.
@@ -107,6 +121,9 @@ static void merge_usage() {
   printf( "      -ext <extension>        Used in conjunction with the -d option.  If no -ext options are specified\n" );
   printf( "                                on the command-line, the default value of '.cdd' is used.  Note that\n" );
   printf( "                                a period (.) should be specified.\n" );
+  printf( "      -j <number>             Merges the CDD files in a parallel tree reduction using up to <number> worker\n" );
+  printf( "                                processes.  The resulting CDD file is the same as the one created by a serial\n" );
+  printf( "                                merge.  The -er option must be specified if <number> is greater than one.\n" );
   printf( "      -m <message>            Allows the user to specify information about this CDD file.  This information\n" );
   printf( "                                can be anything (messages with whitespace should be surrounded by double-quotation\n" );
   printf( "                                marks), but may include something about the simulation arguments to more easily\n" );
@@ -238,6 +255,22 @@ static bool merge_parse_args(
         Throw 0;
       } 
 
+    } else if( strncmp( "-j", argv[i], 2 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( merge_jobs != 0 ) {
+          print_output( "Only one -j option is allowed on the merge command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else {
+          if( (sscanf( argv[i], "%u", &merge_jobs ) != 1) || (merge_jobs == 0) ) {
+            print_output( "Value specified after -j must be a positive, non-zero number", FATAL, __FILE__, __LINE__ );
+            Throw 0;
+          }
+        }
+      } else {
+        Throw 0;
+      }
+
     } else if( strncmp( "-m", argv[i], 2 ) == 0 ) {
 
       if( check_option_value( argc, argv, i ) ) {
@@ -339,6 +372,403 @@ void merge_check() { PROFILE(MERGE_CHECK);
     Throw 0;
   }
 
+  /* Exclusion reason conflicts cannot be resolved interactively by the merge worker processes */
+  if( (merge_jobs > 1) && (merge_er_value == MERGE_ER_NONE) ) {
+    print_output( "The -er option must be specified when the -j option value is greater than one", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if all of the scored input CDD files were created from the same design under the same
+         root scope.
+
+ \throws anonymous Throw
+
+ Compares the design fingerprints and root instances stored in the headers of the input CDD files specified for the
+ merge.  The fingerprint does not include the leading hierarchy, but the coverage-only merge requires the instance
+ trees to be at the same place in the hierarchy, so the root scopes must match as well.
+
+ CDD files with different instance trees under the same root scope (for example, scored with different -e options)
+ are merged into one tree.  However, two CDD files that were not created by a merge and that have the same root
+ functional unit, scope and number of instances cover the same instances, so if their fingerprints differ they were
+ created from different designs and cannot be merged.  An error is reported for them.
+
+ Unscored CDD files are not merged and are not considered.  If any scored CDD file does not contain a fingerprint,
+ FALSE is returned.
+*/
+static bool merge_check_same_design() { PROFILE(MERGE_CHECK_SAME_DESIGN);
+
+  str_link* strl      = merge_in_head;
+  str_link* root_head = NULL;
+  str_link* root_tail = NULL;
+  uint64    base_fp   = 0;
+  char      base_scope[4096];
+  bool      same      = TRUE;
+
+  Try {
+
+    while( strl != NULL ) {
+      uint64       fp;
+      unsigned int inst_num;
+      char         funit[4096];
+      char         scope[4096];
+      bool         merged;
+      if( info_read_fingerprint( strl->str, &fp, &inst_num, funit, scope, &merged ) ) {
+        if( fp == 0 ) {
+          same = FALSE;
+        } else {
+          if( base_fp == 0 ) {
+            base_fp = fp;
+            strcpy( base_scope, scope );
+          } else {
+            same = same && (fp == base_fp) && (strcmp( scope, base_scope ) == 0);
+          }
+          /* Remember the fingerprint of each root instance (split into its upper and lower 32 bits) */
+          if( !merged ) {
+            char         root[(4096 * 2) + 20];
+            str_link*    found;
+            unsigned int rv = snprintf( root, ((4096 * 2) + 20), "%s %s %u", scope, funit, inst_num );
+            assert( rv < ((4096 * 2) + 20) );
+            if( (found = str_link_find( root, root_head )) == NULL ) {
+              found         = str_link_add( strdup_safe( root ), &root_head, &root_tail );
+              found->str2   = strdup_safe( strl->str );
+              found->suppl  = (uint32)(fp >> 32);
+              found->suppl2 = (uint32)(fp & 0xffffffff);
+            } else if( (found->suppl != (uint32)(fp >> 32)) || (found->suppl2 != (uint32)(fp & 0xffffffff)) ) {
+              rv = snprintf( user_msg, USER_MSG_LENGTH, "CDD files \"%s\" and \"%s\" were created from different designs and cannot be merged",
+                             get_basename( found->str2 ), get_basename( strl->str ) );
+              assert( rv < USER_MSG_LENGTH );
+              print_output( user_msg, FATAL, __FILE__, __LINE__ );
+              Throw 0;
+            }
+          }
+        }
+      }
+      strl = (strl == merge_in_cl_last) ? NULL : strl->next;
+    }
+
+  } Catch_anonymous {
+    str_link_delete_list( root_head );
+    Throw 0;
+  }
+
+  str_link_delete_list( root_head );
+
+  PROFILE_END;
+
+  return( same && (base_fp != 0) );
+
+}
+
+/*!
+ \throws anonymous db_read
+
+ Reads the given CDD file into the current database.  If the CDD file was not scored, its input link is marked as
+ empty; otherwise, if the CDD file did not contain any merged CDD files of its own, it is marked as a leaf CDD.
+*/
+static void merge_read_cdd(
+  str_link* strl,                  /*!< Pointer to input link of CDD file to read */
+  int       read_mode,             /*!< Type of read to perform (see \ref read_modes for legal values) */
+  int*      curr_leading_hier_num  /*!< Pointer to number of leading hierarchies read prior to this CDD file */
+) { PROFILE(MERGE_READ_CDD);
+
+  /*
+   If all of the CDD files were created from the same design, only the coverage information of the CDD files
+   after the first scored CDD file needs to be merged into the current design as they are read.
+  */
+  if( (read_mode == READ_MODE_MERGE_NO_MERGE) && merge_same_design && (db_list != NULL) ) {
+    read_mode = READ_MODE_MERGE_STREAM;
+  }
+
+  if( !db_read( strl->str, read_mode ) ) {
+
+    /* The read in CDD was empty so mark it as such */
+    strl->suppl = 2;
+
+  } else {
+
+    /* If we have not merged any CDD files from this CDD, this is a leaf CDD so mark it as such */
+    if( (db_list[curr_db]->leading_hier_num - *curr_leading_hier_num) == 1 ) {
+      strl->suppl = 1;
+    }
+    *curr_leading_hier_num = db_list[curr_db]->leading_hier_num;
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Runs in a forked worker process.  Merges the given list of CDD files (in order) and writes the result to the
+ specified output file.  If none of the given CDD files were scored, no output file is written.  This function
+ never returns; the worker exits with a failure status if any error was found.
+*/
+static void merge_worker(
+  char**       files,     /*!< Array of CDD filenames to merge */
+  unsigned int file_num,  /*!< Number of elements in the files array */
+  char*        ofile      /*!< Name of CDD file to write merged results to */
+) { PROFILE(MERGE_WORKER);
+
+  int status = EXIT_SUCCESS;
+
+  /* The parent process reports the progress of the merge */
+  set_terse( TRUE );
+
+  Try {
+
+    str_link*    strl;
+    unsigned int i;
+    int          curr_leading_hier_num = 0;
+
+    /* Make the worker's group of files the list of input CDD files */
+    merge_in_head = NULL;
+    merge_in_tail = NULL;
+    for( i=0; i<file_num; i++ ) {
+      (void)str_link_add( strdup_safe( files[i] ), &merge_in_head, &merge_in_tail );
+    }
+    merge_in_cl_last = merge_in_tail;
+    merge_in_num     = file_num;
+    merged_file      = ofile;
+
+    strl = merge_in_head;
+    while( strl != NULL ) {
+      merge_read_cdd( strl, READ_MODE_MERGE_NO_MERGE, &curr_leading_hier_num );
+      strl = (strl == merge_in_cl_last) ? NULL : strl->next;
+    }
+
+    if( db_list != NULL ) {
+      db_merge_instance_trees();
+      bind_perform( TRUE, 0 );
+      db_write( ofile, FALSE, TRUE );
+    }
+
+  } Catch_anonymous {
+    status = EXIT_FAILURE;
+  }
+
+  (void)fflush( stdout );
+  (void)fflush( stderr );
+
+  _exit( status );
+
+  PROFILE_END;
+
+}
+
+/*!
+ Removes all temporary CDD files in the given list of files and deallocates the list.
+*/
+static void merge_remove_temps(
+  char**       files,     /*!< Array of CDD filenames */
+  bool*        temps,     /*!< Array specifying if the associated CDD file is a temporary file */
+  unsigned int file_num   /*!< Number of elements in the files and temps arrays */
+) { PROFILE(MERGE_REMOVE_TEMPS);
+
+  unsigned int i;
+
+  for( i=0; i<file_num; i++ ) {
+    if( temps[i] ) {
+      (void)unlink( files[i] );
+    }
+    free_safe( files[i], (strlen( files[i] ) + 1) );
+  }
+  free_safe( files, (sizeof( char* ) * file_num) );
+  free_safe( temps, (sizeof( bool ) * file_num) );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous Throw merge_read_cdd db_merge_instance_trees bind_perform db_write
+
+ Performs the merge as a parallel tree reduction.  The input CDD files are split into groups of consecutive files
+ which are merged into temporary CDD files by up to merge_jobs worker processes.  The resulting temporary CDD files
+ are merged pairwise in the same manner until only one group is left, which is merged by this process.  Because
+ the order of the input CDD files is maintained at each level, the merged coverage information matches that of a
+ serial merge.  The merged CDD and leading hierarchy information is rebuilt from the headers of the original input
+ CDD files so that it is also identical to that of a serial merge.
+*/
+static void merge_parallel() { PROFILE(MERGE_PARALLEL);
+
+  char**       files    = NULL;
+  bool*        temps    = NULL;
+  unsigned int file_num = 0;
+  unsigned int level    = 0;
+  unsigned int group_size;
+  unsigned int rv;
+  str_link*    strl;
+
+  /* Create the list of files to merge at the first level */
+  strl = merge_in_head;
+  while( strl != NULL ) {
+    files           = (char**)realloc_safe( files, (sizeof( char* ) * file_num), (sizeof( char* ) * (file_num + 1)) );
+    temps           = (bool*)realloc_safe( temps, (sizeof( bool ) * file_num), (sizeof( bool ) * (file_num + 1)) );
+    files[file_num] = strdup_safe( strl->str );
+    temps[file_num] = FALSE;
+    file_num++;
+    rv = snprintf( user_msg, USER_MSG_LENGTH, "%s CDD file \"%s\"", ((strl == merge_in_head) ? "Reading" : "Merging"), strl->str );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+    strl = (strl == merge_in_cl_last) ? NULL : strl->next;
+  }
+
+  /* The first level splits the files evenly among the jobs; the following levels merge the results pairwise */
+  group_size = (file_num + merge_jobs - 1) / merge_jobs;
+  if( group_size < 2 ) {
+    group_size = 2;
+  }
+
+  while( file_num > group_size ) {
+
+    unsigned int group_num  = (file_num + group_size - 1) / group_size;
+    char**       next_files = (char**)malloc_safe( sizeof( char* ) * group_num );
+    bool*        next_temps = (bool*)malloc_safe( sizeof( bool ) * group_num );
+    pid_t*       pids       = (pid_t*)malloc_safe( sizeof( pid_t ) * group_num );
+    bool         error      = FALSE;
+    unsigned int i;
+
+    /* Make sure that buffered output is not duplicated by the worker processes */
+    (void)fflush( stdout );
+    (void)fflush( stderr );
+
+    /* Start a worker process for each group containing more than one file */
+    for( i=0; i<group_num; i++ ) {
+      unsigned int first = i * group_size;
+      unsigned int num   = ((file_num - first) < group_size) ? (file_num - first) : group_size;
+      if( num == 1 ) {
+        next_files[i] = strdup_safe( files[first] );
+        next_temps[i] = temps[first];
+        temps[first]  = FALSE;
+        pids[i]       = 0;
+      } else {
+        char tmp[4096];
+        rv = snprintf( tmp, 4096, "%s.%d.%u.%u", merged_file, (int)getpid(), level, i );
+        assert( rv < 4096 );
+        next_files[i] = strdup_safe( tmp );
+        next_temps[i] = TRUE;
+        if( (pids[i] = fork()) == 0 ) {
+          merge_worker( (files + first), num, next_files[i] );
+        } else if( pids[i] < 0 ) {
+          error = TRUE;
+        }
+      }
+    }
+
+    /* Wait for all of the workers of this level to complete */
+    for( i=0; i<group_num; i++ ) {
+      if( pids[i] > 0 ) {
+        int status;
+        if( (waitpid( pids[i], &status, 0 ) != pids[i]) || !WIFEXITED( status ) || (WEXITSTATUS( status ) != EXIT_SUCCESS) ) {
+          error = TRUE;
+        } else if( !file_exists( next_files[i] ) ) {
+          /* None of the files in this group were scored so the group is empty */
+          next_temps[i] = FALSE;
+          free_safe( next_files[i], (strlen( next_files[i] ) + 1) );
+          next_files[i] = NULL;
+        }
+      }
+    }
+    free_safe( pids, (sizeof( pid_t ) * group_num) );
+
+    /* The files of this level have been merged, so remove any temporary files that were used */
+    merge_remove_temps( files, temps, file_num );
+
+    /* Move the results to the list of files for the next level, removing empty groups */
+    files    = NULL;
+    temps    = NULL;
+    file_num = 0;
+    for( i=0; i<group_num; i++ ) {
+      if( next_files[i] != NULL ) {
+        files           = (char**)realloc_safe( files, (sizeof( char* ) * file_num), (sizeof( char* ) * (file_num + 1)) );
+        temps           = (bool*)realloc_safe( temps, (sizeof( bool ) * file_num), (sizeof( bool ) * (file_num + 1)) );
+        files[file_num] = next_files[i];
+        temps[file_num] = next_temps[i];
+        file_num++;
+      }
+    }
+    free_safe( next_files, (sizeof( char* ) * group_num) );
+    free_safe( next_temps, (sizeof( bool ) * group_num) );
+
+    if( error ) {
+      merge_remove_temps( files, temps, file_num );
+      print_output( "Unable to complete merge in one or more merge jobs", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+
+    group_size = 2;
+    level++;
+
+  }
+
+  Try {
+
+    str_link*    save_head             = merge_in_head;
+    str_link*    save_tail             = merge_in_tail;
+    str_link*    save_cl_last          = merge_in_cl_last;
+    int          save_num              = merge_in_num;
+    int          curr_leading_hier_num = 0;
+    unsigned int i;
+
+    /* Read the last group of files using a temporary list of input files */
+    merge_in_head = NULL;
+    merge_in_tail = NULL;
+    for( i=0; i<file_num; i++ ) {
+      (void)str_link_add( strdup_safe( files[i] ), &merge_in_head, &merge_in_tail );
+    }
+    merge_in_num = file_num;
+
+    Try {
+      strl = merge_in_head;
+      for( i=0; i<file_num; i++ ) {
+        merge_read_cdd( strl, READ_MODE_MERGE_NO_MERGE, &curr_leading_hier_num );
+        strl = strl->next;
+      }
+    } Catch_anonymous {
+      str_link_delete_list( merge_in_head );
+      merge_in_head    = save_head;
+      merge_in_tail    = save_tail;
+      merge_in_cl_last = save_cl_last;
+      merge_in_num     = save_num;
+      Throw 0;
+    }
+    str_link_delete_list( merge_in_head );
+    merge_in_head    = save_head;
+    merge_in_tail    = save_tail;
+    merge_in_cl_last = save_cl_last;
+    merge_in_num     = save_num;
+
+    /* Clear the leading hierarchies of the temporary files */
+    if( db_list != NULL ) {
+      for( i=0; i<db_list[curr_db]->leading_hier_num; i++ ) {
+        free_safe( db_list[curr_db]->leading_hierarchies[i], (strlen( db_list[curr_db]->leading_hierarchies[i] ) + 1) );
+      }
+      free_safe( db_list[curr_db]->leading_hierarchies, (sizeof( char* ) * db_list[curr_db]->leading_hier_num) );
+      db_list[curr_db]->leading_hierarchies  = NULL;
+      db_list[curr_db]->leading_hier_num     = 0;
+      db_list[curr_db]->leading_hiers_differ = FALSE;
+    }
+
+    /* Rebuild the merged CDD and leading hierarchy information from the headers of the original input files */
+    curr_leading_hier_num = 0;
+    strl                  = merge_in_head;
+    while( strl != NULL ) {
+      merge_read_cdd( strl, READ_MODE_MERGE_HEADER, &curr_leading_hier_num );
+      strl = (strl == merge_in_cl_last) ? NULL : strl->next;
+    }
+
+  } Catch_anonymous {
+    merge_remove_temps( files, temps, file_num );
+    Throw 0;
+  }
+
+  merge_remove_temps( files, temps, file_num );
+
   PROFILE_END;
 
 }
@@ -373,49 +803,34 @@ void command_merge(
       /* Check if merge could be executed */
       merge_check();
 
-      /* Read in base database */
-      rv = snprintf( user_msg, USER_MSG_LENGTH, "Reading CDD file \"%s\"", merge_in_head->str );
-      assert( rv < USER_MSG_LENGTH );
-      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
-      if( !db_read( merge_in_head->str, READ_MODE_MERGE_NO_MERGE ) ) {
-
-        /* The read in CDD was empty so mark it as such */
-        merge_in_head->suppl = 2;
+      /* Check the design fingerprints of the CDD files to see if the coverage-only merge can be performed */
+      merge_same_design = merge_check_same_design();
 
-      } else {
+      if( merge_jobs > 1 ) {
 
-        /* If the currently read CDD didn't contain any merged CDDs it is a leaf CDD so mark it as such */
-        if( (db_list[curr_db]->leading_hier_num - curr_leading_hier_num) == 1 ) {
-          merge_in_head->suppl = 1;
-        }
-        curr_leading_hier_num = db_list[curr_db]->leading_hier_num;
+        /* Merge the CDD files in parallel */
+        merge_parallel();
 
-      }
+      } else {
 
-      /* Read in databases to merge */
-      strl         = merge_in_head->next;
-      stop_merging = (strl == merge_in_head);
-      while( (strl != NULL) && !stop_merging ) {
-        rv = snprintf( user_msg, USER_MSG_LENGTH, "Merging CDD file \"%s\"", strl->str );
+        /* Read in base database */
+        rv = snprintf( user_msg, USER_MSG_LENGTH, "Reading CDD file \"%s\"", merge_in_head->str );
         assert( rv < USER_MSG_LENGTH );
         print_output( user_msg, NORMAL, __FILE__, __LINE__ );
-        if( !db_read( strl->str, READ_MODE_MERGE_NO_MERGE ) ) {
-
-          /* The read in CDD was empty so mark it as such */
-          merge_in_head->suppl = 2;
-
-        } else {
-
-          /* If we have not merged any CDD files from this CDD, this is a leaf CDD so mark it as such */
-          if( (db_list[curr_db]->leading_hier_num - curr_leading_hier_num) == 1 ) {
-            strl->suppl = 1;
-          }
-          curr_leading_hier_num = db_list[curr_db]->leading_hier_num;
+        merge_read_cdd( merge_in_head, READ_MODE_MERGE_NO_MERGE, &curr_leading_hier_num );
 
+        /* Read in databases to merge */
+        strl         = merge_in_head->next;
+        stop_merging = (strl == merge_in_head);
+        while( (strl != NULL) && !stop_merging ) {
+          rv = snprintf( user_msg, USER_MSG_LENGTH, "Merging CDD file \"%s\"", strl->str );
+          assert( rv < USER_MSG_LENGTH );
+          print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+          merge_read_cdd( strl, READ_MODE_MERGE_NO_MERGE, &curr_leading_hier_num );
+          stop_merging = (strl == merge_in_cl_last);
+          strl         = strl->next;
         }
 
-        stop_merging = (strl == merge_in_cl_last);
-        strl         = strl->next;
       }
 
       /* Perform the tree merges */
@@ -1250,8 +1250,9 @@ void param_resolve(
  be scored as a signal.
 */
 void param_db_write(
-  inst_parm* iparm,  /*!< Pointer to instance parameter to output to file */
-  FILE*      file    /*!< Pointer to file handle to write parameter contents to */
+  inst_parm* iparm,       /*!< Pointer to instance parameter to output to file */
+  FILE*      file,        /*!< Pointer to file handle to write parameter contents to */
+  uint64*    fingerprint  /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(PARAM_DB_WRITE);
 
   /*
@@ -1264,7 +1265,7 @@ void param_db_write(
     iparm->sig->id = curr_sig_id++;
 
     /* Write the signal */
-    vsignal_db_write( iparm->sig, file );
+    vsignal_db_write( iparm->sig, file, fingerprint );
 
   }
 
@@ -112,7 +112,8 @@ void param_resolve(
 /*! \brief Outputs specified instance parameter to specified output stream. */
 void param_db_write(
   inst_parm* iparm,
-  FILE*      file
+  FILE*      file,
+  uint64*    fingerprint
 );
 
 /*! \brief Deallocates specified module parameter and possibly entire module parameter list. */
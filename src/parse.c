@@ -55,7 +55,6 @@ extern sig_range curr_prange;
 extern sig_range curr_urange;
 extern bool      instance_specified;
 extern char*     top_module;
-extern char*     ppfilename;
 extern bool      debug_mode;
 extern char*     dumpvars_file;
 
@@ -119,7 +118,7 @@ void parse_design(
 
       Try {
 
-        /* Parse the design -- if we catch an exception, remove the temporary ppfilename */
+        /* Parse the design */
         parser_ret = VLparse();
 
         if( (parser_ret != 0) || (error_count > 0) ) {
@@ -128,7 +127,6 @@ void parse_design(
         }
 
       } Catch_anonymous {
-        (void)unlink( ppfilename );
         parser_dealloc_sig_range( &curr_urange, FALSE );
         parser_dealloc_sig_range( &curr_prange, FALSE );
         Throw 0;
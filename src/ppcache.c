@@ -0,0 +1,1227 @@
+/*
+ Copyright (c) 2026 agent
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     ppcache.c
+ \author   agent
+ \date     10/18/2026
+
+ \par
+ The preprocessor cache stores the preprocessed contents of each Verilog file read by the score command in
+ a directory specified with the -cache option, so that files that have not changed since a previous run do
+ not need to be preprocessed again.  Each cache entry is stored in its own file, named after the hash of the
+ key of the entry.
+
+ \par
+ Only the preprocessor is skipped for a cached file.  The parser still reads the preprocessed contents of every
+ file and the design is still elaborated, so the time saved is the time that the preprocessor would have taken.
+ Since the lexer preprocesses a file again each time that it searches the file for a module, this includes
+ repeated preprocessing of the same file within a single run.
+
+ \par
+ The key of an entry contains everything that the preprocessor output of a file depends on before any of the file
+ is read:  the name and signature of the file, the global generation and the list of
+ include directories.  The key is stored in the entry and compared in full when the entry is loaded, so two keys
+ that hash to the same entry name cannot be confused.
+
+ \par
+ The signature of a file consists of its size, a 64-bit hash of its contents and its modification time, device
+ and inode number.  A file is only considered unchanged if its signature is identical, so any doubt about whether
+ a file has changed (including merely touching it) results in the file being preprocessed again.
+
+ \par
+ The entry also records the signature of every file included while preprocessing, the include
+ directory candidates that were tried and could not be opened before an include file was found, every define
+ that was looked up before the file defined or undefined it (along with its value at that time or the fact that
+ it was not defined) and the state after preprocessing of every define that the file defined or undefined.  An
+ entry is only used if every included file is unchanged, every missing candidate is still missing and every
+ define that was looked up still has the recorded value; the recorded defines are then applied to the current
+ defines, just as if the file had been preprocessed.  Stale entries are simply overwritten.
+
+ \par
+ Because an entry only depends on the defines that the file looks up, entries do not depend on the defines of
+ files that were read earlier unless they are used.  This allows the -j option of the score command to fill the
+ cache in parallel worker processes (see ppcache_populate) before the design is parsed.  Each worker preprocesses
+ a group of files speculatively and then, once it has received the defines at the start of its group from the
+ preceding worker, preprocesses again only the files that looked up a define from an earlier group.  If -j is
+ specified without -cache, the workers fill a temporary cache directory that is removed once the design has been
+ parsed.  Only the preprocessing is done in parallel; the design is still parsed and elaborated by a single
+ process.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+#include <stdlib.h>
+#include <assert.h>
+#include <dirent.h>
+#include <limits.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "defines.h"
+#include "link.h"
+#include "ppcache.h"
+#include "tree.h"
+#include "util.h"
+
+
+extern char         user_msg[USER_MSG_LENGTH];
+extern tnode*       def_table;
+extern str_link*    inc_paths_head;
+extern unsigned int flag_global_generation;
+extern str_link*    use_files_head;
+extern char*        ppcache_dir;
+extern void reset_pplexer( char* filename, FILE* out );
+extern int PPVLlex( void );
+
+/*!
+ Number of characters needed to store the signature of a file created by ppcache_file_sig.
+*/
+#define PPCACHE_SIG_LENGTH  ((16 * 5) + 5)
+
+/*!
+ Set to TRUE while the preprocessed contents of a file that was not found in the cache are being recorded.
+*/
+static bool ppcache_recording = FALSE;
+
+/*!
+ Key of the cache entry of the file currently being loaded or recorded.
+*/
+static char* ppcache_key = NULL;
+
+/*!
+ Number of bytes used in the ppcache_key buffer.
+*/
+static unsigned int ppcache_key_size = 0;
+
+/*!
+ Allocated size of the ppcache_key buffer.
+*/
+static unsigned int ppcache_key_alloc = 0;
+
+/*!
+ Pointer to head of list of files included while preprocessing the recorded file (str2 contains the signature of
+ the file).
+*/
+static str_link* ppcache_incl_head = NULL;
+
+/*!
+ Pointer to tail of list of files included while preprocessing the recorded file.
+*/
+static str_link* ppcache_incl_tail = NULL;
+
+/*!
+ Pointer to head of list of include file candidates that could not be opened while preprocessing the recorded file.
+*/
+static str_link* ppcache_miss_head = NULL;
+
+/*!
+ Pointer to tail of list of include file candidates that could not be opened while preprocessing the recorded file.
+*/
+static str_link* ppcache_miss_tail = NULL;
+
+/*!
+ Tree of the defines that were looked up, defined or undefined while preprocessing the recorded file.  The value
+ of each node is "1" if the file defined or undefined the define; otherwise, it is "0".
+*/
+static tnode* ppcache_touched = NULL;
+
+/*!
+ Pointer to head of list of defines that were looked up before the recorded file defined or undefined them (str2
+ contains the value of the define at that time or NULL if it was not defined).
+*/
+static str_link* ppcache_deps_head = NULL;
+
+/*!
+ Pointer to tail of list of defines that were looked up before the recorded file defined or undefined them.
+*/
+static str_link* ppcache_deps_tail = NULL;
+
+/*!
+ Set to TRUE in the worker processes of ppcache_populate.  A worker does not replace an entry whose files are
+ unchanged but whose defines do not match, as the entry was most likely written by the serial parse, which sees
+ the defines of all files.
+*/
+static bool ppcache_speculative = FALSE;
+
+/*!
+ Number of files whose preprocessed contents were loaded from the cache.
+*/
+static unsigned int ppcache_hits = 0;
+
+/*!
+ Set to TRUE once a warning has been output for a cache entry that could not be written.
+*/
+static bool ppcache_write_warned = FALSE;
+
+/*!
+ Set to TRUE if ppcache_dir is a temporary directory created by ppcache_populate, which is removed along with its
+ contents by ppcache_dealloc.
+*/
+static bool ppcache_dir_temp = FALSE;
+
+/*!
+ \return Returns TRUE if the given file could be read; otherwise, returns FALSE.
+
+ Creates the signature of the given file from its size, the 64-bit FNV-1a hash of its contents and its
+ modification time, device and inode number.  If the size of the file does not match the number of bytes read
+ from it, the file changed while it was being read and no signature is created.
+*/
+static bool ppcache_file_sig(
+            const char* path,  /*!< Name of file to create the signature of */
+  /*@out@*/ char*       sig    /*!< Set to the signature of the file (PPCACHE_SIG_LENGTH characters of storage) */
+) { PROFILE(PPCACHE_FILE_SIG);
+
+  bool  retval = FALSE;
+  FILE* file;
+
+  if( (file = fopen( path, "rb" )) != NULL ) {
+
+    unsigned char block[16384];
+    size_t        num;
+    size_t        i;
+    uint64        size = 0;
+    uint64        hash = UINT64(0xcbf29ce484222325);
+    struct stat   st;
+
+    while( (num = fread( block, 1, 16384, file )) > 0 ) {
+      for( i=0; i<num; i++ ) {
+        hash ^= block[i];
+        hash *= UINT64(0x100000001b3);
+      }
+      size += num;
+    }
+
+    if( (ferror( file ) == 0) && (fstat( fileno( file ), &st ) == 0) && ((uint64)st.st_size == size) ) {
+      unsigned int rv = snprintf( sig, PPCACHE_SIG_LENGTH, "%" FMT64 "x:%" FMT64 "x:%" FMT64 "x:%" FMT64 "x:%" FMT64 "x",
+                                  size, hash, (uint64)st.st_mtime, (uint64)st.st_dev, (uint64)st.st_ino );
+      assert( rv < PPCACHE_SIG_LENGTH );
+      retval = TRUE;
+    }
+
+    (void)fclose( file );
+
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if the given file can be opened for reading as the preprocessor would open an include file.
+*/
+static bool ppcache_can_open(
+  const char* path  /*!< Name of file to open */
+) { PROFILE(PPCACHE_CAN_OPEN);
+
+  bool  retval = FALSE;
+  FILE* file;
+
+  if( (file = fopen( path, "r" )) != NULL ) {
+    (void)fclose( file );
+    retval = TRUE;
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ Appends the given data to the key of the current cache entry.
+*/
+static void ppcache_key_add(
+  const void*  data,  /*!< Pointer to data to append */
+  unsigned int size   /*!< Number of bytes of data to append */
+) { PROFILE(PPCACHE_KEY_ADD);
+
+  if( (ppcache_key_size + size) > ppcache_key_alloc ) {
+    unsigned int alloc = (ppcache_key_alloc == 0) ? 4096 : ppcache_key_alloc;
+    while( (ppcache_key_size + size) > alloc ) {
+      alloc *= 2;
+    }
+    ppcache_key       = (char*)realloc_safe_nolimit( ppcache_key, ppcache_key_alloc, alloc );
+    ppcache_key_alloc = alloc;
+  }
+
+  memcpy( (ppcache_key + ppcache_key_size), data, size );
+  ppcache_key_size += size;
+
+  PROFILE_END;
+
+}
+
+/*!
+ Appends the given string, preceded by its length, to the key of the current cache entry.
+*/
+static void ppcache_key_add_str(
+  const char* str  /*!< String to append */
+) { PROFILE(PPCACHE_KEY_ADD_STR);
+
+  uint32 len = strlen( str );
+
+  ppcache_key_add( &len, sizeof( uint32 ) );
+  ppcache_key_add( str, len );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the number of defines in the given tree of touched defines that the recorded file defined or
+         undefined.
+*/
+static uint32 ppcache_count_changes(
+  tnode* node  /*!< Pointer to root of tree of touched defines */
+) { PROFILE(PPCACHE_COUNT_CHANGES);
+
+  uint32 num = 0;
+
+  while( node != NULL ) {
+    num += ppcache_count_changes( node->left ) + ((node->value[0] == '1') ? 1 : 0);
+    node = node->right;
+  }
+
+  PROFILE_END;
+
+  return( num );
+
+}
+
+/*!
+ \return Returns TRUE if the string was written successfully; otherwise, returns FALSE.
+
+ Writes the given string, preceded by its length, to the given cache entry file.
+*/
+static bool ppcache_write_str(
+  FILE*       file,  /*!< Pointer to cache entry file */
+  const char* str    /*!< String to write */
+) { PROFILE(PPCACHE_WRITE_STR);
+
+  uint32 len    = strlen( str );
+  bool   retval = (fwrite( &len, sizeof( uint32 ), 1, file ) == 1) && (fwrite( str, 1, len, file ) == len);
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if the define was written successfully; otherwise, returns FALSE.
+
+ Writes the given define name and value to the given cache entry file.  A value of NULL specifies that the define
+ is not defined.
+*/
+static bool ppcache_write_define(
+             FILE*       file,  /*!< Pointer to cache entry file */
+             const char* name,  /*!< Name of define to write */
+  /*@null@*/ const char* value  /*!< Value of define to write or NULL if it is not defined */
+) { PROFILE(PPCACHE_WRITE_DEFINE);
+
+  uint32 defined = (value != NULL) ? 1 : 0;
+  bool   retval  = ppcache_write_str( file, name ) && (fwrite( &defined, sizeof( uint32 ), 1, file ) == 1) &&
+                   ((value == NULL) || ppcache_write_str( file, value ));
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if the defines were written successfully; otherwise, returns FALSE.
+
+ Writes the current state of each define in the given tree of touched defines that the recorded file defined or
+ undefined to the given cache entry file.
+*/
+static bool ppcache_write_changes(
+  FILE*  file,  /*!< Pointer to cache entry file */
+  tnode* node   /*!< Pointer to root of tree of touched defines */
+) { PROFILE(PPCACHE_WRITE_CHANGES);
+
+  bool retval = TRUE;
+
+  while( (node != NULL) && retval ) {
+    if( (retval = ppcache_write_changes( file, node->left )) && (node->value[0] == '1') ) {
+      tnode* def = tree_find( node->name, def_table );
+      retval = ppcache_write_define( file, node->name, ((def != NULL) ? def->value : NULL) );
+    }
+    node = node->right;
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns the number of defines in the given tree of defines.
+*/
+static uint32 ppcache_count_defines(
+  tnode* node  /*!< Pointer to root of tree of defines */
+) { PROFILE(PPCACHE_COUNT_DEFINES);
+
+  uint32 num = 0;
+
+  while( node != NULL ) {
+    num += ppcache_count_defines( node->left ) + 1;
+    node = node->right;
+  }
+
+  PROFILE_END;
+
+  return( num );
+
+}
+
+/*!
+ \return Returns TRUE if the defines were written successfully; otherwise, returns FALSE.
+
+ Writes every define in the given tree of defines to the given file.
+*/
+static bool ppcache_write_defines(
+  FILE*  file,  /*!< Pointer to file to write to */
+  tnode* node   /*!< Pointer to root of tree of defines */
+) { PROFILE(PPCACHE_WRITE_DEFINES);
+
+  bool retval = TRUE;
+
+  while( (node != NULL) && retval ) {
+    retval = ppcache_write_defines( file, node->left ) && ppcache_write_define( file, node->name, node->value );
+    node   = node->right;
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns the string that was read (memory allocated) or NULL if the string could not be read.
+
+ Reads a string, preceded by its length, from the given cache entry file.
+*/
+static char* ppcache_read_str(
+  FILE* file,   /*!< Pointer to cache entry file */
+  long  limit   /*!< Size of the cache entry file (a string cannot be longer than this) */
+) { PROFILE(PPCACHE_READ_STR);
+
+  char*  str = NULL;
+  uint32 len;
+
+  if( (fread( &len, sizeof( uint32 ), 1, file ) == 1) && (len <= limit) ) {
+    str = (char*)malloc_safe_nolimit( len + 1 );
+    if( fread( str, 1, len, file ) == len ) {
+      str[len] = '\0';
+    } else {
+      free_safe( str, (len + 1) );
+      str = NULL;
+    }
+  }
+
+  PROFILE_END;
+
+  return( str );
+
+}
+
+/*!
+ \return Returns TRUE if the define was read successfully; otherwise, returns FALSE.
+
+ Reads a define name and value, as written by ppcache_write_define, from the given cache entry file.
+*/
+static bool ppcache_read_define(
+            FILE*  file,   /*!< Pointer to cache entry file */
+            long   limit,  /*!< Size of the cache entry file */
+  /*@out@*/ char** name,   /*!< Set to the name of the define (memory allocated) */
+  /*@out@*/ char** value   /*!< Set to the value of the define (memory allocated) or NULL if it is not defined */
+) { PROFILE(PPCACHE_READ_DEFINE);
+
+  bool   retval = FALSE;
+  uint32 defined;
+
+  *value = NULL;
+
+  if( (*name = ppcache_read_str( file, limit )) != NULL ) {
+    if( (fread( &defined, sizeof( uint32 ), 1, file ) == 1) && ((defined == 0) || ((*value = ppcache_read_str( file, limit )) != NULL)) ) {
+      retval = TRUE;
+    } else {
+      free_safe( *name, (strlen( *name ) + 1) );
+      *name = NULL;
+    }
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if the defines were read successfully; otherwise, returns FALSE.
+
+ Reads the defines written by a preceding worker process of ppcache_populate from the given pipe and makes them the
+ current defines.
+*/
+static bool ppcache_read_defines(
+  FILE* file  /*!< Pointer to pipe to read defines from */
+) { PROFILE(PPCACHE_READ_DEFINES);
+
+  bool   retval;
+  uint32 num;
+  uint32 i;
+
+  tree_dealloc( def_table );
+  def_table = NULL;
+
+  retval = (fread( &num, sizeof( uint32 ), 1, file ) == 1);
+  for( i=0; (i<num) && retval; i++ ) {
+    char* name;
+    char* value;
+    if( (retval = (ppcache_read_define( file, LONG_MAX, &name, &value ) && (value != NULL))) ) {
+      (void)tree_add( name, value, TRUE, &def_table );
+      free_safe( value, (strlen( value ) + 1) );
+    }
+    free_safe( name, (strlen( name ) + 1) );
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns the name of the cache entry file for the current key (memory allocated).
+*/
+static char* ppcache_entry_name() { PROFILE(PPCACHE_ENTRY_NAME);
+
+  unsigned int slen  = strlen( ppcache_dir ) + 14;
+  char*        ename = (char*)malloc_safe( slen );
+  unsigned int rv    = snprintf( ename, slen, "%s/%08x.ppc", ppcache_dir, util_hash( HASH_INIT, ppcache_key, ppcache_key_size ) );
+
+  assert( rv < slen );
+
+  PROFILE_END;
+
+  return( ename );
+
+}
+
+/*!
+ \return Returns TRUE if the given cache entry matches the current key, all of the files it depends on are
+         unchanged and all of the defines it looked up have the same values; otherwise, returns FALSE.
+
+ Reads the given cache entry file.  If the entry can be used, the defines that the file defined or undefined are
+ applied to the define table and the preprocessed contents are returned.
+*/
+static bool ppcache_read_entry(
+            FILE*         file,     /*!< Pointer to cache entry file */
+  /*@out@*/ char**        buffer,   /*!< Set to the preprocessed contents (size + 1 bytes of allocated memory) */
+  /*@out@*/ unsigned int* size,     /*!< Set to the number of characters of preprocessed contents */
+  /*@out@*/ bool*         current   /*!< Set to TRUE if the entry matches the current key and its files are unchanged */
+) { PROFILE(PPCACHE_READ_ENTRY);
+
+  str_link* changes_head = NULL;
+  str_link* changes_tail = NULL;
+  long      limit        = 0;
+  uint32    version;
+  uint32    key_size;
+  uint32    num;
+  uint32    i;
+  bool      valid;
+
+  if( (fseek( file, 0, SEEK_END ) == 0) && ((limit = ftell( file )) > 0) ) {
+    rewind( file );
+  }
+
+  /* Make sure that the entry has the same key as the file being loaded */
+  valid = (limit > 0) &&
+          (fread( &version,  sizeof( uint32 ), 1, file ) == 1) && (version == PPCACHE_VERSION) &&
+          (fread( &key_size, sizeof( uint32 ), 1, file ) == 1) && (key_size == ppcache_key_size) && (key_size <= limit);
+
+  if( valid ) {
+    char* key = (char*)malloc_safe_nolimit( key_size );
+    valid = (fread( key, 1, key_size, file ) == key_size) && (memcmp( key, ppcache_key, key_size ) == 0);
+    free_safe( key, key_size );
+  }
+
+  /* Make sure that every included file is unchanged */
+  valid = valid && (fread( &num, sizeof( uint32 ), 1, file ) == 1);
+  for( i=0; (i<num) && valid; i++ ) {
+    char* path     = ppcache_read_str( file, limit );
+    char* incl_sig = (path != NULL) ? ppcache_read_str( file, limit ) : NULL;
+    char  curr_sig[PPCACHE_SIG_LENGTH];
+    valid = (incl_sig != NULL) && ppcache_file_sig( path, curr_sig ) && (strcmp( curr_sig, incl_sig ) == 0);
+    if( path != NULL ) {
+      free_safe( path, (strlen( path ) + 1) );
+    }
+    if( incl_sig != NULL ) {
+      free_safe( incl_sig, (strlen( incl_sig ) + 1) );
+    }
+  }
+
+  /* Make sure that no include file candidate that was missing has since been created */
+  valid = valid && (fread( &num, sizeof( uint32 ), 1, file ) == 1);
+  for( i=0; (i<num) && valid; i++ ) {
+    char* path = ppcache_read_str( file, limit );
+    valid = (path != NULL) && !ppcache_can_open( path );
+    if( path != NULL ) {
+      free_safe( path, (strlen( path ) + 1) );
+    }
+  }
+
+  *current = valid;
+
+  /* Make sure that every define that was looked up has the same value */
+  valid = valid && (fread( &num, sizeof( uint32 ), 1, file ) == 1);
+  for( i=0; (i<num) && valid; i++ ) {
+    char*  name;
+    char*  value;
+    tnode* def;
+    if( (valid = ppcache_read_define( file, limit, &name, &value )) ) {
+      def   = tree_find( name, def_table );
+      valid = (value == NULL) ? (def == NULL) : ((def != NULL) && (strcmp( def->value, value ) == 0));
+      free_safe( name, (strlen( name ) + 1) );
+      free_safe( value, (strlen( value ) + 1) );
+    }
+  }
+
+  /* Read the defines that the file defined or undefined */
+  valid = valid && (fread( &num, sizeof( uint32 ), 1, file ) == 1);
+  for( i=0; (i<num) && valid; i++ ) {
+    char* name;
+    char* value;
+    if( (valid = ppcache_read_define( file, limit, &name, &value )) ) {
+      str_link* strl = str_link_add( name, &changes_head, &changes_tail );
+      strl->str2 = value;
+    }
+  }
+
+  /* Read the preprocessed contents */
+  valid = valid && (fread( &num, sizeof( uint32 ), 1, file ) == 1) && (num <= limit);
+  if( valid ) {
+    *buffer = (char*)malloc_safe_nolimit( num + 1 );
+    if( (valid = (fread( *buffer, 1, num, file ) == num)) ) {
+      (*buffer)[num] = '\0';
+      *size          = num;
+    } else {
+      free_safe( *buffer, (num + 1) );
+      *buffer = NULL;
+    }
+  }
+
+  /* Apply the defines just as if the file had been preprocessed */
+  if( valid ) {
+    str_link* strl;
+    for( strl=changes_head; strl!=NULL; strl=strl->next ) {
+      if( strl->str2 != NULL ) {
+        (void)tree_add( strl->str, strl->str2, TRUE, &def_table );
+      } else {
+        tree_remove( strl->str, &def_table );
+      }
+    }
+  }
+
+  str_link_delete_list( changes_head );
+
+  PROFILE_END;
+
+  return( valid );
+
+}
+
+/*!
+ \return Returns TRUE if the preprocessed contents of the given file were loaded from the cache; otherwise, returns
+         FALSE.
+
+ If the preprocessor cache is enabled, looks for a usable cache entry for the given file.  If one is found, its
+ preprocessed contents are returned and the define table is updated as if the file had been preprocessed.  If no
+ usable entry is found, the files that the preprocessor reads and the defines that it uses are recorded until
+ ppcache_store or ppcache_cancel is called.
+*/
+bool ppcache_load(
+            const char*   fname,   /*!< Name of Verilog file that is about to be preprocessed */
+  /*@out@*/ char**        buffer,  /*!< Set to the preprocessed contents (size + 1 bytes of allocated memory) */
+  /*@out@*/ unsigned int* size     /*!< Set to the number of characters of preprocessed contents */
+) { PROFILE(PPCACHE_LOAD);
+
+  bool retval = FALSE;
+  char fsig[PPCACHE_SIG_LENGTH];
+
+  /* Drop anything left over from a file that was not stored */
+  ppcache_cancel();
+
+  if( (ppcache_dir != NULL) && ppcache_file_sig( fname, fsig ) ) {
+
+    str_link* strl;
+    uint32    num     = 0;
+    uint32    gen     = flag_global_generation;
+    bool      current = FALSE;
+    char*     ename;
+    FILE*     file;
+
+    /* Build the key of the cache entry from everything that the preprocessor output depends on */
+    ppcache_key_add_str( fname );
+    ppcache_key_add_str( fsig );
+    ppcache_key_add( &gen, sizeof( uint32 ) );
+    for( strl=inc_paths_head; strl!=NULL; strl=strl->next ) {
+      num++;
+    }
+    ppcache_key_add( &num, sizeof( uint32 ) );
+    for( strl=inc_paths_head; strl!=NULL; strl=strl->next ) {
+      ppcache_key_add_str( strl->str );
+    }
+
+    ename = ppcache_entry_name();
+    if( (file = fopen( ename, "rb" )) != NULL ) {
+      retval = ppcache_read_entry( file, buffer, size, &current );
+      (void)fclose( file );
+    }
+    free_safe( ename, (strlen( ename ) + 1) );
+
+    if( retval ) {
+      ppcache_hits++;
+      ppcache_cancel();
+    } else {
+      ppcache_recording = !ppcache_speculative || !current;
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ Records that the given include file was read while preprocessing the file being recorded.
+*/
+void ppcache_add_include(
+  const char* path  /*!< Name of include file that was opened */
+) { PROFILE(PPCACHE_ADD_INCLUDE);
+
+  if( ppcache_recording ) {
+
+    char sig[PPCACHE_SIG_LENGTH];
+
+    if( ppcache_file_sig( path, sig ) ) {
+      str_link* strl = str_link_add( strdup_safe( path ), &ppcache_incl_head, &ppcache_incl_tail );
+      strl->str2 = strdup_safe( sig );
+    } else {
+      ppcache_cancel();
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Records that the given include file candidate could not be opened while preprocessing the file being recorded.
+*/
+void ppcache_add_missing(
+  const char* path  /*!< Name of include file candidate that could not be opened */
+) { PROFILE(PPCACHE_ADD_MISSING);
+
+  if( ppcache_recording ) {
+    (void)str_link_add( strdup_safe( path ), &ppcache_miss_head, &ppcache_miss_tail );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Records that the given define is about to be looked up while preprocessing the file being recorded.  Unless the
+ file has already looked up, defined or undefined it, the current value of the define becomes a dependency of the
+ cache entry.
+*/
+void ppcache_use_define(
+  const char* name  /*!< Name of define being looked up */
+) { PROFILE(PPCACHE_USE_DEFINE);
+
+  if( ppcache_recording && (tree_find( name, ppcache_touched ) == NULL) ) {
+
+    tnode*    def  = tree_find( name, def_table );
+    str_link* strl = str_link_add( strdup_safe( name ), &ppcache_deps_head, &ppcache_deps_tail );
+
+    strl->str2 = (def != NULL) ? strdup_safe( def->value ) : NULL;
+
+    (void)tree_add( name, "0", FALSE, &ppcache_touched );
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Records that the given define is about to be defined or undefined while preprocessing the file being recorded.
+*/
+void ppcache_change_define(
+  const char* name  /*!< Name of define being defined or undefined */
+) { PROFILE(PPCACHE_CHANGE_DEFINE);
+
+  if( ppcache_recording ) {
+    (void)tree_add( name, "1", TRUE, &ppcache_touched );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Stores the given preprocessed contents of the file being recorded to the cache along with the files and defines it
+ depends on and the defines that it defined or undefined.  The entry is written to a temporary file that is renamed
+ into place so that a partially written entry is never read.  Failing to write an entry is not fatal.
+*/
+void ppcache_store(
+  const char*  buffer,  /*!< Preprocessed contents of the recorded file */
+  unsigned int size     /*!< Number of characters in buffer */
+) { PROFILE(PPCACHE_STORE);
+
+  if( ppcache_recording ) {
+
+    char*        ename = ppcache_entry_name();
+    unsigned int slen  = strlen( ename ) + 12;
+    char*        tmp   = (char*)malloc_safe( slen );
+    bool         error = TRUE;
+    FILE*        file;
+    unsigned int rv;
+
+    rv = snprintf( tmp, slen, "%s.%d", ename, (int)getpid() );
+    assert( rv < slen );
+
+    if( (file = fopen( tmp, "wb" )) != NULL ) {
+
+      uint32    version = PPCACHE_VERSION;
+      uint32    num     = 0;
+      str_link* strl;
+
+      error = (fwrite( &version, sizeof( uint32 ), 1, file ) != 1) ||
+              (fwrite( &ppcache_key_size, sizeof( uint32 ), 1, file ) != 1) ||
+              (fwrite( ppcache_key, 1, ppcache_key_size, file ) != ppcache_key_size);
+
+      for( strl=ppcache_incl_head; strl!=NULL; strl=strl->next ) {
+        num++;
+      }
+      error = error || (fwrite( &num, sizeof( uint32 ), 1, file ) != 1);
+      for( strl=ppcache_incl_head; (strl!=NULL) && !error; strl=strl->next ) {
+        error = !ppcache_write_str( file, strl->str ) || !ppcache_write_str( file, strl->str2 );
+      }
+
+      num = 0;
+      for( strl=ppcache_miss_head; strl!=NULL; strl=strl->next ) {
+        num++;
+      }
+      error = error || (fwrite( &num, sizeof( uint32 ), 1, file ) != 1);
+      for( strl=ppcache_miss_head; (strl!=NULL) && !error; strl=strl->next ) {
+        error = !ppcache_write_str( file, strl->str );
+      }
+
+      num = 0;
+      for( strl=ppcache_deps_head; strl!=NULL; strl=strl->next ) {
+        num++;
+      }
+      error = error || (fwrite( &num, sizeof( uint32 ), 1, file ) != 1);
+      for( strl=ppcache_deps_head; (strl!=NULL) && !error; strl=strl->next ) {
+        error = !ppcache_write_define( file, strl->str, strl->str2 );
+      }
+
+      num   = ppcache_count_changes( ppcache_touched );
+      error = error || (fwrite( &num, sizeof( uint32 ), 1, file ) != 1) || !ppcache_write_changes( file, ppcache_touched );
+
+      num   = size;
+      error = error || (fwrite( &num, sizeof( uint32 ), 1, file ) != 1) || (fwrite( buffer, 1, size, file ) != size);
+
+      if( fclose( file ) != 0 ) {
+        error = TRUE;
+      }
+
+      if( !error ) {
+        error = (rename( tmp, ename ) != 0);
+      }
+      if( error ) {
+        (void)remove( tmp );
+      }
+
+    }
+
+    if( error && !ppcache_write_warned ) {
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "Unable to write preprocessor cache entries to directory \"%s\"", ppcache_dir );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, WARNING, __FILE__, __LINE__ );
+      ppcache_write_warned = TRUE;
+    }
+
+    free_safe( tmp, slen );
+    free_safe( ename, (strlen( ename ) + 1) );
+
+    ppcache_cancel();
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Stops recording the current file and clears the current key without storing anything to the cache.
+*/
+void ppcache_cancel() { PROFILE(PPCACHE_CANCEL);
+
+  ppcache_recording = FALSE;
+  ppcache_key_size  = 0;
+
+  str_link_delete_list( ppcache_incl_head );
+  ppcache_incl_head = NULL;
+  ppcache_incl_tail = NULL;
+
+  str_link_delete_list( ppcache_miss_head );
+  ppcache_miss_head = NULL;
+  ppcache_miss_tail = NULL;
+
+  str_link_delete_list( ppcache_deps_head );
+  ppcache_deps_head = NULL;
+  ppcache_deps_tail = NULL;
+
+  tree_dealloc( ppcache_touched );
+  ppcache_touched = NULL;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous reset_pplexer PPVLlex
+
+ Runs the preprocessor on the given Verilog file and stores its output to the cache if it is being recorded.
+*/
+static void ppcache_preprocess(
+  char* fname  /*!< Name of Verilog file to preprocess */
+) { PROFILE(PPCACHE_PREPROCESS);
+
+  char*        buffer      = NULL;  /* Preprocessed contents (allocated by open_memstream) */
+  size_t       buffer_size = 0;     /* Number of characters in buffer */
+  FILE*        out;
+  unsigned int rv;
+
+  if( (out = open_memstream( &buffer, &buffer_size )) == NULL ) {
+    ppcache_cancel();
+    Throw 0;
+  }
+
+  Try {
+    reset_pplexer( fname, out );
+    (void)PPVLlex();
+  } Catch_anonymous {
+    rv = fclose( out );
+    assert( rv == 0 );
+    free( buffer );
+    ppcache_cancel();
+    Throw 0;
+  }
+
+  rv = fclose( out );
+  assert( rv == 0 );
+
+  ppcache_store( buffer, buffer_size );
+  free( buffer );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous ppcache_preprocess
+
+ Preprocesses the given number of non-library files, starting with the given file, in order and stores their output
+ to the cache.  Files whose output is already in the cache for the current defines are only loaded from it.
+*/
+static void ppcache_preprocess_group(
+  str_link*    strl,  /*!< Pointer to first file of the group in the list of used files */
+  unsigned int num    /*!< Number of non-library files in the group */
+) { PROFILE(PPCACHE_PREPROCESS_GROUP);
+
+  while( (strl != NULL) && (num > 0) ) {
+    if( (strl->suppl & 0x1) == 0x0 ) {
+      char*        buffer;
+      unsigned int size;
+      if( ppcache_load( strl->str, &buffer, &size ) ) {
+        free_safe( buffer, (size + 1) );
+      } else {
+        ppcache_preprocess( strl->str );
+      }
+      num--;
+    }
+    strl = strl->next;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Runs in a forked worker process.  Preprocesses the given number of non-library files, starting with the given
+ file, and stores their output to the cache.  The defines of each file are seen by the files that follow it in the
+ group.
+
+ \par
+ Every worker but the first starts without the defines of the files before its group, so it first preprocesses its
+ group speculatively.  It then reads the defines at the start of its group from the preceding worker and goes
+ through its group again, which only loads the files whose looked up defines were right and preprocesses the rest
+ again with the correct defines.  The defines at the end of the group are written to the following worker.  This
+ function never returns; a worker stops at the first file that cannot be preprocessed, which is reported by the
+ serial parse, and then the following workers keep their speculative output.
+*/
+static void ppcache_worker(
+  str_link*    strl,  /*!< Pointer to first file of the group in the list of used files */
+  unsigned int num,   /*!< Number of non-library files in the group */
+  int          in,    /*!< Pipe to read the defines at the start of the group from (-1 for the first group) */
+  int          out    /*!< Pipe to write the defines at the end of the group to (-1 for the last group) */
+) { PROFILE(PPCACHE_WORKER);
+
+  int   status = EXIT_SUCCESS;
+  FILE* file;
+
+  /* The serial parse outputs any messages about these files */
+  (void)freopen( "/dev/null", "w", stdout );
+  (void)freopen( "/dev/null", "w", stderr );
+
+  if( in != -1 ) {
+
+    ppcache_speculative = TRUE;
+
+    /* A file that fails with the wrong defines may succeed with the right ones, so carry on to the second pass */
+    Try {
+      ppcache_preprocess_group( strl, num );
+    } Catch_anonymous {}
+
+    ppcache_speculative = FALSE;
+
+    if( ((file = fdopen( in, "rb" )) == NULL) || !ppcache_read_defines( file ) ) {
+      status = EXIT_FAILURE;
+    }
+
+  }
+
+  if( status == EXIT_SUCCESS ) {
+    Try {
+      ppcache_preprocess_group( strl, num );
+    } Catch_anonymous {
+      status = EXIT_FAILURE;
+    }
+  }
+
+  /* Pass the defines on to the following worker (closing the pipe without them stops it after its first pass) */
+  if( (status == EXIT_SUCCESS) && (out != -1) ) {
+    if( (file = fdopen( out, "wb" )) != NULL ) {
+      uint32 def_num = ppcache_count_defines( def_table );
+      if( fwrite( &def_num, sizeof( uint32 ), 1, file ) == 1 ) {
+        (void)ppcache_write_defines( file, def_table );
+      }
+      (void)fclose( file );
+    }
+  }
+
+  _exit( status );
+
+  PROFILE_END;
+
+}
+
+/*!
+ Fills the preprocessor cache for the non-library files in the list of used files using up to the given number of
+ worker processes before the design is parsed.  The files are split into groups of consecutive files, one per
+ worker, and each worker is connected to the following one with a pipe to pass on the defines at the end of its
+ group (see ppcache_worker).  Each file is therefore found in the cache by the serial parse unless it could not be
+ preprocessed.  If the cache is not enabled, a temporary cache directory is created for the workers to fill.
+*/
+void ppcache_populate(
+  unsigned int jobs  /*!< Maximum number of worker processes to use */
+) { PROFILE(PPCACHE_POPULATE);
+
+  unsigned int file_num = 0;
+  str_link*    strl;
+
+  for( strl=use_files_head; strl!=NULL; strl=strl->next ) {
+    if( (strl->suppl & 0x1) == 0x0 ) {
+      file_num++;
+    }
+  }
+
+  /* Without a cache directory, the workers fill a temporary one that only lasts until the design has been parsed */
+  if( (ppcache_dir == NULL) && (jobs > 1) && (file_num > 1) ) {
+    const char*  tmpdir = (getenv( "TMPDIR" ) != NULL) ? getenv( "TMPDIR" ) : "/tmp";
+    unsigned int slen   = strlen( tmpdir ) + 24;
+    unsigned int rv;
+    ppcache_dir = (char*)malloc_safe( slen );
+    rv = snprintf( ppcache_dir, slen, "%s/covered_ppcacheXXXXXX", tmpdir );
+    assert( rv < slen );
+    if( mkdtemp( ppcache_dir ) != NULL ) {
+      ppcache_dir_temp = TRUE;
+    } else {
+      print_output( "Unable to create a temporary preprocessor cache directory for the -j option.  Preprocessing serially...", WARNING, __FILE__, __LINE__ );
+      free_safe( ppcache_dir, slen );
+      ppcache_dir = NULL;
+    }
+  }
+
+  if( (ppcache_dir != NULL) && (jobs > 1) && (file_num > 1) ) {
+
+    unsigned int group_size = (file_num + jobs - 1) / jobs;
+    unsigned int group_num  = (file_num + group_size - 1) / group_size;
+    pid_t*       pids       = (pid_t*)malloc_safe( sizeof( pid_t ) * group_num );
+    int*         fds        = (int*)malloc_safe( sizeof( int ) * 2 * group_num );
+    unsigned int count      = 0;
+    bool         piped      = TRUE;
+    unsigned int i;
+    unsigned int j;
+
+    /* Create the pipes that connect each worker to the following one (worker i+1 reads fds[2*i]) */
+    for( i=0; i<(2 * group_num); i++ ) {
+      fds[i] = -1;
+    }
+    for( i=0; ((i + 1) < group_num) && piped; i++ ) {
+      piped = (pipe( fds + (2 * i) ) == 0);
+    }
+
+    i = 0;
+
+    if( piped ) {
+
+      /* Make sure that buffered output is not duplicated by the worker processes */
+      (void)fflush( stdout );
+      (void)fflush( stderr );
+
+      /* Start a worker process for each group of consecutive non-library files */
+      for( strl=use_files_head; strl!=NULL; strl=strl->next ) {
+        if( (strl->suppl & 0x1) == 0x0 ) {
+          if( (count % group_size) == 0 ) {
+            if( (pids[i] = fork()) == 0 ) {
+              int in  = (i > 0) ? fds[2*(i-1)] : -1;
+              int out = fds[(2*i)+1];
+              for( j=0; j<(2 * group_num); j++ ) {
+                if( (fds[j] != -1) && (fds[j] != in) && (fds[j] != out) ) {
+                  (void)close( fds[j] );
+                }
+              }
+              ppcache_worker( strl, group_size, in, out );
+            }
+            i++;
+          }
+          count++;
+        }
+      }
+
+    } else {
+      print_output( "Unable to create pipes for the -j option.  Preprocessing serially...", WARNING, __FILE__, __LINE__ );
+    }
+
+    for( j=0; j<(2 * group_num); j++ ) {
+      if( fds[j] != -1 ) {
+        (void)close( fds[j] );
+      }
+    }
+
+    /* Wait for all of the workers to complete (any file that a worker did not store is preprocessed by the parser) */
+    for( j=0; j<i; j++ ) {
+      if( pids[j] > 0 ) {
+        int status;
+        (void)waitpid( pids[j], &status, 0 );
+      }
+    }
+
+    free_safe( fds, (sizeof( int ) * 2 * group_num) );
+    free_safe( pids, (sizeof( pid_t ) * group_num) );
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Deallocates all memory used by the preprocessor cache and reports the number of files that were loaded from it.
+*/
+void ppcache_dealloc() { PROFILE(PPCACHE_DEALLOC);
+
+  if( ppcache_dir_temp ) {
+
+    DIR* dir;
+
+    if( ppcache_hits > 0 ) {
+      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Used the preprocessor output of %u files that were preprocessed in parallel", ppcache_hits );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+    }
+
+    /* Remove the temporary cache directory and everything that was stored in it */
+    if( (dir = opendir( ppcache_dir )) != NULL ) {
+      struct dirent* dirp;
+      while( (dirp = readdir( dir )) != NULL ) {
+        if( (strcmp( dirp->d_name, "." ) != 0) && (strcmp( dirp->d_name, ".." ) != 0) ) {
+          unsigned int slen = strlen( ppcache_dir ) + strlen( dirp->d_name ) + 2;
+          char*        path = (char*)malloc_safe( slen );
+          unsigned int rv   = snprintf( path, slen, "%s/%s", ppcache_dir, dirp->d_name );
+          assert( rv < slen );
+          (void)remove( path );
+          free_safe( path, slen );
+        }
+      }
+      (void)closedir( dir );
+    }
+    (void)rmdir( ppcache_dir );
+
+    ppcache_dir_temp = FALSE;
+
+  } else if( ppcache_hits > 0 ) {
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Loaded preprocessor output of %u files from cache directory \"%s\"", ppcache_hits, ppcache_dir );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+  }
+
+  ppcache_cancel();
+
+  free_safe( ppcache_key, ppcache_key_alloc );
+  ppcache_key       = NULL;
+  ppcache_key_alloc = 0;
+
+  free_safe( ppcache_dir, (strlen( ppcache_dir ) + 1) );
+  ppcache_dir = NULL;
+
+  ppcache_hits = 0;
+
+  PROFILE_END;
+
+}
+
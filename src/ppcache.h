@@ -0,0 +1,74 @@
+#ifndef __PPCACHE_H__
+#define __PPCACHE_H__
+
+/*
+ Copyright (c) 2026 agent
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     ppcache.h
+ \author   agent
+ \date     10/18/2026
+ \brief    Contains functions for caching preprocessor output between score runs.
+*/
+
+#include "defines.h"
+
+
+/*! \brief Loads the preprocessed contents of the given file from the cache or starts recording them. */
+bool ppcache_load(
+            const char*   fname,
+  /*@out@*/ char**        buffer,
+  /*@out@*/ unsigned int* size
+);
+
+/*! \brief Records an include file that was read while preprocessing. */
+void ppcache_add_include(
+  const char* path
+);
+
+/*! \brief Records an include file candidate that could not be opened while preprocessing. */
+void ppcache_add_missing(
+  const char* path
+);
+
+/*! \brief Records that a define is about to be looked up while preprocessing. */
+void ppcache_use_define(
+  const char* name
+);
+
+/*! \brief Records that a define is about to be defined or undefined while preprocessing. */
+void ppcache_change_define(
+  const char* name
+);
+
+/*! \brief Stores the preprocessed contents of the recorded file to the cache. */
+void ppcache_store(
+  const char*  buffer,
+  unsigned int size
+);
+
+/*! \brief Stops recording without storing anything to the cache. */
+void ppcache_cancel();
+
+/*! \brief Fills the cache for the files to be parsed using parallel worker processes. */
+void ppcache_populate(
+  unsigned int jobs
+);
+
+/*! \brief Deallocates all memory used by the preprocessor cache. */
+void ppcache_dealloc();
+
+#endif
+
@@ -60,6 +60,27 @@ static stmt_blk* sb = NULL;
 */
 static int sb_size;
 
+/*!
+ Open-addressed hash table of the statements found in the statement blocks of the sb array (NULL if the slot is
+ empty).  Maps each statement to the first statement block that contains it.
+*/
+static statement** sb_map_stmts = NULL;
+
+/*!
+ Index in the sb array of the statement block containing the statement in the same slot of sb_map_stmts.
+*/
+static int* sb_map_blks = NULL;
+
+/*!
+ Number of slots in the sb_map_stmts and sb_map_blks arrays (always a power of two).
+*/
+static unsigned int sb_map_size = 0;
+
+/*!
+ Number of statements stored in the sb_map_stmts array.
+*/
+static unsigned int sb_map_num = 0;
+
 /*!
  Tracks the number of race conditions that were detected during the race-condition checking portion of the
  scoring command.
@@ -121,103 +142,135 @@ static race_blk* race_blk_create(
 
 #ifndef RUNLIB
 /*!
- \return Returns TRUE if the specified to_find statement was found in the statement block specified
-         by curr; otherwise, returns FALSE.
-
- Recursively iterates through specified statement block, searching for statement pointed to by to_find.
- If the statement is found, a value of TRUE is returned to the calling function; otherwise, a value of
- FALSE is returned.
+ \return Returns the slot of the statement block map that contains the given statement or the empty slot where
+         it would be stored.
 */
-static bool race_find_head_statement_containing_statement_helper(
-  statement* curr,    /*!< Pointer to current statement to check */
-  statement* to_find  /*!< Pointer to statement to find */
-) { PROFILE(RACE_FIND_HEAD_STATEMENT_CONTAINING_STATEMENT_HELPER);
+static unsigned int race_map_slot(
+  statement* stmt  /*!< Pointer to statement to find slot for */
+) { PROFILE(RACE_MAP_SLOT);
 
-  bool retval = FALSE;  /* Return value for this function */
+  unsigned int slot = util_hash( HASH_INIT, &stmt, sizeof( statement* ) ) & (sb_map_size - 1);
 
-  if( (curr != NULL) && (curr->conn_id != stmt_conn_id) ) {
+  while( (sb_map_stmts[slot] != NULL) && (sb_map_stmts[slot] != stmt) ) {
+    slot = (slot + 1) & (sb_map_size - 1);
+  }
 
-    curr->conn_id = stmt_conn_id;
+  PROFILE_END;
 
-    if( curr == to_find ) {
+  return( slot );
 
-      retval = TRUE;
+}
 
-    } else {
+/*!
+ Records that the given statement is contained in the statement block at the given index of the sb array, unless
+ it was already found in an earlier statement block.  The table is doubled in size when it becomes half full.
+*/
+static void race_map_add(
+  statement* stmt,     /*!< Pointer to statement to add */
+  int        sb_index  /*!< Index of statement block in sb array containing the statement */
+) { PROFILE(RACE_MAP_ADD);
 
-      /* 
-       If the current statement is a named block call, task call or fork statement, look for specified
-       statement in its statement block.
-      */
-      if( (curr->exp->op == EXP_OP_NB_CALL)   ||
-          (curr->exp->op == EXP_OP_TASK_CALL) ||
-          (curr->exp->op == EXP_OP_FORK) ) {
-        retval = race_find_head_statement_containing_statement_helper( curr->exp->elem.funit->first_stmt, to_find );
-      }
+  unsigned int slot;
 
-      if( !retval && (curr->suppl.part.stop_true == 0) ) {
-        retval = race_find_head_statement_containing_statement_helper( curr->next_true, to_find );
-      }
-   
-      if( !retval && (curr->suppl.part.stop_false == 0) && (curr->next_true != curr->next_false) ) {
-        retval = race_find_head_statement_containing_statement_helper( curr->next_false, to_find );
-      }
+  /* Grow the table (rehashing all current entries) if it is half full */
+  if( ((sb_map_num + 1) * 2) > sb_map_size ) {
+
+    statement**  old_stmts = sb_map_stmts;
+    int*         old_blks  = sb_map_blks;
+    unsigned int old_size  = sb_map_size;
+    unsigned int i;
+
+    sb_map_size  = (old_size == 0) ? 256 : (old_size * 2);
+    sb_map_stmts = (statement**)malloc_safe_nolimit( sizeof( statement* ) * sb_map_size );
+    sb_map_blks  = (int*)malloc_safe_nolimit( sizeof( int ) * sb_map_size );
 
+    for( i=0; i<sb_map_size; i++ ) {
+      sb_map_stmts[i] = NULL;
     }
 
+    for( i=0; i<old_size; i++ ) {
+      if( old_stmts[i] != NULL ) {
+        slot = race_map_slot( old_stmts[i] );
+        sb_map_stmts[slot] = old_stmts[i];
+        sb_map_blks[slot]  = old_blks[i];
+      }
+    }
+
+    free_safe( old_stmts, (sizeof( statement* ) * old_size) );
+    free_safe( old_blks,  (sizeof( int ) * old_size) );
+
   }
 
-  PROFILE_END;
+  slot = race_map_slot( stmt );
 
-  return( retval );
+  if( sb_map_stmts[slot] == NULL ) {
+    sb_map_stmts[slot] = stmt;
+    sb_map_blks[slot]  = sb_index;
+    sb_map_num++;
+  }
+
+  PROFILE_END;
 
 }
 
 /*!
- \return Returns a pointer to the statement block containing the given statement (if one is found); otherwise,
-         returns a value of NULL.
-
- Searches all statement blocks for one that contains the given statement within it.  Once it is found, a pointer
- to the head statement block is returned to the calling function.  If it is not found, a value of NULL is returned,
- indicating that the statement block could not be found for the given statement.
+ Deallocates the statement block map, leaving it empty.
 */
-static statement* race_find_head_statement_containing_statement(
-  statement* stmt  /*!< Pointer to statement to search for matching statement block */
-) { PROFILE(RACE_FIND_HEAD_STATEMENT_CONTAINING_STATEMENT);
+static void race_map_dealloc() { PROFILE(RACE_MAP_DEALLOC);
 
-  int i = 0;   /* Loop iterator */
+  free_safe( sb_map_stmts, (sizeof( statement* ) * sb_map_size) );
+  free_safe( sb_map_blks,  (sizeof( int ) * sb_map_size) );
 
-  while( (i < sb_size) && !race_find_head_statement_containing_statement_helper( sb[i].stmt, stmt ) ) {
-    i++;
-    stmt_conn_id++;
-  }
+  sb_map_stmts = NULL;
+  sb_map_blks  = NULL;
+  sb_map_size  = 0;
+  sb_map_num   = 0;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the index in the sb array of the first statement block that contains the given statement or -1
+         if no statement block contains it.
+*/
+static int race_map_find(
+  statement* stmt  /*!< Pointer to statement to find */
+) { PROFILE(RACE_MAP_FIND);
 
-  if( i < sb_size ) {
-    stmt_conn_id++;
+  int retval = -1;
+
+  if( sb_map_num > 0 ) {
+    unsigned int slot = race_map_slot( stmt );
+    if( sb_map_stmts[slot] != NULL ) {
+      retval = sb_map_blks[slot];
+    }
   }
 
   PROFILE_END;
 
-  return( (i == sb_size) ? NULL : sb[i].stmt );
+  return( retval );
 
 }
 
 /*!
- \return Returns pointer to head statement of statement block containing the specified expression
+ \return Returns pointer to head statement of statement block containing the specified expression or NULL if
+         no statement block contains it.
 
- Finds the head statement of the statement block containing the expression specified in the parameter list.
- Verifies that the return value is never NULL (this would be an internal error if it existed).
+ Finds the head statement of the statement block containing the expression specified in the parameter list
+ by looking up the statement of the expression in the statement block map built by race_calc_assignments.
 */
 static statement* race_get_head_statement(
   expression* expr  /*!< Pointer to root expression to find in statement list */
 ) { PROFILE(RACE_GET_HEAD_STATEMENT);
 
   statement* curr_stmt;  /* Pointer to current statement containing the expression */
+  int        i;
 
   /* First, find the statement associated with this expression */
   if( (curr_stmt = expression_get_root_statement( expr )) != NULL ) {
 
-    curr_stmt = race_find_head_statement_containing_statement( curr_stmt );
+    curr_stmt = ((i = race_map_find( curr_stmt )) == -1) ? NULL : sb[i].stmt;
 
   }
 
@@ -235,10 +288,14 @@ static int race_find_head_statement(
   statement* stmt  /*!< Pointer to statement to search for in statement block array */
 ) { PROFILE(RACE_FIND_HEAD_STATEMENT);
 
-  int i = 0;   /* Loop iterator */
+  int i = race_map_find( stmt );
 
-  while( (i < sb_size) && (sb[i].stmt != stmt) ) {
-    i++;
+  /* A head statement is normally found first in its own statement block; otherwise, search the array */
+  if( (i == -1) || (sb[i].stmt != stmt) ) {
+    i = 0;
+    while( (i < sb_size) && (sb[i].stmt != stmt) ) {
+      i++;
+    }
   }
 
   PROFILE_END;
@@ -303,7 +360,8 @@ static void race_calc_expr_assignment(
 
 /*!
  Recursively iterates through the given statement block, searching for all assignment types used
- within the block.
+ within the block.  Every statement found is also added to the statement block map so that the
+ statement block containing any statement can be looked up later on.
 */
 void race_calc_assignments(
   statement* stmt,     /*!< Pointer to statement to get assign type from */
@@ -314,6 +372,8 @@ void race_calc_assignments(
 
     stmt->conn_id = stmt_conn_id;
 
+    race_map_add( stmt, sb_index );
+
     /* Calculate children statements */
     if( stmt->suppl.part.stop_true == 0 ) {
       race_calc_assignments( stmt->next_true, sb_index );
@@ -809,8 +869,9 @@ void race_check_modules() { PROFILE(RACE_CHECK_MODULES);
           }
         }
 
-        /* Deallocate stmt_blk list */
+        /* Deallocate stmt_blk list and statement block map */
         free_safe( sb, (sizeof( stmt_blk ) * sb_size) );
+        race_map_dealloc();
 
       }
 
@@ -832,10 +893,14 @@ void race_check_modules() { PROFILE(RACE_CHECK_MODULES);
  Writes contents of specified race condition block to the specified output stream.
 */
 void race_db_write(
-  race_blk* rb,   /*!< Pointer to race condition block to write to specified output file */
-  FILE*     file  /*!< File handle of output stream to write */
+  race_blk* rb,          /*!< Pointer to race condition block to write to specified output file */
+  FILE*     file,        /*!< File handle of output stream to write */
+  uint64*   fingerprint  /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(RACE_DB_WRITE);
 
+  *fingerprint = util_hash64_uint32( *fingerprint, DB_TYPE_RACE );
+  *fingerprint = util_hash64_uint32( *fingerprint, rb->reason );
+
   fprintf( file, "%d %d %d %d\n",
     DB_TYPE_RACE,
     rb->reason,
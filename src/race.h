@@ -35,7 +35,8 @@ void race_check_modules();
 /*! \brief Writes contents of specified race condition block to specified file output */
 void race_db_write(
   race_blk* head,
-  FILE*     file
+  FILE*     file,
+  uint64*   fingerprint
 );
 
 /*! \brief Reads contents from specified line for a race condition block and assigns the new block to the curr_mod */
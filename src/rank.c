@@ -20,16 +20,23 @@
 */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <assert.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include "comb.h"
 #include "defines.h"
 #include "expr.h"
 #include "fsm.h"
 #include "func_iter.h"
+#include "info.h"
 #include "link.h"
 #include "profiler.h"
 #include "rank.h"
+#include "tree.h"
 #include "util.h"
 #include "vsignal.h"
 
@@ -105,6 +112,62 @@ static unsigned int longest_name_len = 0;
 */
 static bool rank_verbose = FALSE;
 
+/*!
+ If set to TRUE, the final greedy sort rescores every remaining CDD file after each selection instead of only
+ rescoring the best candidate.  This value is set to TRUE when the -exact option is specified.
+*/
+static bool rank_exact = FALSE;
+
+/*!
+ Specifies the maximum number of worker processes that may read in CDD files in parallel (value of the -j option).
+*/
+static unsigned int rank_jobs = 0;
+
+/*!
+ Name of the rank cache file to load compressed CDD coverage information from and save it to (value of the -cache
+ option).
+*/
+static char* rank_cache_file = NULL;
+
+/*!
+ Handle to the opened rank cache file while CDD files are being read in.
+*/
+static FILE* rank_cache_handle = NULL;
+
+/*!
+ Tree of the CDD files stored in the rank cache file.  Each node is keyed by the CDD filename and its value
+ contains the modification time and size of the CDD file when it was cached along with the file offset of its
+ compressed coverage information.
+*/
+static tnode* rank_cache_tree = NULL;
+
+/*!
+ Design fingerprint stored in the rank cache file.
+*/
+static uint64 rank_cache_fingerprint = 0;
+
+/*!
+ Number of coverage points for each metric stored in the rank cache file.
+*/
+static uint64 rank_cache_cps[CP_TYPE_NUM] = {0};
+
+/*!
+ Set to TRUE when the rank cache file was found to describe the same design as the CDD files being ranked.
+*/
+static bool rank_cache_valid = FALSE;
+
+/*!
+ Number of CDD files whose compressed coverage information was loaded from the rank cache file.
+*/
+static unsigned int rank_cache_hits = 0;
+
+/*!
+ Design fingerprint of the first CDD file read in (or 0 if that CDD file does not contain one).  Subsequent
+ CDD files with the same fingerprint are known to contain the same coverage points outside of FSMs, and CDD
+ files with a different fingerprint are rejected.
+*/
+static uint64 rank_fingerprint = 0;
+
 
 #ifdef OBSOLETE
 /*!
@@ -121,6 +184,7 @@ static inline unsigned int rank_count_bits_uchar(
   return( (unsigned int)v );
   
 }
+#endif
 
 /*!
  \return Returns the number of bits that are set in the given 32-bit unsigned integer.
@@ -156,8 +220,52 @@ static inline unsigned int rank_count_bits_uint64(
   return( (unsigned int)v );
 
 }
+
+/*!
+ \return Returns the number of bits that are set in the given unsigned long.
+
+ Uses the population count instruction of the target machine when the compiler provides access to it.
+*/
+static inline unsigned int rank_count_bits(
+  ulong v  /*!< Coverage point word to count bits for */
+) {
+
+#if defined(__GNUC__) && ((__GNUC__ > 3) || ((__GNUC__ == 3) && (__GNUC_MINOR__ >= 4)))
+  return( (unsigned int)__builtin_popcountl( v ) );
+#elif SIZEOF_LONG == 8
+  return( rank_count_bits_uint64( (uint64)v ) );
+#else
+  return( rank_count_bits_uint32( (uint32)v ) );
 #endif
 
+}
+
+/*!
+ \return Returns the bit position of the least significant set bit in the given (non-zero) unsigned long.
+*/
+static inline unsigned int rank_lowest_bit(
+  ulong v  /*!< Coverage point word to search */
+) {
+
+#if defined(__GNUC__) && ((__GNUC__ > 3) || ((__GNUC__ == 3) && (__GNUC_MINOR__ >= 4)))
+  return( (unsigned int)__builtin_ctzl( v ) );
+#else
+  return( rank_count_bits( (v & (~v + 1)) - 1 ) );
+#endif
+
+}
+
+/*!
+ \return Returns the number of unsigned long words needed to store the given number of coverage points.
+*/
+static inline unsigned int rank_num_words(
+  uint64 cps  /*!< Number of coverage points */
+) {
+
+  return( (cps > 0) ? (UL_DIV(cps) + 1) : 0 );
+
+}
+
 /*!
  \return Returns a pointer to a newly allocated and initialized compressed CDD coverage structure.
 */
@@ -237,8 +345,16 @@ static void rank_usage() {
   printf( "   -h                           Displays this help information.\n" );
   printf( "\n" );
   printf( "   Options:\n" );
+  printf( "      -cache <filename>         Name of rank cache file.  Coverage information of CDD files that have not\n" );
+  printf( "                                  changed since they were stored in this file is loaded from it instead\n" );
+  printf( "                                  of reading the CDD files.  The file is updated with the CDD files ranked.\n" );
   printf( "      -depth <number>           Specifies the minimum number of CDD files to hit each coverage point.\n" );
   printf( "                                  The value of <number> should be a value of 1 or more.  Default is 1.\n" );
+  printf( "      -exact                    Rescores every remaining CDD file after each selection when sorting the\n" );
+  printf( "                                  ranked CDD files.  This produces the same order as the default lazy\n" );
+  printf( "                                  rescoring and is only useful for verifying it.\n" );
+  printf( "      -j <number>               Reads in the CDD files using up to <number> worker processes in parallel.\n" );
+  printf( "                                  Default is 1.\n" );
   printf( "      -names-only               If specified, outputs only the needed CDD filenames that need to be\n" );
   printf( "                                  run in the order they need to be run.  If this option is not set, a\n" );
   printf( "                                  report-style output is provided with additional information.\n" );
@@ -312,6 +428,20 @@ static bool rank_parse_args(
       rank_usage();
       help_found = TRUE;
 
+    } else if( strncmp( "-cache", argv[i], 6 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( rank_cache_file != NULL ) {
+          print_output( "Only one -cache option is allowed on the rank command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else {
+          /* The file is not checked with is_legal_filename as that would truncate an existing rank cache file */
+          rank_cache_file = strdup_safe( argv[i] );
+        }
+      } else {
+        Throw 0;
+      }
+
     } else if( strncmp( "-o", argv[i], 2 ) == 0 ) {
 
       if( check_option_value( argc, argv, i ) ) {
@@ -536,6 +666,26 @@ static bool rank_parse_args(
         Throw 0;
       }
 
+    } else if( strncmp( "-exact", argv[i], 6 ) == 0 ) {
+
+      rank_exact = TRUE;
+
+    } else if( strncmp( "-j", argv[i], 2 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( rank_jobs != 0 ) {
+          print_output( "Only one -j option is allowed on the rank command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else {
+          if( (sscanf( argv[i], "%u", &rank_jobs ) != 1) || (rank_jobs == 0) ) {
+            print_output( "Value specified after -j must be a positive, non-zero number", FATAL, __FILE__, __LINE__ );
+            Throw 0;
+          }
+        }
+      } else {
+        Throw 0;
+      }
+
     } else if( strncmp( "-names-only", argv[i], 11 ) == 0 ) {
 
       flag_names_only = TRUE;
@@ -1063,6 +1213,25 @@ static void rank_read_cdd(
 ) { PROFILE(RANK_READ_CDD);
 
   comp_cdd_cov* comp_cov = NULL;
+  uint64        fingerprint;
+  bool          same_design;
+
+  /*
+   The fingerprint does not include the leading hierarchy, so the same design scored under a different testbench
+   has the same fingerprint.  A CDD file with a different fingerprint was created from a different design and is
+   rejected without being read.  CDD files written before fingerprints were stored (fingerprint of 0) are verified
+   in full.
+  */
+  (void)info_read_fingerprint( cdd_name, &fingerprint, NULL, NULL, NULL, NULL );
+  if( first ) {
+    rank_fingerprint = fingerprint;
+  } else if( (rank_fingerprint != 0) && (fingerprint != 0) && (fingerprint != rank_fingerprint) ) {
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "CDD file \"%s\" does not match previously read CDD files", cdd_name );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+  same_design = !first && (rank_fingerprint != 0) && (fingerprint == rank_fingerprint);
 
   Try {
 
@@ -1077,19 +1246,19 @@ static void rank_read_cdd(
     instl = db_list[0]->inst_head;
     while( instl != NULL ) {
       report_gather_instance_stats( instl->inst );
-      if( first ) {
-        rank_calc_num_cps( instl->inst, num_cps );
-      } else {
-        rank_calc_num_cps( instl->inst, tmp_nums );
-      }
+      rank_calc_num_cps( instl->inst, (first ? num_cps : tmp_nums) );
       instl = instl->next;
     }
 
-    /* If we are not the first CDD file being read in, verify that our values match */
+    /*
+     If we are not the first CDD file being read in, verify that our values match.  A CDD file whose design fingerprint
+     matches the first one is known to contain the same coverage points, except for FSM arcs which are learned during
+     simulation and are not part of the fingerprint, so only those are verified for it.
+    */
     if( !first ) {
       unsigned int i;
       for( i=0; i<CP_TYPE_NUM; i++ ) {
-        if( num_cps[i] != tmp_nums[i] ) {
+        if( (!same_design || (i == CP_TYPE_FSM)) && (num_cps[i] != tmp_nums[i]) ) {
           unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "CDD file \"%s\" does not match previously read CDD files", cdd_name );
           assert( rv < USER_MSG_LENGTH );
           print_output( user_msg, FATAL, __FILE__, __LINE__ );
@@ -1126,8 +1295,549 @@ static void rank_read_cdd(
 
 }
 
+/*!
+ Runs in a forked worker process.  Reads in the given CDD files and writes the timesteps and coverage point bits of each one (in order) to the given file.  Only one CDD
+ file is in memory at a time.  This function never returns; the worker exits with a failure status if any error
+ was found.
+*/
+static void rank_worker(
+  str_link**   files,  /*!< Array of CDD files to read */
+  unsigned int num,    /*!< Number of elements in the files array */
+  FILE*        ofile   /*!< File to write compressed CDD coverage information to */
+) { PROFILE(RANK_WORKER);
+
+  int status = EXIT_SUCCESS;
+
+  /* The parent process reports the progress of the read */
+  set_terse( TRUE );
+
+  Try {
+
+    unsigned int i, j;
+
+    for( i=0; i<num; i++ ) {
+
+      comp_cdd_cov** comp_cdds    = NULL;
+      unsigned int   comp_cdd_num = 0;
+      bool           error        = FALSE;
+
+      rank_read_cdd( files[i]->str, (files[i]->suppl == 1), FALSE, &comp_cdds, &comp_cdd_num );
+
+      if( fwrite( &(comp_cdds[0]->timesteps), sizeof( uint64 ), 1, ofile ) != 1 ) {
+        error = TRUE;
+      }
+      for( j=0; j<CP_TYPE_NUM; j++ ) {
+        if( !error && (fwrite( comp_cdds[0]->cps[j], sizeof( ulong ), rank_num_words( num_cps[j] ), ofile ) != rank_num_words( num_cps[j] )) ) {
+          error = TRUE;
+        }
+      }
+
+      rank_dealloc_comp_cdd_cov( comp_cdds[0] );
+      free_safe( comp_cdds, sizeof( comp_cdd_cov* ) );
+
+      if( error ) {
+        print_output( "Unable to write temporary rank information", FATAL, __FILE__, __LINE__ );
+        Throw 0;
+      }
+
+    }
+
+    if( fflush( ofile ) != 0 ) {
+      print_output( "Unable to write temporary rank information", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+
+  } Catch_anonymous {
+    status = EXIT_FAILURE;
+  }
+
+  (void)fflush( stdout );
+  (void)fflush( stderr );
+
+  _exit( status );
+
+  PROFILE_END;
+
+}
+
+/*!
+ Closes the rank cache file and deallocates its index.
+*/
+static void rank_cache_close() { PROFILE(RANK_CACHE_CLOSE);
+
+  if( rank_cache_handle != NULL ) {
+    unsigned int rv = fclose( rank_cache_handle );
+    assert( rv == 0 );
+    rank_cache_handle = NULL;
+  }
+
+  tree_dealloc( rank_cache_tree );
+  rank_cache_tree  = NULL;
+  rank_cache_valid = FALSE;
+
+  PROFILE_END;
+
+}
+
+/*!
+ Opens the rank cache file (if one was specified and exists) and builds an index of the CDD files stored in it.
+ A rank cache file that cannot be used is ignored; it is replaced when the new rank cache file is written.
+*/
+static void rank_cache_open() { PROFILE(RANK_CACHE_OPEN);
+
+  if( (rank_cache_file != NULL) && file_exists( rank_cache_file ) ) {
+
+    bool valid = FALSE;
+
+    if( (rank_cache_handle = fopen( rank_cache_file, "rb" )) != NULL ) {
+
+      uint32 version;
+      uint32 ulong_size;
+      uint32 entries;
+
+      if( (fread( &version,                sizeof( uint32 ), 1,           rank_cache_handle ) == 1)           &&
+          (fread( &ulong_size,             sizeof( uint32 ), 1,           rank_cache_handle ) == 1)           &&
+          (fread( &rank_cache_fingerprint, sizeof( uint64 ), 1,           rank_cache_handle ) == 1)           &&
+          (fread( rank_cache_cps,          sizeof( uint64 ), CP_TYPE_NUM, rank_cache_handle ) == CP_TYPE_NUM) &&
+          (fread( &entries,                sizeof( uint32 ), 1,           rank_cache_handle ) == 1)           &&
+          (version == RANK_CACHE_VERSION) && (ulong_size == sizeof( ulong )) ) {
+
+        long         words = 0;
+        unsigned int i;
+
+        for( i=0; i<CP_TYPE_NUM; i++ ) {
+          words += rank_num_words( rank_cache_cps[i] );
+        }
+
+        /* Index each entry, skipping over its coverage information */
+        valid = TRUE;
+        for( i=0; (i<entries) && valid; i++ ) {
+          uint32 name_len;
+          uint64 mtime;
+          uint64 size;
+          char   name[4096];
+          char   value[4096];
+          valid = (fread( &name_len, sizeof( uint32 ), 1, rank_cache_handle ) == 1) &&
+                  (name_len < 4096) &&
+                  (fread( name, 1, name_len, rank_cache_handle ) == name_len) &&
+                  (fread( &mtime, sizeof( uint64 ), 1, rank_cache_handle ) == 1) &&
+                  (fread( &size,  sizeof( uint64 ), 1, rank_cache_handle ) == 1);
+          if( valid ) {
+            unsigned int rv;
+            name[name_len] = '\0';
+            /*@-duplicatequals -formattype -formatcode@*/
+            rv = snprintf( value, 4096, "%" FMT64 "u %" FMT64 "u %ld", mtime, size, ftell( rank_cache_handle ) );
+            /*@=duplicatequals =formattype =formatcode@*/
+            assert( rv < 4096 );
+            (void)tree_add( name, value, TRUE, &rank_cache_tree );
+            valid = (fseek( rank_cache_handle, (long)sizeof( uint64 ) + (words * (long)sizeof( ulong )), SEEK_CUR ) == 0);
+          }
+        }
+
+      }
+
+    }
+
+    if( !valid ) {
+      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Rank cache file \"%s\" could not be read and will be rewritten", rank_cache_file );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, WARNING, __FILE__, __LINE__ );
+      rank_cache_close();
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the offset of the compressed coverage information of the given CDD file within the rank cache
+         file, or -1 if the CDD file is not cached or has been modified since it was cached.
+*/
+static long rank_cache_find(
+  const char* cdd_name  /*!< Name of CDD file to find */
+) { PROFILE(RANK_CACHE_FIND);
+
+  long        offset = -1;
+  tnode*      node;
+  struct stat filestat;
+
+  if( ((node = tree_find( cdd_name, rank_cache_tree )) != NULL) && (stat( cdd_name, &filestat ) == 0) ) {
+    uint64 mtime;
+    uint64 size;
+    long   off;
+    /*@-duplicatequals -formattype -formatcode@*/
+    if( (sscanf( node->value, "%" FMT64 "u %" FMT64 "u %ld", &mtime, &size, &off ) == 3) &&
+    /*@=duplicatequals =formattype =formatcode@*/
+        (mtime == (uint64)filestat.st_mtime) && (size == (uint64)filestat.st_size) ) {
+      offset = off;
+    }
+  }
+
+  PROFILE_END;
+
+  return( offset );
+
+}
+
+/*!
+ \return Returns TRUE if the compressed coverage information of the given CDD file was loaded from the rank cache
+         file and added to the comp_cdds array; otherwise, returns FALSE.
+*/
+static bool rank_cache_read_cdd(
+            const char*     cdd_name,     /*!< Filename of CDD file to load */
+            bool            required,     /*!< Specifies if CDD file is required to be ranked */
+            long            offset,       /*!< Offset of the compressed coverage information within the rank cache file */
+  /*@out@*/ comp_cdd_cov*** comp_cdds,    /*!< Pointer to compressed CDD array */
+  /*@out@*/ unsigned int*   comp_cdd_num  /*!< Number of compressed CDD structures in comp_cdds array */
+) { PROFILE(RANK_CACHE_READ_CDD);
+
+  bool   retval = FALSE;
+  uint64 timesteps;
+
+  if( (fseek( rank_cache_handle, offset, SEEK_SET ) == 0) && (fread( &timesteps, sizeof( uint64 ), 1, rank_cache_handle ) == 1) ) {
+
+    comp_cdd_cov* comp_cov = rank_create_comp_cdd_cov( cdd_name, required, timesteps );
+    unsigned int  i;
+
+    retval = TRUE;
+    for( i=0; (i<CP_TYPE_NUM) && retval; i++ ) {
+      retval = (fread( comp_cov->cps[i], sizeof( ulong ), rank_num_words( num_cps[i] ), rank_cache_handle ) == rank_num_words( num_cps[i] ));
+    }
+
+    if( retval ) {
+      *comp_cdds = (comp_cdd_cov**)realloc_safe( *comp_cdds, (sizeof( comp_cdd_cov* ) * (*comp_cdd_num)), (sizeof( comp_cdd_cov* ) * (*comp_cdd_num + 1)) );
+      (*comp_cdds)[*comp_cdd_num] = comp_cov;
+      (*comp_cdd_num)++;
+      rank_cache_hits++;
+    } else {
+      rank_dealloc_comp_cdd_cov( comp_cov );
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \throws anonymous rank_read_cdd
+
+ Reads in the first CDD file to rank, which determines the number of coverage points of the design.  If the CDD
+ file is found in the rank cache file, the coverage point information of the cache is used; otherwise, the CDD file
+ is read in and the rank cache file is only used if it was created for the same design.
+*/
+static void rank_read_first_cdd(
+            str_link*       strl,         /*!< Pointer to first CDD file to read */
+  /*@out@*/ comp_cdd_cov*** comp_cdds,    /*!< Pointer to compressed CDD array */
+  /*@out@*/ unsigned int*   comp_cdd_num  /*!< Number of compressed CDD structures in comp_cdds array */
+) { PROFILE(RANK_READ_FIRST_CDD);
+
+  long         offset = rank_cache_find( strl->str );
+  unsigned int i;
+
+  if( offset >= 0 ) {
+    for( i=0; i<CP_TYPE_NUM; i++ ) {
+      num_cps[i] = rank_cache_cps[i];
+    }
+    rank_fingerprint = rank_cache_fingerprint;
+    rank_cache_valid = TRUE;
+  }
+
+  if( (offset < 0) || !rank_cache_read_cdd( strl->str, (strl->suppl == 1), offset, comp_cdds, comp_cdd_num ) ) {
+
+    for( i=0; i<CP_TYPE_NUM; i++ ) {
+      num_cps[i] = 0;
+    }
+    rank_cache_valid = FALSE;
+
+    rank_read_cdd( strl->str, (strl->suppl == 1), TRUE, comp_cdds, comp_cdd_num );
+
+    /* The cached coverage information can only be used if it was created from the same design */
+    if( rank_cache_handle != NULL ) {
+      rank_cache_valid = ((rank_fingerprint == 0) || (rank_cache_fingerprint == 0) || (rank_fingerprint == rank_cache_fingerprint));
+      for( i=0; i<CP_TYPE_NUM; i++ ) {
+        rank_cache_valid = rank_cache_valid && (num_cps[i] == rank_cache_cps[i]);
+      }
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous rank_read_cdd
+
+ Reads in the given CDD file that is not the first CDD file to rank, loading it from the rank cache file if possible.
+*/
+static void rank_read_next_cdd(
+            str_link*       strl,         /*!< Pointer to CDD file to read */
+  /*@out@*/ comp_cdd_cov*** comp_cdds,    /*!< Pointer to compressed CDD array */
+  /*@out@*/ unsigned int*   comp_cdd_num  /*!< Number of compressed CDD structures in comp_cdds array */
+) { PROFILE(RANK_READ_NEXT_CDD);
+
+  long offset = rank_cache_valid ? rank_cache_find( strl->str ) : -1;
+
+  if( (offset < 0) || !rank_cache_read_cdd( strl->str, (strl->suppl == 1), offset, comp_cdds, comp_cdd_num ) ) {
+    rank_read_cdd( strl->str, (strl->suppl == 1), FALSE, comp_cdds, comp_cdd_num );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Writes the compressed coverage information of all of the given CDD files to the rank cache file, replacing its
+ previous contents.  Failing to write the rank cache file is not fatal to the rank command.
+*/
+static void rank_cache_write(
+  comp_cdd_cov** comp_cdds,    /*!< Array of compressed CDD coverage structures to store */
+  unsigned int   comp_cdd_num  /*!< Number of elements in comp_cdds array */
+) { PROFILE(RANK_CACHE_WRITE);
+
+  FILE*        ofile;
+  char         tmp[4096];
+  bool         error = TRUE;
+  unsigned int rv;
+
+  /* We are done loading from the old rank cache file */
+  rank_cache_close();
+
+  rv = snprintf( tmp, 4096, "%s.%d", rank_cache_file, (int)getpid() );
+  assert( rv < 4096 );
+
+  if( (ofile = fopen( tmp, "wb" )) != NULL ) {
+
+    uint32       version    = RANK_CACHE_VERSION;
+    uint32       ulong_size = sizeof( ulong );
+    uint32       entries    = 0;
+    unsigned int i, j;
+
+    /* Only CDD files that still exist are stored */
+    for( i=0; i<comp_cdd_num; i++ ) {
+      struct stat filestat;
+      if( stat( comp_cdds[i]->cdd_name, &filestat ) == 0 ) {
+        entries++;
+      }
+    }
+
+    error = (fwrite( &version,          sizeof( uint32 ), 1,           ofile ) != 1)           ||
+            (fwrite( &ulong_size,       sizeof( uint32 ), 1,           ofile ) != 1)           ||
+            (fwrite( &rank_fingerprint, sizeof( uint64 ), 1,           ofile ) != 1)           ||
+            (fwrite( num_cps,           sizeof( uint64 ), CP_TYPE_NUM, ofile ) != CP_TYPE_NUM) ||
+            (fwrite( &entries,          sizeof( uint32 ), 1,           ofile ) != 1);
+
+    for( i=0; (i<comp_cdd_num) && !error; i++ ) {
+      struct stat filestat;
+      if( stat( comp_cdds[i]->cdd_name, &filestat ) == 0 ) {
+        uint32 name_len = strlen( comp_cdds[i]->cdd_name );
+        uint64 mtime    = (uint64)filestat.st_mtime;
+        uint64 size     = (uint64)filestat.st_size;
+        error = (fwrite( &name_len, sizeof( uint32 ), 1, ofile ) != 1) ||
+                (fwrite( comp_cdds[i]->cdd_name, 1, name_len, ofile ) != name_len) ||
+                (fwrite( &mtime, sizeof( uint64 ), 1, ofile ) != 1) ||
+                (fwrite( &size,  sizeof( uint64 ), 1, ofile ) != 1) ||
+                (fwrite( &(comp_cdds[i]->timesteps), sizeof( uint64 ), 1, ofile ) != 1);
+        for( j=0; (j<CP_TYPE_NUM) && !error; j++ ) {
+          error = (fwrite( comp_cdds[i]->cps[j], sizeof( ulong ), rank_num_words( num_cps[j] ), ofile ) != rank_num_words( num_cps[j] ));
+        }
+      }
+    }
+
+    if( fclose( ofile ) != 0 ) {
+      error = TRUE;
+    }
+
+    if( !error ) {
+      error = (rename( tmp, rank_cache_file ) != 0);
+    }
+    if( error ) {
+      (void)remove( tmp );
+    }
+
+  }
+
+  if( error ) {
+    rv = snprintf( user_msg, USER_MSG_LENGTH, "Unable to write rank cache file \"%s\"", rank_cache_file );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, WARNING, __FILE__, __LINE__ );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous Throw rank_read_cdd
+
+ Reads in all of the CDD files in the rank_in_head list using up to rank_jobs worker processes.  The first CDD file
+ is read by this process to determine the number of coverage points in the design.  The remaining CDD files that
+ cannot be loaded from the rank cache file are split into groups of consecutive files, each of which is read by a
+ worker process that passes the compressed coverage information of its CDD files back to this process through a
+ temporary file.  The compressed CDD coverage structures are added to the comp_cdds array in the order of the CDD
+ files on the command-line, just as they are when read serially.
+*/
+static void rank_read_cdds_parallel(
+  /*@out@*/ comp_cdd_cov*** comp_cdds,    /*!< Pointer to compressed CDD array */
+  /*@out@*/ unsigned int*   comp_cdd_num  /*!< Number of compressed CDD structures in comp_cdds array */
+) { PROFILE(RANK_READ_CDDS_PARALLEL);
+
+  str_link*    strl;
+  str_link**   files    = NULL;
+  long*        offsets  = NULL;
+  unsigned int file_num = 0;
+  str_link**   reads    = NULL;
+  unsigned int read_num = 0;
+  unsigned int group_size;
+  unsigned int group_num;
+  FILE**       ofiles;
+  pid_t*       pids;
+  bool         error = FALSE;
+  unsigned int rv;
+  unsigned int i, j;
+
+  /* Read the first CDD file to set up the coverage point information that the workers verify against */
+  rv = snprintf( user_msg, USER_MSG_LENGTH, "Reading CDD file \"%s\"", rank_in_head->str );
+  assert( rv < USER_MSG_LENGTH );
+  print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+  rank_read_first_cdd( rank_in_head, comp_cdds, comp_cdd_num );
+
+  /* Find the remaining CDD files that need to be read in */
+  strl = rank_in_head->next;
+  while( strl != NULL ) {
+    rv = snprintf( user_msg, USER_MSG_LENGTH, "Reading CDD file \"%s\"", strl->str );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+    files            = (str_link**)realloc_safe( files, (sizeof( str_link* ) * file_num), (sizeof( str_link* ) * (file_num + 1)) );
+    offsets          = (long*)realloc_safe( offsets, (sizeof( long ) * file_num), (sizeof( long ) * (file_num + 1)) );
+    files[file_num]  = strl;
+    offsets[file_num] = rank_cache_valid ? rank_cache_find( strl->str ) : -1;
+    if( offsets[file_num] < 0 ) {
+      reads           = (str_link**)realloc_safe( reads, (sizeof( str_link* ) * read_num), (sizeof( str_link* ) * (read_num + 1)) );
+      reads[read_num] = strl;
+      read_num++;
+    }
+    file_num++;
+    strl = strl->next;
+  }
+
+  group_size = (read_num + rank_jobs - 1) / rank_jobs;
+  group_num  = (read_num == 0) ? 0 : ((read_num + group_size - 1) / group_size);
+  ofiles     = (group_num == 0) ? NULL : (FILE**)malloc_safe( sizeof( FILE* ) * group_num );
+  pids       = (group_num == 0) ? NULL : (pid_t*)malloc_safe( sizeof( pid_t ) * group_num );
+
+  /* Make sure that buffered output is not duplicated by the worker processes */
+  (void)fflush( stdout );
+  (void)fflush( stderr );
+
+  /* Start a worker process for each group of files */
+  for( i=0; i<group_num; i++ ) {
+    unsigned int num = ((read_num - (i * group_size)) < group_size) ? (read_num - (i * group_size)) : group_size;
+    pids[i] = -1;
+    if( (ofiles[i] = tmpfile()) != NULL ) {
+      if( (pids[i] = fork()) == 0 ) {
+        rank_worker( (reads + (i * group_size)), num, ofiles[i] );
+      }
+    }
+    if( pids[i] < 0 ) {
+      error = TRUE;
+    }
+  }
+
+  /* Wait for all of the workers to complete */
+  for( i=0; i<group_num; i++ ) {
+    if( pids[i] > 0 ) {
+      int status;
+      if( (waitpid( pids[i], &status, 0 ) != pids[i]) || !WIFEXITED( status ) || (WEXITSTATUS( status ) != EXIT_SUCCESS) ) {
+        error = TRUE;
+      }
+    }
+    if( ofiles[i] != NULL ) {
+      rewind( ofiles[i] );
+    }
+  }
+
+  /* Collect the compressed CDD coverage information of each file in order */
+  for( i=0, j=0; (i<file_num) && !error; i++ ) {
+    if( (offsets[i] < 0) || !rank_cache_read_cdd( files[i]->str, (files[i]->suppl == 1), offsets[i], comp_cdds, comp_cdd_num ) ) {
+      if( offsets[i] >= 0 ) {
+        Try {
+          rank_read_cdd( files[i]->str, (files[i]->suppl == 1), FALSE, comp_cdds, comp_cdd_num );
+        } Catch_anonymous {
+          error = TRUE;
+        }
+      } else {
+        FILE*         ofile = ofiles[j / group_size];
+        uint64        timesteps;
+        unsigned int  k;
+        comp_cdd_cov* comp_cov;
+        if( (ofile == NULL) || (fread( &timesteps, sizeof( uint64 ), 1, ofile ) != 1) ) {
+          error = TRUE;
+        } else {
+          comp_cov = rank_create_comp_cdd_cov( files[i]->str, (files[i]->suppl == 1), timesteps );
+          for( k=0; k<CP_TYPE_NUM; k++ ) {
+            if( fread( comp_cov->cps[k], sizeof( ulong ), rank_num_words( num_cps[k] ), ofile ) != rank_num_words( num_cps[k] ) ) {
+              error = TRUE;
+            }
+          }
+          *comp_cdds = (comp_cdd_cov**)realloc_safe( *comp_cdds, (sizeof( comp_cdd_cov* ) * (*comp_cdd_num)), (sizeof( comp_cdd_cov* ) * (*comp_cdd_num + 1)) );
+          (*comp_cdds)[*comp_cdd_num] = comp_cov;
+          (*comp_cdd_num)++;
+        }
+        j++;
+      }
+    }
+  }
+
+  for( i=0; i<group_num; i++ ) {
+    if( ofiles[i] != NULL ) {
+      rv = fclose( ofiles[i] );
+      assert( rv == 0 );
+    }
+  }
+  free_safe( ofiles,  (sizeof( FILE* ) * group_num) );
+  free_safe( pids,    (sizeof( pid_t ) * group_num) );
+  free_safe( files,   (sizeof( str_link* ) * file_num) );
+  free_safe( offsets, (sizeof( long ) * file_num) );
+  free_safe( reads,   (sizeof( str_link* ) * read_num) );
+
+  if( error ) {
+    print_output( "Unable to read CDD files in one or more rank jobs", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  PROFILE_END;
+
+}
+
 /*-----------------------------------------------------------------------------------------------------------------------*/
 
+/*!
+ Sets the bits of the given "needed" masks for every coverage point.  A set bit in a needed mask indicates that the
+ corresponding coverage point has been hit fewer than cp_depth times by the ranked CDD files.
+*/
+static void rank_reset_need_masks(
+  /*@out@*/ ulong** need  /*!< Array of needed masks (one for each coverage point type) */
+) { PROFILE(RANK_RESET_NEED_MASKS);
+
+  unsigned int i, j;
+
+  for( i=0; i<CP_TYPE_NUM; i++ ) {
+    unsigned int words = rank_num_words( num_cps[i] );
+    for( j=0; j<words; j++ ) {
+      need[i][j] = (j < UL_DIV(num_cps[i])) ? UL_SET : (((ulong)0x1 << UL_MOD(num_cps[i])) - 1);
+    }
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  Sorts the selected CDD coverage structure into the comp_cdds list and performs post-placement calculations.
 */
@@ -1136,6 +1846,8 @@ static void rank_selected_cdd_cov(
             unsigned int   comp_cdd_num,     /*!< Total number of elements in comp_cdds array */
   /*@out@*/ uint16*        ranked_merged,    /*!< Array of merged information for ranked CDDs */
   /*@out@*/ uint16*        unranked_merged,  /*!< Array of merged information for unranked CDDs */
+  /*@out@*/ ulong**        unranked_mask,    /*!< Masks of coverage points that are hit by at least one unranked CDD */
+  /*@out@*/ ulong**        need_mask,        /*!< Masks of coverage points that are hit fewer than cp_depth times by ranked CDDs */
             unsigned int   next_cdd,         /*!< Index into comp_cdds array that the selected CDD should be stored at */
             unsigned int   selected_cdd      /*!< Index into comp_cdds array of the selected CDD for ranking */
 ) { PROFILE(RANK_SELECTED_CDD_COV);
@@ -1166,22 +1878,27 @@ static void rank_selected_cdd_cov(
 
   /* Subtract all of the set coverage points from the merged value */
   for( i=0; i<CP_TYPE_NUM; i++ ) {
-    for( j=0; j<num_cps[i]; j++ ) {
-      if( unranked_merged[merged_index] > 0 ) {
-        if( comp_cdds[next_cdd]->cps[i][UL_DIV(j)] & ((ulong)0x1 << UL_MOD(j)) ) {
-          /*
-           If we have not seen this coverage point get hit the needed "depth" amount in the ranked
-           list, increment the unique_cps value for the selected compressed CDD coverage structure.
-          */
-          if( ranked_merged[merged_index] < cp_depth ) {
-            comp_cdds[next_cdd]->unique_cps++;
-          }
-          unranked_merged[merged_index]--;
-          ranked_merged[merged_index]++;
+    unsigned int words = rank_num_words( num_cps[i] );
+    for( j=0; j<words; j++ ) {
+      ulong bits = comp_cdds[next_cdd]->cps[i][j] & unranked_mask[i][j];
+      /*
+       Each coverage point that we have not seen get hit the needed "depth" amount in the ranked list
+       increments the unique_cps value for the selected compressed CDD coverage structure.
+      */
+      comp_cdds[next_cdd]->unique_cps += rank_count_bits( bits & need_mask[i][j] );
+      while( bits != 0 ) {
+        unsigned int bit = rank_lowest_bit( bits );
+        uint64       x   = merged_index + ((uint64)j * UL_BITS) + bit;
+        bits &= (bits - 1);
+        if( --unranked_merged[x] == 0 ) {
+          unranked_mask[i][j] &= ~((ulong)0x1 << bit);
+        }
+        if( ++ranked_merged[x] >= cp_depth ) {
+          need_mask[i][j] &= ~((ulong)0x1 << bit);
         }
       }
-      merged_index++;
     }
+    merged_index += num_cps[i];
   }
 
   if( ((!quiet_mode && !terse_mode) || debug_mode) && !rank_verbose ) {
@@ -1210,6 +1927,8 @@ static void rank_perform_weighted_selection(
             unsigned int   comp_cdd_num,     /*!< Number of compressed CDD coverage structures in the comp_cdds array */
             uint16*        ranked_merged,    /*!< Array of ranked merged information from all of the compressed CDD coverage structures */
             uint16*        unranked_merged,  /*!< Array of unranked merged information from all of the compressed CDD coverage structures */
+            ulong**        unranked_mask,    /*!< Masks of coverage points that are hit by at least one unranked CDD */
+            ulong**        need_mask,        /*!< Masks of coverage points that are hit fewer than cp_depth times by ranked CDDs */
             unsigned int   next_cdd,         /*!< Next index in comp_cdds array to set */
   /*@out@*/ unsigned int*  cdds_ranked       /*!< Number of CDDs that were ranked with unique coverage in this function */
 ) { PROFILE(RANK_PERFORM_WEIGHTED_SELECTION);
@@ -1222,21 +1941,17 @@ static void rank_perform_weighted_selection(
 
     /* Calculate current scores */
     for( i=next_cdd; i<comp_cdd_num; i++ ) {
-      bool   unique_found = FALSE;
-      uint64 x            = 0;
+      bool unique_found = FALSE;
       comp_cdds[i]->score = 0;
       for( j=0; j<CP_TYPE_NUM; j++ ) {
         unsigned int total = 0;
-        for( k=0; k<num_cps[j]; k++ ) {
-          if( unranked_merged[x] > 0 ) {
-  	    if( comp_cdds[i]->cps[j][UL_DIV(k)] & ((ulong)0x1 << UL_MOD(k)) ) {
-              total++;
-              if( ranked_merged[x] < cp_depth ) {
-                unique_found = TRUE;
-              }
-            }
+        unsigned int words = rank_num_words( num_cps[j] );
+        for( k=0; k<words; k++ ) {
+          ulong bits = comp_cdds[i]->cps[j][k] & unranked_mask[j][k];
+          total += rank_count_bits( bits );
+          if( (bits & need_mask[j][k]) != 0 ) {
+            unique_found = TRUE;
           }
-          x++;
         }
         comp_cdds[i]->score += ((total / (float)comp_cdds[i]->timesteps) * 100) * cdd_type_weight[j];
       }
@@ -1246,7 +1961,7 @@ static void rank_perform_weighted_selection(
     } 
 
     /* Store the selected CDD into the next slot of the comp_cdds array */
-    rank_selected_cdd_cov( comp_cdds, comp_cdd_num, ranked_merged, unranked_merged, next_cdd, highest_score );
+    rank_selected_cdd_cov( comp_cdds, comp_cdd_num, ranked_merged, unranked_merged, unranked_mask, need_mask, next_cdd, highest_score );
 
     /* Increment the number of unique_cps ranked */
     if( comp_cdds[next_cdd]->unique_cps > 0 ) {
@@ -1259,6 +1974,201 @@ static void rank_perform_weighted_selection(
 
 }
 
+/*!
+ \return Returns the number of coverage points hit by the given compressed CDD coverage structure that are still
+         needed by the ranked CDD files.
+*/
+static uint64 rank_calc_needed_cps(
+  comp_cdd_cov* comp_cov,  /*!< Pointer to compressed CDD coverage structure to score */
+  ulong**       need_mask  /*!< Masks of coverage points that are hit fewer than cp_depth times by ranked CDDs */
+) { PROFILE(RANK_CALC_NEEDED_CPS);
+
+  uint64       cps = 0;
+  unsigned int i, j;
+
+  for( i=0; i<CP_TYPE_NUM; i++ ) {
+    unsigned int words = rank_num_words( num_cps[i] );
+    for( j=0; j<words; j++ ) {
+      cps += rank_count_bits( comp_cov->cps[i][j] & need_mask[i][j] );
+    }
+  }
+
+  PROFILE_END;
+
+  return( cps );
+
+}
+
+/*!
+ Adds the coverage points of the given compressed CDD coverage structure to the ranked coverage point counts.
+*/
+static void rank_add_ranked_cps(
+            comp_cdd_cov* comp_cov,       /*!< Pointer to compressed CDD coverage structure that was ranked */
+  /*@out@*/ uint16*       ranked_merged,  /*!< Array of merged information for ranked CDDs */
+  /*@out@*/ ulong**       need_mask       /*!< Masks of coverage points that are hit fewer than cp_depth times by ranked CDDs */
+) { PROFILE(RANK_ADD_RANKED_CPS);
+
+  uint64       x = 0;
+  unsigned int i, j;
+
+  for( i=0; i<CP_TYPE_NUM; i++ ) {
+    unsigned int words = rank_num_words( num_cps[i] );
+    for( j=0; j<words; j++ ) {
+      ulong bits = comp_cov->cps[i][j];
+      while( bits != 0 ) {
+        unsigned int bit = rank_lowest_bit( bits );
+        bits &= (bits - 1);
+        if( ++ranked_merged[x + ((uint64)j * UL_BITS) + bit] >= cp_depth ) {
+          need_mask[i][j] &= ~((ulong)0x1 << bit);
+        }
+      }
+    }
+    x += num_cps[i];
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if the CDD at index a of the comp_cdds array should be selected before the CDD at index b.
+
+ A CDD with more unique coverage points is selected first, then the CDD with more timesteps, then the CDD that
+ is found first in the comp_cdds array (the same order that the exact greedy sort selects in).
+*/
+static inline bool rank_heap_higher(
+  comp_cdd_cov** comp_cdds,  /*!< Array of compressed CDD coverage structures */
+  unsigned int   a,          /*!< Index of first CDD to compare */
+  unsigned int   b           /*!< Index of second CDD to compare */
+) {
+
+  return( (comp_cdds[a]->unique_cps > comp_cdds[b]->unique_cps) ||
+          ((comp_cdds[a]->unique_cps == comp_cdds[b]->unique_cps) &&
+           ((comp_cdds[a]->timesteps > comp_cdds[b]->timesteps) ||
+            ((comp_cdds[a]->timesteps == comp_cdds[b]->timesteps) && (a < b)))) );
+
+}
+
+/*!
+ Moves the heap entry at the given heap index down until the heap ordering is restored.
+*/
+static void rank_heap_sift_down(
+            comp_cdd_cov** comp_cdds,  /*!< Array of compressed CDD coverage structures */
+  /*@out@*/ unsigned int*  heap,       /*!< Heap of comp_cdds indices */
+  /*@out@*/ unsigned int*  hpos,       /*!< Heap index of each comp_cdds index */
+            unsigned int   size,       /*!< Number of entries in the heap */
+            unsigned int   k           /*!< Heap index of entry to move */
+) { PROFILE(RANK_HEAP_SIFT_DOWN);
+
+  for( ;; ) {
+    unsigned int l    = (k * 2) + 1;
+    unsigned int best = k;
+    unsigned int tmp;
+    if( (l < size) && rank_heap_higher( comp_cdds, heap[l], heap[best] ) ) {
+      best = l;
+    }
+    if( ((l + 1) < size) && rank_heap_higher( comp_cdds, heap[l+1], heap[best] ) ) {
+      best = l + 1;
+    }
+    if( best == k ) {
+      break;
+    }
+    tmp              = heap[k];
+    heap[k]          = heap[best];
+    heap[best]       = tmp;
+    hpos[heap[k]]    = k;
+    hpos[heap[best]] = best;
+    k                = best;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the index in the comp_cdds array of the first CDD that was not sorted.
+
+ Performs the greedy sort lazily.  Since the number of unique coverage points of a CDD can only decrease as other
+ CDDs are ranked, the last calculated value of each CDD is an upper bound on its current value.  The CDDs are
+ kept in a heap ordered by these bounds and only the CDD at the top of the heap is rescored until a CDD whose
+ value is current is found at the top; that CDD is the one that the exact greedy sort would select.  Sorting
+ stops when the selected CDD hits no unique coverage points, leaving the remainder of the array to the exact
+ greedy sort which has its own ordering rules for this case.
+*/
+static unsigned int rank_perform_lazy_greedy_sort(
+  /*@out@*/ comp_cdd_cov** comp_cdds,      /*!< Pointer to compressed CDD coverage structure array to re-sort */
+            unsigned int   comp_cdd_num,   /*!< Number of elements in comp-cdds array */
+  /*@out@*/ uint16*        ranked_merged,  /*!< Array for recalculating uniqueness of sorted elements */
+  /*@out@*/ ulong**        need_mask       /*!< Masks for recalculating uniqueness of sorted elements */
+) { PROFILE(RANK_PERFORM_LAZY_GREEDY_SORT);
+
+  unsigned int* heap  = (unsigned int*)malloc_safe_nolimit( sizeof( unsigned int ) * comp_cdd_num );
+  unsigned int* hpos  = (unsigned int*)malloc_safe_nolimit( sizeof( unsigned int ) * comp_cdd_num );
+  unsigned int* stamp = (unsigned int*)malloc_safe_nolimit( sizeof( unsigned int ) * comp_cdd_num );
+  unsigned int  size  = comp_cdd_num;
+  unsigned int  i, j;
+
+  /* Score all CDDs against the empty ranked list and build the heap */
+  for( j=0; j<comp_cdd_num; j++ ) {
+    comp_cdds[j]->unique_cps = rank_calc_needed_cps( comp_cdds[j], need_mask );
+    stamp[j] = 0;
+    heap[j]  = j;
+    hpos[j]  = j;
+  }
+  for( j=(comp_cdd_num / 2); j>0; j-- ) {
+    rank_heap_sift_down( comp_cdds, heap, hpos, size, (j - 1) );
+  }
+
+  for( i=0; i<comp_cdd_num; i++ ) {
+
+    unsigned int  best;
+    comp_cdd_cov* tmp;
+
+    /* Rescore the top of the heap until its value is current */
+    while( stamp[heap[0]] != i ) {
+      comp_cdds[heap[0]]->unique_cps = rank_calc_needed_cps( comp_cdds[heap[0]], need_mask );
+      stamp[heap[0]] = i;
+      rank_heap_sift_down( comp_cdds, heap, hpos, size, 0 );
+    }
+    best = heap[0];
+
+    if( comp_cdds[best]->unique_cps == 0 ) {
+      break;
+    }
+
+    /* Remove the selected CDD from the heap */
+    size--;
+    if( size > 0 ) {
+      heap[0]       = heap[size];
+      hpos[heap[0]] = 0;
+      rank_heap_sift_down( comp_cdds, heap, hpos, size, 0 );
+    }
+
+    /* Swap the selected CDD into place, moving the CDD at index i to the selected CDD's old index */
+    if( best != i ) {
+      tmp             = comp_cdds[i];
+      comp_cdds[i]    = comp_cdds[best];
+      comp_cdds[best] = tmp;
+      stamp[best]     = stamp[i];
+      hpos[best]      = hpos[i];
+      heap[hpos[best]] = best;
+      rank_heap_sift_down( comp_cdds, heap, hpos, size, hpos[best] );
+    }
+
+    rank_add_ranked_cps( comp_cdds[i], ranked_merged, need_mask );
+
+  }
+
+  free_safe( heap,  (sizeof( unsigned int ) * comp_cdd_num) );
+  free_safe( hpos,  (sizeof( unsigned int ) * comp_cdd_num) );
+  free_safe( stamp, (sizeof( unsigned int ) * comp_cdd_num) );
+
+  PROFILE_END;
+
+  return( i );
+
+}
+
 /*!
  Re-sorts the compressed CDD coverage array to order them based on a "most coverage points per timestep" basis.
 */
@@ -1266,35 +2176,32 @@ static void rank_perform_greedy_sort(
   /*@out@*/ comp_cdd_cov** comp_cdds,      /*!< Pointer to compressed CDD coverage structure array to re-sort */
             unsigned int   comp_cdd_num,   /*!< Number of elements in comp-cdds array */
             uint16*        ranked_merged,  /*!< Array for recalculating uniqueness of sorted elements */
+            ulong**        need_mask,      /*!< Masks for recalculating uniqueness of sorted elements */
             uint64         num_ranked      /*!< Number of elements in ranked_merged array */
 ) { PROFILE(RANK_PERFORM_GREEDY_SORT);
 
-  unsigned int  i, j, k, l;
+  unsigned int  i = 0;
+  unsigned int  j;
   unsigned int  best;
   uint64        x;
   comp_cdd_cov* tmp;
 
-  /* First, reset the ranked_merged array */
+  /* First, reset the ranked_merged array and needed masks */
   for( x=0; x<num_ranked; x++ ) {
     ranked_merged[x] = 0;
   }
+  rank_reset_need_masks( need_mask );
+
+  /* Sort the CDDs that hit unique coverage points without rescoring all of them, unless told otherwise */
+  if( !rank_exact && (comp_cdd_num > 0) ) {
+    i = rank_perform_lazy_greedy_sort( comp_cdds, comp_cdd_num, ranked_merged, need_mask );
+  }
 
   /* Rank based on most unique from previously ranked CDDs */
-  for( i=0; i<comp_cdd_num; i++ ) {
+  for( ; i<comp_cdd_num; i++ ) {
     best = i;
     for( j=i; j<comp_cdd_num; j++ ) {
-      x = 0;
-      comp_cdds[j]->unique_cps = 0;
-      for( k=0; k<CP_TYPE_NUM; k++ ) {
-        for( l=0; l<num_cps[k]; l++ ) {
-          if( comp_cdds[j]->cps[k][UL_DIV(l)] & ((ulong)0x1 << UL_MOD(l)) ) {
-            if( ranked_merged[x] < cp_depth ) {
-              comp_cdds[j]->unique_cps++;
-            }
-          }
-          x++;
-        }
-      }
+      comp_cdds[j]->unique_cps = rank_calc_needed_cps( comp_cdds[j], need_mask );
       if( (comp_cdds[best]->unique_cps < comp_cdds[j]->unique_cps) ||
           ((comp_cdds[best]->unique_cps == comp_cdds[j]->unique_cps) && (comp_cdds[best]->timesteps < comp_cdds[j]->timesteps)) ||
           ((comp_cdds[best]->unique_cps == 0) && !comp_cdds[best]->required && !comp_cdds[i]->required) ) {
@@ -1304,15 +2211,7 @@ static void rank_perform_greedy_sort(
     tmp             = comp_cdds[i];
     comp_cdds[i]    = comp_cdds[best];
     comp_cdds[best] = tmp;
-    x = 0;
-    for( j=0; j<CP_TYPE_NUM; j++ ) {
-      for( k=0; k<num_cps[j]; k++ ) {
-        if( comp_cdds[i]->cps[j][UL_DIV(k)] & ((ulong)0x1 << UL_MOD(k)) ) {
-          ranked_merged[x]++;
-        }
-        x++;
-      }
-    }
+    rank_add_ranked_cps( comp_cdds[i], ranked_merged, need_mask );
   }
 
   PROFILE_END;
@@ -1352,7 +2251,9 @@ static void rank_perform(
   unsigned int i, j, k;
   uint16*      ranked_merged;
   uint16*      unranked_merged;
-  uint16       merged_index = 0;
+  ulong*       unranked_mask[CP_TYPE_NUM];
+  ulong*       need_mask[CP_TYPE_NUM];
+  uint64       merged_index = 0;
   uint64       total        = 0;
   uint64       total_hitable;
   unsigned int next_cdd     = 0;
@@ -1376,7 +2277,19 @@ static void rank_perform(
 
   /* Allocate merged array */
   ranked_merged   = (uint16*)calloc_safe( total, sizeof( uint16 ) );
-  unranked_merged = (uint16*)malloc_safe_nolimit( sizeof( uint16 ) * total );
+  unranked_merged = (uint16*)calloc_safe( total, sizeof( uint16 ) );
+
+  /* Allocate the coverage point masks that allow whole words of coverage points to be scored at once */
+  for( i=0; i<CP_TYPE_NUM; i++ ) {
+    if( num_cps[i] > 0 ) {
+      unranked_mask[i] = (ulong*)malloc_safe_nolimit( sizeof( ulong ) * rank_num_words( num_cps[i] ) );
+      need_mask[i]     = (ulong*)malloc_safe_nolimit( sizeof( ulong ) * rank_num_words( num_cps[i] ) );
+    } else {
+      unranked_mask[i] = NULL;
+      need_mask[i]     = NULL;
+    }
+  }
+  rank_reset_need_masks( need_mask );
 
   if( rank_verbose ) {
     /*@-duplicatequals -formattype -formatcode@*/
@@ -1389,23 +2302,30 @@ static void rank_perform(
 
   /* Step 1 - Initialize merged results array, calculate uniqueness and total values of each compressed CDD coverage structure */
   for( i=0; i<CP_TYPE_NUM; i++ ) {
-    for( j=0; j<num_cps[i]; j++ ) {
-      uint16       bit_total = 0;
-      unsigned int set_cdd;
+    unsigned int words = rank_num_words( num_cps[i] );
+    for( j=0; j<words; j++ ) {
+      ulong once  = 0;
+      ulong twice = 0;
       for( k=0; k<comp_cdd_num; k++ ) {
-        if( (comp_cdds[k]->cps[i][UL_DIV(j)] & ((ulong)0x1 << UL_MOD(j))) != 0 ) {
-          comp_cdds[k]->total_cps++;
-          set_cdd = k;
-          bit_total++;
+        ulong bits = comp_cdds[k]->cps[i][j];
+        comp_cdds[k]->total_cps += rank_count_bits( bits );
+        twice |= (once & bits);
+        once  |= bits;
+        while( bits != 0 ) {
+          unranked_merged[merged_index + ((uint64)j * UL_BITS) + rank_lowest_bit( bits )]++;
+          bits &= (bits - 1);
         }
       }
-      unranked_merged[merged_index++] = bit_total;
+      unranked_mask[i][j] = once;
 
-      /* If we found exactly one CDD file that hit this coverage point, mark it in the corresponding CDD file */
-      if( bit_total == 1 ) {
-        comp_cdds[set_cdd]->unique_cps++;
+      /* If we found exactly one CDD file that hit a coverage point, mark it in the corresponding CDD file */
+      if( (once & ~twice) != 0 ) {
+        for( k=0; k<comp_cdd_num; k++ ) {
+          comp_cdds[k]->unique_cps += rank_count_bits( comp_cdds[k]->cps[i][j] & once & ~twice );
+        }
       }
     }
+    merged_index += num_cps[i];
   }
 
   if( rank_verbose ) {
@@ -1426,7 +2346,7 @@ static void rank_perform(
   /* Step 2 - Immediately rank all of the required CDDs */
   for( i=0; i<comp_cdd_num; i++ ) {
     if( comp_cdds[i]->required ) {
-      rank_selected_cdd_cov( comp_cdds, comp_cdd_num, ranked_merged, unranked_merged, next_cdd, i );
+      rank_selected_cdd_cov( comp_cdds, comp_cdd_num, ranked_merged, unranked_merged, unranked_mask, need_mask, next_cdd, i );
       next_cdd++;
     }
   }
@@ -1463,7 +2383,7 @@ static void rank_perform(
       }
     }
     if( comp_cdds[most_unique]->unique_cps > 0 ) {
-      rank_selected_cdd_cov( comp_cdds, comp_cdd_num, ranked_merged, unranked_merged, next_cdd, most_unique );
+      rank_selected_cdd_cov( comp_cdds, comp_cdd_num, ranked_merged, unranked_merged, unranked_mask, need_mask, next_cdd, most_unique );
       next_cdd++;
     }
   } while( (next_cdd < comp_cdd_num) && (comp_cdds[most_unique]->unique_cps > 0) );
@@ -1493,7 +2413,7 @@ static void rank_perform(
 
   /* Step 4 - Select coverage based on user-specified factors */
   if( next_cdd < comp_cdd_num ) {
-    rank_perform_weighted_selection( comp_cdds, comp_cdd_num, ranked_merged, unranked_merged, next_cdd, &cdds_ranked );
+    rank_perform_weighted_selection( comp_cdds, comp_cdd_num, ranked_merged, unranked_merged, unranked_mask, need_mask, next_cdd, &cdds_ranked );
   }
 
   if( rank_verbose ) {
@@ -1519,7 +2439,7 @@ static void rank_perform(
   }
 
   /* Step 5 - Re-sort the list using a greedy algorithm */
-  rank_perform_greedy_sort( comp_cdds, comp_cdd_num, ranked_merged, total );
+  rank_perform_greedy_sort( comp_cdds, comp_cdd_num, ranked_merged, need_mask, total );
 
   if( rank_verbose ) {
     timer_stop( &atimer );
@@ -1543,6 +2463,10 @@ static void rank_perform(
   /* Deallocate merged CDD coverage structure */
   free_safe( ranked_merged,   (sizeof( uint16 ) * total ) );
   free_safe( unranked_merged, (sizeof( uint16 ) * total ) );
+  for( i=0; i<CP_TYPE_NUM; i++ ) {
+    free_safe( unranked_mask[i], (sizeof( ulong ) * rank_num_words( num_cps[i] )) );
+    free_safe( need_mask[i],     (sizeof( ulong ) * rank_num_words( num_cps[i] )) );
+  }
 
   PROFILE_END;
 
@@ -1758,15 +2682,26 @@ void command_rank(
         timer_start( &atimer );
       }
 
+      /* Load the index of the rank cache file, if one was specified */
+      rank_cache_open();
+
       /* Read in databases to merge */
       strl = rank_in_head;
+      if( (rank_jobs > 1) && (rank_in_head != NULL) && (rank_in_head->next != NULL) ) {
+        rank_read_cdds_parallel( &comp_cdds, &comp_cdd_num );
+        strl = NULL;
+      }
       while( strl != NULL ) {
         rv = snprintf( user_msg, USER_MSG_LENGTH, "Reading CDD file \"%s\"", strl->str );
         assert( rv < USER_MSG_LENGTH );
         print_output( user_msg, NORMAL, __FILE__, __LINE__ );
         rv = fflush( stdout );
         assert( rv == 0 );
-        rank_read_cdd( strl->str, (strl->suppl == 1), first, &comp_cdds, &comp_cdd_num );
+        if( first ) {
+          rank_read_first_cdd( strl, &comp_cdds, &comp_cdd_num );
+        } else {
+          rank_read_next_cdd( strl, &comp_cdds, &comp_cdd_num );
+        }
         first = FALSE;
         strl  = strl->next;
       }
@@ -1777,6 +2712,16 @@ void command_rank(
         assert( rv < USER_MSG_LENGTH );
         print_output( user_msg, NORMAL, __FILE__, __LINE__ );
         free_safe( atimer, sizeof( timer ) );
+        if( rank_cache_file != NULL ) {
+          rv = snprintf( user_msg, USER_MSG_LENGTH, "Loaded %u of %u CDD files from rank cache file \"%s\"", rank_cache_hits, comp_cdd_num, rank_cache_file );
+          assert( rv < USER_MSG_LENGTH );
+          print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+        }
+      }
+
+      /* Save the compressed coverage information of the CDD files for the next rank */
+      if( rank_cache_file != NULL ) {
+        rank_cache_write( comp_cdds, comp_cdd_num );
       }
 
       /* Peaform the ranking algorithm */
@@ -1810,6 +2755,10 @@ void command_rank(
 
   free_safe( rank_file, (strlen( rank_file ) + 1) );
 
+  /* Deallocate the rank cache information */
+  rank_cache_close();
+  free_safe( rank_cache_file, (strlen( rank_cache_file ) + 1) );
+
   if( error ) {
     Throw 0;
   }
@@ -29,6 +29,9 @@
 #endif
 #include <assert.h>
 #include <stdlib.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #ifdef HAVE_TCLTK
 #include <tcl.h>
 #include <tk.h>
@@ -43,7 +46,9 @@
 #include "info.h"
 #include "instance.h"
 #include "line.h"
+#include "link.h"
 #include "memory.h"
+#include "obfuscate.h"
 #include "ovl.h"
 #include "race.h"
 #include "report.h"
@@ -59,6 +64,7 @@ extern unsigned int db_size;
 extern unsigned int curr_db;
 extern str_link*    merge_in_head;
 extern str_link*    merge_in_tail;
+extern int          merge_in_num;
 extern isuppl       info_suppl;
 extern char*        cdd_message;
 
@@ -187,6 +193,12 @@ bool flag_suppress_empty_funits = FALSE;
 */
 bool flag_output_exclusion_ids = FALSE;
 
+/*!
+ Specifies the number of worker processes to use when gathering instance statistics and generating the report
+ sections.  A value of 0 or 1 does all of the work in this process.
+*/
+static unsigned int report_jobs = 0;
+
 #ifdef HAVE_TCLTK
 /*!
  TCL interpreter for this application.
@@ -234,6 +246,8 @@ static void report_usage() {
   printf( "      -x                           Output exclusion identifiers if the '-d d' or '-d v' options are specified.  The\n" );
   printf( "                                     identifiers can be used with the 'exclude' command for the purposes of\n" );
   printf( "                                     excluding/including coverage points.\n" );
+  printf( "      -j <number>                  Generates the report sections (and, if '-i' is specified, gathers the instance\n" );
+  printf( "                                     statistics) using up to <number> worker processes in parallel.\n" );
   printf( "\n" );
 
 }
@@ -442,6 +456,22 @@ bool report_parse_args(
     } else if( strncmp( "-x", argv[i], 2 ) == 0 ) {
 
       flag_output_exclusion_ids = TRUE;
+
+    } else if( strncmp( "-j", argv[i], 2 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( report_jobs != 0 ) {
+          print_output( "Only one -j option is allowed on the report command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else {
+          if( (sscanf( argv[i], "%u", &report_jobs ) != 1) || (report_jobs == 0) ) {
+            print_output( "Value specified after -j must be a positive, non-zero number", FATAL, __FILE__, __LINE__ );
+            Throw 0;
+          }
+        }
+      } else {
+        Throw 0;
+      }
  
     } else if( (i + 1) == argc ) {
 
@@ -503,6 +533,20 @@ void report_gather_instance_stats(
 ) { PROFILE(REPORT_GATHER_INSTANCE_STATS);
 
   funit_inst* curr;        /* Pointer to current instance being evaluated */
+  statistic   gathered;    /* Copy of the statistics that were calculated by a report job for this instance */
+  statistic*  pre = NULL;  /* Pointer to the statistics that were calculated ahead of time for this instance */
+
+  /*
+   Statistics calculated by report jobs are only valid until they are first gathered.  Statistics read from the CDD
+   file stay valid until the coverage or exclusions of the instance's module change.
+  */
+  if( root->suppl.stat_gathered == 1 ) {
+    gathered                  = *(root->stat);
+    root->suppl.stat_gathered = 0;
+    pre                       = &gathered;
+  } else if( (root->suppl.stat_stored == 1) && (root->funit != NULL) && !root->funit->stat_stale ) {
+    pre = root->stored_stat;
+  }
 
   /* Create and initialize statistic structure */
   statistic_create( &(root->stat) );
@@ -519,57 +563,102 @@ void report_gather_instance_stats(
 
     /* Get coverage results for this instance */
     if( report_line && (info_suppl.part.scored_line == 1) ) {
-      line_get_stats( root->funit,
-                      &(root->stat->line_hit),
-                      &(root->stat->line_excluded),
-                      &(root->stat->line_total) );
+      if( pre != NULL ) {
+        root->stat->line_hit      = pre->line_hit;
+        root->stat->line_excluded = pre->line_excluded;
+        root->stat->line_total    = pre->line_total;
+      } else {
+        line_get_stats( root->funit,
+                        &(root->stat->line_hit),
+                        &(root->stat->line_excluded),
+                        &(root->stat->line_total) );
+      }
     }
 
     if( report_toggle && (info_suppl.part.scored_toggle == 1) ) {
-      toggle_get_stats( root->funit,
-                        &(root->stat->tog01_hit), 
-                        &(root->stat->tog10_hit),
-                        &(root->stat->tog_excluded),
-                        &(root->stat->tog_total), 
-                        &(root->stat->tog_cov_found) );
+      if( pre != NULL ) {
+        root->stat->tog01_hit     = pre->tog01_hit;
+        root->stat->tog10_hit     = pre->tog10_hit;
+        root->stat->tog_excluded  = pre->tog_excluded;
+        root->stat->tog_total     = pre->tog_total;
+        root->stat->tog_cov_found = pre->tog_cov_found;
+      } else {
+        toggle_get_stats( root->funit,
+                          &(root->stat->tog01_hit), 
+                          &(root->stat->tog10_hit),
+                          &(root->stat->tog_excluded),
+                          &(root->stat->tog_total), 
+                          &(root->stat->tog_cov_found) );
+      }
     }
 
     if( (report_combination || report_event) && ((info_suppl.part.scored_comb == 1) || (info_suppl.part.scored_events == 1)) ) {
-      combination_get_stats( root->funit,
-                             report_combination,
-                             report_event,
-                             &(root->stat->comb_hit),
-                             &(root->stat->comb_excluded),
-                             &(root->stat->comb_total) );
+      if( pre == &gathered ) {
+        root->stat->comb_hit      = pre->comb_hit;
+        root->stat->comb_excluded = pre->comb_excluded;
+        root->stat->comb_total    = pre->comb_total;
+      } else {
+        combination_get_stats( root->funit,
+                               report_combination,
+                               report_event,
+                               &(root->stat->comb_hit),
+                               &(root->stat->comb_excluded),
+                               &(root->stat->comb_total) );
+      }
     }
 
     if( report_fsm && (info_suppl.part.scored_fsm == 1) ) {
-      fsm_get_stats( root->funit->fsms,
-                     root->funit->fsm_size,
-                     &(root->stat->state_hit),
-                     &(root->stat->state_total),
-                     &(root->stat->arc_hit),
-                     &(root->stat->arc_total),
-                     &(root->stat->arc_excluded) );
+      if( pre != NULL ) {
+        root->stat->state_hit    = pre->state_hit;
+        root->stat->state_total  = pre->state_total;
+        root->stat->arc_hit      = pre->arc_hit;
+        root->stat->arc_total    = pre->arc_total;
+        root->stat->arc_excluded = pre->arc_excluded;
+      } else {
+        fsm_get_stats( root->funit->fsms,
+                       root->funit->fsm_size,
+                       &(root->stat->state_hit),
+                       &(root->stat->state_total),
+                       &(root->stat->arc_hit),
+                       &(root->stat->arc_total),
+                       &(root->stat->arc_excluded) );
+      }
     }
 
     if( report_assertion && (info_suppl.part.scored_assert == 1) ) {
-      assertion_get_stats( root->funit,
-                           &(root->stat->assert_hit),
-                           &(root->stat->assert_excluded),
-                           &(root->stat->assert_total) );
+      if( pre != NULL ) {
+        root->stat->assert_hit      = pre->assert_hit;
+        root->stat->assert_excluded = pre->assert_excluded;
+        root->stat->assert_total    = pre->assert_total;
+      } else {
+        assertion_get_stats( root->funit,
+                             &(root->stat->assert_hit),
+                             &(root->stat->assert_excluded),
+                             &(root->stat->assert_total) );
+      }
     }
 
     if( report_memory && (info_suppl.part.scored_memory == 1) ) {
-      memory_get_stats( root->funit,
-                        &(root->stat->mem_wr_hit),
-                        &(root->stat->mem_rd_hit),
-                        &(root->stat->mem_ae_total),
-                        &(root->stat->mem_tog01_hit),
-                        &(root->stat->mem_tog10_hit),
-                        &(root->stat->mem_tog_total),
-                        &(root->stat->mem_excluded),
-                        &(root->stat->mem_cov_found) );
+      if( pre != NULL ) {
+        root->stat->mem_wr_hit    = pre->mem_wr_hit;
+        root->stat->mem_rd_hit    = pre->mem_rd_hit;
+        root->stat->mem_ae_total  = pre->mem_ae_total;
+        root->stat->mem_tog01_hit = pre->mem_tog01_hit;
+        root->stat->mem_tog10_hit = pre->mem_tog10_hit;
+        root->stat->mem_tog_total = pre->mem_tog_total;
+        root->stat->mem_excluded  = pre->mem_excluded;
+        root->stat->mem_cov_found = pre->mem_cov_found;
+      } else {
+        memory_get_stats( root->funit,
+                          &(root->stat->mem_wr_hit),
+                          &(root->stat->mem_rd_hit),
+                          &(root->stat->mem_ae_total),
+                          &(root->stat->mem_tog01_hit),
+                          &(root->stat->mem_tog10_hit),
+                          &(root->stat->mem_tog_total),
+                          &(root->stat->mem_excluded),
+                          &(root->stat->mem_cov_found) );
+      }
     }
 
     /* Only get race condition statistics for this instance module if the module hasn't been gathered yet */
@@ -591,6 +680,182 @@ void report_gather_instance_stats(
 
 }
 
+/*!
+ Adds the given instance and all of its children to the specified array of instances whose statistics can be
+ gathered by a worker process.  Instances without a functional unit, OVL assertion modules and instances whose
+ statistics were stored in the CDD file are skipped.
+*/
+static void report_collect_instances(
+  funit_inst*   root,      /*!< Pointer to root of instance tree to collect */
+  funit_inst*** insts,     /*!< Pointer to array of collected instances */
+  unsigned int* inst_num   /*!< Pointer to number of elements in the insts array */
+) { PROFILE(REPORT_COLLECT_INSTANCES);
+
+  funit_inst* curr;
+
+  if( (root->funit != NULL) && ((root->suppl.stat_stored == 0) || root->funit->stat_stale) &&
+      ((info_suppl.part.assert_ovl == 0) || !ovl_is_assertion_module( root->funit )) ) {
+    *insts = (funit_inst**)realloc_safe( *insts, (sizeof( funit_inst* ) * (*inst_num)), (sizeof( funit_inst* ) * (*inst_num + 1)) );
+    (*insts)[*inst_num] = root;
+    (*inst_num)++;
+  }
+
+  curr = root->child_head;
+  while( curr != NULL ) {
+    report_collect_instances( curr, insts, inst_num );
+    curr = curr->next;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Calculates the statistics of the given instances and writes them to the specified temporary file.  Since gathering
+ the combinational logic statistics assigns the underline IDs used by the verbose report, the underline IDs of each
+ instance are written after its statistics.  This function is called by a worker process and never returns.
+*/
+static void report_stats_worker(
+  funit_inst** insts,  /*!< Array of instances to calculate statistics for */
+  unsigned int num,    /*!< Number of elements in the insts array */
+  FILE*        ofile   /*!< File to write calculated statistics to */
+) { PROFILE(REPORT_STATS_WORKER);
+
+  int          status = EXIT_SUCCESS;
+  statistic*   stat   = NULL;
+  unsigned int i;
+
+  for( i=0; (i<num) && (status == EXIT_SUCCESS); i++ ) {
+
+    func_unit* funit = insts[i]->funit;
+
+    statistic_create( &stat );
+
+    if( report_line && (info_suppl.part.scored_line == 1) ) {
+      line_get_stats( funit, &(stat->line_hit), &(stat->line_excluded), &(stat->line_total) );
+    }
+    if( report_toggle && (info_suppl.part.scored_toggle == 1) ) {
+      toggle_get_stats( funit, &(stat->tog01_hit), &(stat->tog10_hit), &(stat->tog_excluded), &(stat->tog_total), &(stat->tog_cov_found) );
+    }
+    if( (report_combination || report_event) && ((info_suppl.part.scored_comb == 1) || (info_suppl.part.scored_events == 1)) ) {
+      combination_get_stats( funit, report_combination, report_event, &(stat->comb_hit), &(stat->comb_excluded), &(stat->comb_total) );
+    }
+    if( report_fsm && (info_suppl.part.scored_fsm == 1) ) {
+      fsm_get_stats( funit->fsms, funit->fsm_size, &(stat->state_hit), &(stat->state_total), &(stat->arc_hit), &(stat->arc_total), &(stat->arc_excluded) );
+    }
+    if( report_assertion && (info_suppl.part.scored_assert == 1) ) {
+      assertion_get_stats( funit, &(stat->assert_hit), &(stat->assert_excluded), &(stat->assert_total) );
+    }
+    if( report_memory && (info_suppl.part.scored_memory == 1) ) {
+      memory_get_stats( funit, &(stat->mem_wr_hit), &(stat->mem_rd_hit), &(stat->mem_ae_total), &(stat->mem_tog01_hit),
+                        &(stat->mem_tog10_hit), &(stat->mem_tog_total), &(stat->mem_excluded), &(stat->mem_cov_found) );
+    }
+
+    if( (fwrite( stat, sizeof( statistic ), 1, ofile ) != 1) || !combination_write_ulids( funit, ofile ) ) {
+      status = EXIT_FAILURE;
+    }
+
+  }
+
+  if( fflush( ofile ) != 0 ) {
+    status = EXIT_FAILURE;
+  }
+
+  (void)fflush( stdout );
+  (void)fflush( stderr );
+
+  _exit( status );
+
+  PROFILE_END;
+
+}
+
+/*!
+ Gathers the statistics of all instances in the current database using up to report_jobs worker processes.  The
+ instances are split into groups of consecutive instances, each of which is calculated by a worker process that passes
+ the statistics and combinational logic underline IDs back to this process through a temporary file.  The statistics
+ are stored in each instance and marked as gathered so that the following call to report_gather_instance_stats uses
+ them instead of recalculating them.  If any worker process fails, the
+ remaining instances are simply gathered by report_gather_instance_stats.
+*/
+static void report_gather_instance_stats_parallel() { PROFILE(REPORT_GATHER_INSTANCE_STATS_PARALLEL);
+
+  inst_link*   instl;
+  funit_inst** insts    = NULL;
+  unsigned int inst_num = 0;
+
+  /* Collect all of the instances whose statistics need to be calculated */
+  instl = db_list[curr_db]->inst_head;
+  while( instl != NULL ) {
+    report_collect_instances( instl->inst, &insts, &inst_num );
+    instl = instl->next;
+  }
+
+  if( inst_num > 1 ) {
+
+    unsigned int group_size = (inst_num + report_jobs - 1) / report_jobs;
+    unsigned int group_num  = (inst_num + group_size - 1) / group_size;
+    FILE**       ofiles     = (FILE**)malloc_safe( sizeof( FILE* ) * group_num );
+    pid_t*       pids       = (pid_t*)malloc_safe( sizeof( pid_t ) * group_num );
+    bool         error      = FALSE;
+    unsigned int i, j;
+
+    /* Make sure that buffered output is not duplicated by the worker processes */
+    (void)fflush( stdout );
+    (void)fflush( stderr );
+
+    /* Start a worker process for each group of instances */
+    for( i=0; i<group_num; i++ ) {
+      unsigned int num = ((inst_num - (i * group_size)) < group_size) ? (inst_num - (i * group_size)) : group_size;
+      pids[i] = -1;
+      if( (ofiles[i] = tmpfile()) != NULL ) {
+        if( (pids[i] = fork()) == 0 ) {
+          report_stats_worker( (insts + (i * group_size)), num, ofiles[i] );
+        }
+      }
+    }
+
+    /* Wait for the workers to complete and store the statistics of each successful worker */
+    for( i=0; i<group_num; i++ ) {
+      bool ok = FALSE;
+      if( pids[i] > 0 ) {
+        int status;
+        ok = (waitpid( pids[i], &status, 0 ) == pids[i]) && WIFEXITED( status ) && (WEXITSTATUS( status ) == EXIT_SUCCESS);
+      }
+      if( ofiles[i] != NULL ) {
+        unsigned int rv;
+        rewind( ofiles[i] );
+        for( j=(i * group_size); ok && (j<inst_num) && (j<((i + 1) * group_size)); j++ ) {
+          statistic_create( &(insts[j]->stat) );
+          if( (fread( insts[j]->stat, sizeof( statistic ), 1, ofiles[i] ) == 1) && combination_read_ulids( insts[j]->funit, ofiles[i] ) ) {
+            insts[j]->suppl.stat_gathered = 1;
+          } else {
+            ok = FALSE;
+          }
+        }
+        rv = fclose( ofiles[i] );
+        assert( rv == 0 );
+      }
+      if( !ok ) {
+        error = TRUE;
+      }
+    }
+
+    if( error ) {
+      print_output( "Unable to gather instance statistics in one or more report jobs.  Gathering them serially...", WARNING, __FILE__, __LINE__ );
+    }
+
+    free_safe( ofiles, (sizeof( FILE* ) * group_num) );
+    free_safe( pids, (sizeof( pid_t ) * group_num) );
+
+  }
+
+  free_safe( insts, (sizeof( funit_inst* ) * inst_num) );
+
+  PROFILE_END;
+
+}
+
 /*!
  Traverses functional unit list, creating statistic structures for each
  of the functional units in the tree, and calculates summary coverage information.
@@ -811,20 +1076,191 @@ void report_print_header(
 }
 
 /*!
- \throws anonymous combination_report
+ Generates the given report section into the specified temporary file.  This function is called by a worker
+ process and never returns.
+*/
+static void report_section_worker(
+  void  (*section)( FILE*, bool ),  /*!< Pointer to function that generates the report section */
+  bool  verbose,                    /*!< Specifies if the section should be generated verbosely */
+  FILE* ofile                       /*!< Temporary file to write the generated section to */
+) { PROFILE(REPORT_SECTION_WORKER);
+
+  int status = EXIT_SUCCESS;
+
+  Try {
+    section( ofile, verbose );
+  } Catch_anonymous {
+    status = EXIT_FAILURE;
+  }
+
+  if( fflush( ofile ) != 0 ) {
+    status = EXIT_FAILURE;
+  }
+
+  (void)fflush( stdout );
+  (void)fflush( stderr );
+
+  _exit( status );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the process ID of the started worker process or -1 if the worker could not be started.
+
+ Starts a worker process that generates the given report section into a new temporary file.
+*/
+static pid_t report_start_section_worker(
+            void   (*section)( FILE*, bool ),  /*!< Pointer to function that generates the report section */
+            bool   verbose,                    /*!< Specifies if the section should be generated verbosely */
+            FILE*  ofile,                      /*!< Output stream of the report (flushed before starting the worker) */
+  /*@out@*/ FILE** tfile                       /*!< Set to the temporary file that the worker writes the section to */
+) { PROFILE(REPORT_START_SECTION_WORKER);
+
+  pid_t pid = -1;
+
+  /* Make sure that buffered output is not duplicated by the worker process */
+  (void)fflush( ofile );
+  (void)fflush( stdout );
+  (void)fflush( stderr );
+
+  if( (*tfile = tmpfile()) != NULL ) {
+    if( (pid = fork()) == 0 ) {
+      report_section_worker( section, verbose, *tfile );
+    }
+  }
+
+  PROFILE_END;
+
+  return( pid );
+
+}
+
+/*!
+ \throws anonymous Throw
+
+ Generates the given report sections using up to report_jobs worker processes.  Each section is generated into its
+ own temporary file by a worker process and the temporary files are copied to the output stream in the order of the
+ sections, so the report is the same as the report generated by calling each section function in turn.  If a worker
+ process fails, its section is generated by this process instead.  A section without a function is not generated;
+ its warning is output in its place instead.
+*/
+static void report_generate_sections_parallel(
+  FILE*        ofile,                         /*!< Pointer to output stream to display report information to */
+  void         (**sections)( FILE*, bool ),  /*!< Array of report section functions to call */
+  const char** warnings,                      /*!< Array of warnings to output in place of sections without a function */
+  unsigned int section_num,                   /*!< Number of elements in the sections array */
+  bool         verbose                        /*!< Specifies if the sections should be generated verbosely */
+) { PROFILE(REPORT_GENERATE_SECTIONS_PARALLEL);
+
+  FILE**       tfiles  = (FILE**)malloc_safe( sizeof( FILE* ) * section_num );
+  pid_t*       pids    = (pid_t*)malloc_safe( sizeof( pid_t ) * section_num );
+  unsigned int started = 0;
+  unsigned int i       = 0;
+
+  /* Start the first set of worker processes */
+  while( (started < section_num) && (started < report_jobs) ) {
+    tfiles[started] = NULL;
+    pids[started]   = (sections[started] != NULL) ? report_start_section_worker( sections[started], verbose, ofile, &tfiles[started] ) : -1;
+    started++;
+  }
+
+  Try {
+
+    for( i=0; i<section_num; i++ ) {
+
+      bool ok = FALSE;
+
+      if( pids[i] > 0 ) {
+        int status;
+        ok = (waitpid( pids[i], &status, 0 ) == pids[i]) && WIFEXITED( status ) && (WEXITSTATUS( status ) == EXIT_SUCCESS);
+      }
+
+      /* Output the warning of a section that cannot be reported or copy the generated section to the output stream */
+      if( sections[i] == NULL ) {
+        print_output( warnings[i], WARNING, __FILE__, __LINE__ );
+      } else if( ok ) {
+        char   buf[4096];
+        size_t num;
+        rewind( tfiles[i] );
+        while( (num = fread( buf, 1, 4096, tfiles[i] )) > 0 ) {
+          if( fwrite( buf, 1, num, ofile ) != num ) {
+            print_output( "Unable to write report output", FATAL, __FILE__, __LINE__ );
+            Throw 0;
+          }
+        }
+      }
+
+      if( tfiles[i] != NULL ) {
+        unsigned int rv = fclose( tfiles[i] );
+        assert( rv == 0 );
+        tfiles[i] = NULL;
+      }
+
+      /* Keep the number of running worker processes up to report_jobs */
+      if( started < section_num ) {
+        tfiles[started] = NULL;
+        pids[started]   = (sections[started] != NULL) ? report_start_section_worker( sections[started], verbose, ofile, &tfiles[started] ) : -1;
+        started++;
+      }
+
+      if( !ok && (sections[i] != NULL) ) {
+        print_output( "Unable to generate report section in a report job.  Generating it serially...", WARNING, __FILE__, __LINE__ );
+        sections[i]( ofile, verbose );
+      }
+
+    }
+
+  } Catch_anonymous {
+    unsigned int j;
+    for( j=(i + 1); j<started; j++ ) {
+      if( pids[j] > 0 ) {
+        int status;
+        (void)waitpid( pids[j], &status, 0 );
+      }
+      if( tfiles[j] != NULL ) {
+        (void)fclose( tfiles[j] );
+      }
+    }
+    free_safe( tfiles, (sizeof( FILE* ) * section_num) );
+    free_safe( pids, (sizeof( pid_t ) * section_num) );
+    Throw 0;
+  }
+
+  free_safe( tfiles, (sizeof( FILE* ) * section_num) );
+  free_safe( pids, (sizeof( pid_t ) * section_num) );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous combination_report report_generate_sections_parallel
 
  Generates a coverage report based on the options specified on the command line
- to the specified output stream.
+ to the specified output stream.  If more than one report job was requested, the
+ report sections are generated in parallel by worker processes.
 */
 static void report_generate(
   FILE* ofile  /*!< Pointer to output stream to display report information to */
 ) { PROFILE(REPORT_GENERATE);
 
+  void         (*sections[7])( FILE*, bool );
+  const char*  warnings[7];
+  unsigned int section_num = 0;
+  bool         verbose     = (report_comb_depth != REPORT_SUMMARY);
+  unsigned int i;
+
   report_print_header( ofile );
 
   /* Gather statistics first */
   if( report_instance ) {
-    inst_link* instl = db_list[curr_db]->inst_head;
+    inst_link* instl;
+    if( report_jobs > 1 ) {
+      report_gather_instance_stats_parallel();
+    }
+    instl = db_list[curr_db]->inst_head;
     while( instl != NULL ) {
       report_gather_instance_stats( instl->inst );
       instl = instl->next;
@@ -833,57 +1269,82 @@ static void report_generate(
     report_gather_funit_stats( db_list[curr_db]->funit_head );
   }
 
-  /* Call out the proper reports for the specified metrics to report */
+  /*
+   Collect the proper reports for the specified metrics to report.  A metric that was not scored is collected
+   as a warning so that the warning is output in the same place as its report would have been.
+  */
   if( report_line ) {
     if( info_suppl.part.scored_line ) {
-      line_report( ofile, (report_comb_depth != REPORT_SUMMARY) );
+      sections[section_num++] = line_report;
     } else {
-      print_output( "Line reporting requested when line coverage was not accumulated during scoring", WARNING, __FILE__, __LINE__ );
+      sections[section_num]   = NULL;
+      warnings[section_num++] = "Line reporting requested when line coverage was not accumulated during scoring";
     }
   }
 
   if( report_toggle ) {
     if( info_suppl.part.scored_toggle ) {
-      toggle_report( ofile, (report_comb_depth != REPORT_SUMMARY) );
+      sections[section_num++] = toggle_report;
     } else {
-      print_output( "Toggle reporting requested when toggle coverage was not accumulated during scoring", WARNING, __FILE__, __LINE__ );
+      sections[section_num]   = NULL;
+      warnings[section_num++] = "Toggle reporting requested when toggle coverage was not accumulated during scoring";
     }
   }
 
   if( report_memory ) {
     if( info_suppl.part.scored_memory ) {
-      memory_report( ofile, (report_comb_depth != REPORT_SUMMARY) );
+      sections[section_num++] = memory_report;
     } else {
-      print_output( "Memory reporting requested when memory coverage was not accumulated during scoring", WARNING, __FILE__, __LINE__ );
+      sections[section_num]   = NULL;
+      warnings[section_num++] = "Memory reporting requested when memory coverage was not accumulated during scoring";
     }
   }
 
   if( report_combination || report_event ) {
     if( info_suppl.part.scored_comb || info_suppl.part.scored_events ) {
-      combination_report( ofile, (report_comb_depth != REPORT_SUMMARY) );
+      sections[section_num++] = combination_report;
     } else {
-      print_output( "Combinational logic reporting requested when combinational logic coverage was not accumulated during scoring", WARNING, __FILE__, __LINE__ );
+      sections[section_num]   = NULL;
+      warnings[section_num++] = "Combinational logic reporting requested when combinational logic coverage was not accumulated during scoring";
     }
   }
 
   if( report_fsm ) {
     if( info_suppl.part.scored_fsm ) {
-      fsm_report( ofile, (report_comb_depth != REPORT_SUMMARY) );
+      sections[section_num++] = fsm_report;
     } else {
-      print_output( "FSM reporting requested when FSM coverage was not accumulated during scoring", WARNING, __FILE__, __LINE__ );
+      sections[section_num]   = NULL;
+      warnings[section_num++] = "FSM reporting requested when FSM coverage was not accumulated during scoring";
     }
   }
 
   if( report_assertion ) {
     if( info_suppl.part.scored_assert ) {
-      assertion_report( ofile, (report_comb_depth != REPORT_SUMMARY) );
+      sections[section_num++] = assertion_report;
     } else {
-      print_output( "Assertion reporting requested when assertion coverage was not accumulated during scoring", WARNING, __FILE__, __LINE__ );
+      sections[section_num]   = NULL;
+      warnings[section_num++] = "Assertion reporting requested when assertion coverage was not accumulated during scoring";
     }
   }
 
   if( report_race ) {
-    race_report( ofile, (report_comb_depth != REPORT_SUMMARY) );
+    sections[section_num++] = race_report;
+  }
+
+  /*
+   Call out the collected reports.  Obfuscated names are assigned as they are first output, so an obfuscated
+   report is always generated serially to assign them in the same order as a single report job does.
+  */
+  if( (report_jobs > 1) && (section_num > 1) && !obf_mode ) {
+    report_generate_sections_parallel( ofile, sections, warnings, section_num, verbose );
+  } else {
+    for( i=0; i<section_num; i++ ) {
+      if( sections[i] == NULL ) {
+        print_output( warnings[i], WARNING, __FILE__, __LINE__ );
+      } else {
+        sections[i]( ofile, verbose );
+      }
+    }
   }
 
   PROFILE_END;
@@ -912,6 +1373,9 @@ void report_read_cdd_and_ready(
 
     inst_link* instl;
     bool       first = (db_size == 0);
+    str_link*  merged_head;
+    str_link*  merged_tail;
+    int        merged_num;
 
     /* Read in database, performing instance merging */
     curr_db = 0;
@@ -925,9 +1389,30 @@ void report_read_cdd_and_ready(
       instl = instl->next;
     }
 
-    /* Read in database again, performing module merging */
+    /*
+     Read in database again, performing module merging.  The list of merged CDD files was already filled in by
+     the first read, so set it aside while rereading the same file to keep its merged CDD lines from being
+     treated as files specified on the command-line.
+    */
+    merged_head = merge_in_head;
+    merged_tail = merge_in_tail;
+    merged_num  = merge_in_num;
+    merge_in_head = merge_in_tail = NULL;
+    merge_in_num  = 0;
     curr_db = 1;
-    (void)db_read( ifile, READ_MODE_REPORT_MOD_MERGE );
+    Try {
+      (void)db_read( ifile, READ_MODE_REPORT_MOD_MERGE );
+    } Catch_anonymous {
+      str_link_delete_list( merge_in_head );
+      merge_in_head = merged_head;
+      merge_in_tail = merged_tail;
+      merge_in_num  = merged_num;
+      Throw 0;
+    }
+    str_link_delete_list( merge_in_head );
+    merge_in_head = merged_head;
+    merge_in_tail = merged_tail;
+    merge_in_num  = merged_num;
     bind_perform( TRUE, 0 );
 
     /* Now merge functional units and gather module statistics */
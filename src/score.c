@@ -44,6 +44,7 @@
 #include "parse.h"
 #include "param.h"
 #include "perf.h"
+#include "ppcache.h"
 #include "score.h"
 #include "search.h"
 #include "sys_tasks.h"
@@ -95,8 +96,11 @@ int flag_race_check = WARNING;
 /*! Specifies if race condition checking should occur */
 bool flag_check_races = TRUE;
 
-/*! Specifies if simulation performance information should be output */
-static bool flag_display_sim_stats = FALSE;
+/*! Specifies if elaboration and simulation performance information should be output */
+bool flag_display_sim_stats = FALSE;
+
+/*! Maximum number of worker processes used to fill the preprocessor cache (-j option) */
+static unsigned int score_jobs = 0;
 
 /*! Specifies the supported global generation value */
 unsigned int flag_global_generation = GENERATION_SV;
@@ -126,6 +130,12 @@ char* cdd_message = NULL;
 */
 bool flag_conservative = FALSE;
 
+/*!
+ Specifies if instances of the same module with the same resolved parameter values should share the sizing of their
+ module when the design is written to the CDD file (-share-insts option).
+*/
+bool flag_share_insts = FALSE;
+
 /*!
  Pointer to head of string list containing the names of modules that should be ignored for race condition checking.
 */
@@ -166,6 +176,7 @@ extern int64     largest_malloc_size;
 extern int64     curr_malloc_size;
 extern str_link* use_files_head;
 extern char      user_msg[USER_MSG_LENGTH];
+extern char*     ppcache_dir;
 extern bool      debug_mode;
 extern isuppl    info_suppl;
 extern char      score_run_path[4096];
@@ -231,13 +242,25 @@ static void score_usage() {
   printf( "      -y <directory>               Directory to find unspecified Verilog files.\n" );
   printf( "      -v <filename>                Name of specific Verilog file to score.\n" );
   printf( "      -D <define_name>(=<value>)   Defines the specified name to 1 or the specified value.\n" );
-  printf( "      -p <filename>                Specifies name of file to use for preprocessor output.\n" );
+  printf( "      -p <filename>                Specifies name of file to write preprocessor output to.  The file is kept\n" );
+  printf( "                                     after scoring for debugging.  If not specified, the preprocessor output\n" );
+  printf( "                                     is kept in memory.\n" );
+  printf( "      -cache <directory>           Directory to store preprocessor output in.  Files that are unchanged since a previous\n" );
+  printf( "                                     run with the same -I and -g options (and the same values for the defines that they\n" );
+  printf( "                                     use) are not preprocessed again, although they are still parsed.  The list of\n" );
+  printf( "                                     files in each -y directory is also stored and reused while the directory is\n" );
+  printf( "                                     unchanged.\n" );
+  printf( "      -j <number>                  Preprocesses the -v files using up to <number> worker processes in parallel before\n" );
+  printf( "                                     the design is parsed.  The output is stored in the -cache directory or, if no\n" );
+  printf( "                                     -cache option is specified, in a temporary directory.  The design itself is\n" );
+  printf( "                                     still parsed by a single process.\n" );
   printf( "      -P <parameter_scope>=<value> Performs a defparam on the specified parameter with value.\n" );
   printf( "      -T min|typ|max               Specifies value to use in delay expressions of the form min:typ:max.\n" );
   printf( "      -ts <number>                 If design is being scored, specifying this option will output\n" );
   printf( "                                     the current timestep (by increments of <number>) to standard output.\n" );
-  printf( "      -S                           Outputs simulation performance information after scoring has completed.  This\n" );
-  printf( "                                     information is currently only useful for the developers of Covered.\n" );
+  printf( "      -S                           Outputs design elaboration time and memory usage and simulation performance\n" );
+  printf( "                                     information after scoring has completed.  This information is currently only\n" );
+  printf( "                                     useful for the developers of Covered.\n" );
   printf( "      -g (<module>=)[1|2|3]        Selects generation of Verilog syntax that the parser will handle.  If\n" );
   printf( "                                     <module>= is present, only the specified module will use the provided\n" );
   printf( "                                     generation.  If <module>= is not specified, the entire design will use\n" );
@@ -257,6 +280,10 @@ static void score_usage() {
   printf( "                                     discrepancies leading to potentially inaccurate coverage results are removed from\n" );
   printf( "                                     coverage consideration.  See User's Guide for more information on what type of code\n" );
   printf( "                                     can lead to coverage inaccuracies.\n" );
+  printf( "      -share-insts                 Instances of a module whose resolved parameter values match those of the previously\n" );
+  printf( "                                     written instance of that module reuse its sizing when the CDD file is written instead\n" );
+  printf( "                                     of resizing the module again.  Speeds up writing designs with many identically\n" );
+  printf( "                                     parameterized instances.  The CDD file is not changed.\n" );
   printf( "      -Wignore                     Suppress the output of warnings during code parsing and simulation.\n" );
   printf( "\n" );
   printf( "      +libext+.<extension>(+.<extension>)+\n" );
@@ -588,7 +615,7 @@ static void score_parse_metrics(
 /*!
  \return Returns TRUE if the help option was parsed.
 
- \throws anonymous search_add_directory_path Throw Throw Throw Throw Throw Throw Throw Throw Throw Throw Throw Throw
+ \throws anonymous Throw Throw Throw Throw Throw Throw Throw Throw Throw Throw Throw Throw
                    Throw Throw Throw Throw Throw Throw Throw Throw Throw Throw score_parse_args ovl_add_assertions_to_no_score_list
                    fsm_arg_parse read_command_file search_add_file defparam_add search_add_extensions search_add_no_score_funit
 
@@ -1051,6 +1078,40 @@ static bool score_parse_args(
         Throw 0;
       }
         
+    } else if( strncmp( "-cache", argv[i], 6 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( ppcache_dir != NULL ) {
+          print_output( "Only one -cache option is allowed on the score command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else if( directory_exists( argv[i] ) ) {
+          ppcache_dir = strdup_safe( argv[i] );
+        } else {
+          unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Specified -cache directory (%s) does not exist", argv[i] );
+          assert( rv < USER_MSG_LENGTH );
+          print_output( user_msg, FATAL, __FILE__, __LINE__ );
+          Throw 0;
+        }
+      } else {
+        Throw 0;
+      }
+
+    } else if( strncmp( "-j", argv[i], 2 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( score_jobs != 0 ) {
+          print_output( "Only one -j option is allowed on the score command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else {
+          if( (sscanf( argv[i], "%u", &score_jobs ) != 1) || (score_jobs == 0) ) {
+            print_output( "Value specified after -j must be a positive, non-zero number", FATAL, __FILE__, __LINE__ );
+            Throw 0;
+          }
+        }
+      } else {
+        Throw 0;
+      }
+
     } else if( strncmp( "-P", argv[i], 2 ) == 0 ) {
 
       if( check_option_value( argc, argv, i ) ) {
@@ -1254,6 +1315,10 @@ static bool score_parse_args(
 
       flag_conservative = TRUE;
 
+    } else if( strncmp( "-share-insts", argv[i], 12 ) == 0 ) {
+
+      flag_share_insts = TRUE;
+
     } else if( strncmp( "-Wignore", argv[i], 8 ) == 0 ) {
 
       warnings_suppressed = TRUE;
@@ -1355,7 +1420,9 @@ void command_score(
       if( use_files_head != NULL ) {
         print_output( "Reading design...", NORMAL, __FILE__, __LINE__ );
         search_init();
+        ppcache_populate( score_jobs );
         parse_design( top_module, output_db );
+        ppcache_dealloc();
         print_output( "", NORMAL, __FILE__, __LINE__ );
       }
 
@@ -1416,6 +1483,9 @@ void command_score(
   /* Deallocate memory for system tasks */
   sys_task_dealloc();
 
+  /* Deallocate memory for preprocessor cache */
+  ppcache_dealloc();
+
   /* Deallocate generation module string list */
   str_link_delete_list( gen_mod_head );
 
@@ -27,8 +27,12 @@
 #ifdef HAVE_STRING_H
 #include <string.h>
 #endif
+#include <stdio.h>
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <dirent.h>
+#include <time.h>
+#include <unistd.h>
 
 #include "defines.h"
 #include "search.h"
@@ -50,6 +54,55 @@
 /*@null@*/ static str_link* extensions_head = NULL;   /*!< Pointer to head element of extensions list */
 /*@null@*/ static str_link* extensions_tail = NULL;   /*!< Pointer to tail element of extensions list */
 
+/*!
+ Name of the directory to store preprocessor cache entries and library directory indices in (value of the -cache
+ option).  If this value is NULL, nothing is cached.
+*/
+char* ppcache_dir = NULL;
+
+/*!
+ Maps the name of each file in the used files list to its position in the list (built by search_init).
+*/
+static name_index vfile_paths = {NULL, NULL, NULL, 0, 0};
+
+/*!
+ Maps the module name of each library file in the used files list to the position of the first library
+ file with that module name (built by search_init).
+*/
+static name_index vfile_mods = {NULL, NULL, NULL, 0, 0};
+
+/*!
+ Array of pointers to the elements of the used files list, in list order.
+*/
+static str_link** vfiles = NULL;
+
+/*!
+ Number of elements in the vfiles array.
+*/
+static unsigned int vfile_num = 0;
+
+/*!
+ Allocated number of elements in the vfiles array.
+*/
+static unsigned int vfile_alloc = 0;
+
+/*!
+ For each position in the used files list, contains the position of the first file at or after it that is
+ not a library file (vfile_num if there is none).  Contains vfile_num + 1 elements.
+*/
+static unsigned int* vfile_next_src = NULL;
+
+/*!
+ For each position of a library file in the used files list, contains the position of the next library file
+ with the same module name (vfile_num if there is none).
+*/
+static unsigned int* vfile_next_mod = NULL;
+
+/*!
+ Set to TRUE once a warning has been output for a library directory index that could not be written.
+*/
+static bool dir_index_warned = FALSE;
+
 extern db**         db_list;
 extern unsigned int db_size;
 extern unsigned int curr_db;
@@ -60,11 +113,529 @@ extern func_unit*   global_funit;
 extern func_unit*   curr_funit;
 extern unsigned int flag_global_generation;
 
+/*!
+ Takes in a filename (with possible directory information and/or possible extension)
+ and transforms it into a filename with the directory and extension information stripped
+ off.  Much like the the functionality of the unix command "basename".  Returns the 
+ stripped filename in the mname parameter.
+*/
+static void convert_file_to_module(
+  char* mname,  /*!< Name of module extracted */
+  int   len,    /*!< Length of mname string (we cannot exceed this value) */
+  char* fname   /*!< Name of filename to extract module name from */
+) { PROFILE(CONVERT_FILE_TO_MODULE);
+
+  char* ptr;   /* Pointer to current character in filename */
+  char* lptr;  /* Pointer to last character in module name */
+  int   i;     /* Loop iterator */
+
+  /* Set ptr to end of fname string */
+  ptr  = fname + strlen( fname );
+  lptr = ptr;
+
+  /* Continue back until period is found */
+  while( (ptr > fname) && (*ptr != '.') ) {
+    ptr--;
+  }
+
+  if( ptr > fname ) {
+    lptr = ptr;
+  }
+
+  /* Continue on until ptr == fname or we have reached a non-filename character */
+  while( (ptr > fname) && (*ptr != '/') ) {
+    ptr--;
+  }
+
+  /* Construct new name */
+  if( ptr > fname ) {
+    ptr++;
+  }
+
+  assert( (lptr - ptr) < len );
+
+  i = 0;
+  while( ptr < lptr ) {
+    mname[i] = *ptr;
+    ptr++;
+    i++;
+  }
+  mname[i] = '\0';
+
+  PROFILE_END;
+
+}
+
+
+/*!
+ \return Returns the name of the library directory index file for the given directory in the cache
+         directory (memory allocated).
+
+ The name of the index file is calculated from the absolute pathname of the directory, which is returned
+ in abs_dir.
+*/
+static char* search_dir_index_name(
+            const char* dir,     /*!< Name of library directory */
+  /*@out@*/ char**      abs_dir  /*!< Set to the absolute pathname of the library directory (memory allocated) */
+) { PROFILE(SEARCH_DIR_INDEX_NAME);
+
+  char*        iname;
+  unsigned int slen;
+  unsigned int rv;
+
+  if( dir[0] == '/' ) {
+    *abs_dir = strdup_safe( dir );
+  } else {
+    char cwd[4096];
+    if( getcwd( cwd, 4096 ) == NULL ) {
+      print_output( "Unable to get current working directory", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+    slen     = strlen( cwd ) + strlen( dir ) + 2;
+    *abs_dir = (char*)malloc_safe( slen );
+    rv       = snprintf( *abs_dir, slen, "%s/%s", cwd, dir );
+    assert( rv < slen );
+  }
+
+  slen  = strlen( ppcache_dir ) + 14;
+  iname = (char*)malloc_safe( slen );
+  rv    = snprintf( iname, slen, "%s/%08x.ydx", ppcache_dir, util_hash_string( HASH_INIT, *abs_dir ) );
+  assert( rv < slen );
+
+  PROFILE_END;
+
+  return( iname );
+
+}
+
 /*!
  \throws anonymous Throw
 
+ Reads the given library directory and stores the name of every file in it that has a file extension
+ to the given list, in directory order.
+*/
+static void search_scan_directory(
+            const char* dir,         /*!< Name of library directory to read */
+  /*@out@*/ str_link**  names_head,  /*!< Pointer to head of list of file names */
+  /*@out@*/ str_link**  names_tail   /*!< Pointer to tail of list of file names */
+) { PROFILE(SEARCH_SCAN_DIRECTORY);
+
+  DIR*           dir_handle;
+  struct dirent* dirp;
+
+  if( (dir_handle = opendir( dir )) == NULL ) {
+
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Unable to read directory %s", dir );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, FATAL, __FILE__, __LINE__ );
+    Throw 0;
+
+  } else {
+
+    unsigned int rv;
+
+    while( (dirp = readdir( dir_handle )) != NULL ) {
+      if( strrchr( dirp->d_name, '.' ) != NULL ) {
+        (void)str_link_add( strdup_safe( dirp->d_name ), names_head, names_tail );
+      }
+    }
+
+    rv = closedir( dir_handle );
+    assert( rv == 0 );
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the string that was read (memory allocated) or NULL if the string could not be read.
+
+ Reads a string, preceded by its length, from the given library directory index file.
+*/
+static char* search_read_str(
+  FILE* file,   /*!< Pointer to library directory index file */
+  long  limit   /*!< Size of the index file (a string cannot be longer than this) */
+) { PROFILE(SEARCH_READ_STR);
+
+  char*  str = NULL;
+  uint32 len;
+
+  if( (fread( &len, sizeof( uint32 ), 1, file ) == 1) && (len <= limit) ) {
+    str = (char*)malloc_safe_nolimit( len + 1 );
+    if( fread( str, 1, len, file ) == len ) {
+      str[len] = '\0';
+    } else {
+      free_safe( str, (len + 1) );
+      str = NULL;
+    }
+  }
+
+  PROFILE_END;
+
+  return( str );
+
+}
+
+/*!
+ \return Returns TRUE if the given index file describes the given directory as it is now and its list of
+         file names was read; otherwise, returns FALSE.
+
+ Reads the list of file names stored in the given library directory index file.  The index is only used
+ if it was written for the same directory (pathname, device and inode) and the modification time of the
+ directory has not changed since then, meaning that no file has been added, removed or renamed.
+*/
+static bool search_read_dir_index(
+            const char*        iname,       /*!< Name of library directory index file */
+            const char*        abs_dir,     /*!< Absolute pathname of library directory */
+            const struct stat* st,          /*!< Current status of library directory */
+  /*@out@*/ str_link**         names_head,  /*!< Pointer to head of list of file names */
+  /*@out@*/ str_link**         names_tail   /*!< Pointer to tail of list of file names */
+) { PROFILE(SEARCH_READ_DIR_INDEX);
+
+  bool  valid = FALSE;
+  FILE* file;
+
+  if( (file = fopen( iname, "rb" )) != NULL ) {
+
+    long   limit = 0;
+    uint32 version;
+    uint64 dev, ino, mtime;
+    uint32 num;
+    uint32 i;
+    char*  str;
+
+    if( (fseek( file, 0, SEEK_END ) == 0) && ((limit = ftell( file )) > 0) ) {
+      rewind( file );
+    }
+
+    valid = (limit > 0) &&
+            (fread( &version, sizeof( uint32 ), 1, file ) == 1) && (version == DIR_INDEX_VERSION);
+
+    if( valid ) {
+      str   = search_read_str( file, limit );
+      valid = (str != NULL) && (strcmp( str, abs_dir ) == 0);
+      if( str != NULL ) {
+        free_safe( str, (strlen( str ) + 1) );
+      }
+    }
+
+    valid = valid &&
+            (fread( &dev,   sizeof( uint64 ), 1, file ) == 1) && (dev   == (uint64)st->st_dev) &&
+            (fread( &ino,   sizeof( uint64 ), 1, file ) == 1) && (ino   == (uint64)st->st_ino) &&
+            (fread( &mtime, sizeof( uint64 ), 1, file ) == 1) && (mtime == (uint64)st->st_mtime) &&
+            (fread( &num,   sizeof( uint32 ), 1, file ) == 1);
+
+    for( i=0; (i<num) && valid; i++ ) {
+      if( (valid = ((str = search_read_str( file, limit )) != NULL)) ) {
+        (void)str_link_add( str, names_head, names_tail );
+      }
+    }
+
+    if( !valid ) {
+      str_link_delete_list( *names_head );
+      *names_head = NULL;
+      *names_tail = NULL;
+    }
+
+    (void)fclose( file );
+
+  }
+
+  PROFILE_END;
+
+  return( valid );
+
+}
+
+/*!
+ Writes the given list of file names of a library directory to the given library directory index file.  The
+ index is written to a temporary file that is renamed into place so that a partially written index is never
+ read.  Failing to write an index is not fatal.
+*/
+static void search_write_dir_index(
+  const char*        iname,      /*!< Name of library directory index file */
+  const char*        abs_dir,    /*!< Absolute pathname of library directory */
+  const struct stat* st,         /*!< Status of library directory when it was read */
+  str_link*          names_head  /*!< Pointer to head of list of file names */
+) { PROFILE(SEARCH_WRITE_DIR_INDEX);
+
+  unsigned int slen  = strlen( iname ) + 12;
+  char*        tmp   = (char*)malloc_safe( slen );
+  bool         error = TRUE;
+  FILE*        file;
+  unsigned int rv;
+
+  rv = snprintf( tmp, slen, "%s.%d", iname, (int)getpid() );
+  assert( rv < slen );
+
+  if( (file = fopen( tmp, "wb" )) != NULL ) {
+
+    uint32    version = DIR_INDEX_VERSION;
+    uint64    dev     = st->st_dev;
+    uint64    ino     = st->st_ino;
+    uint64    mtime   = st->st_mtime;
+    uint32    num     = 0;
+    uint32    len     = strlen( abs_dir );
+    str_link* strl;
+
+    for( strl=names_head; strl!=NULL; strl=strl->next ) {
+      num++;
+    }
+
+    error = (fwrite( &version, sizeof( uint32 ), 1, file ) != 1) ||
+            (fwrite( &len, sizeof( uint32 ), 1, file ) != 1) || (fwrite( abs_dir, 1, len, file ) != len) ||
+            (fwrite( &dev,   sizeof( uint64 ), 1, file ) != 1) ||
+            (fwrite( &ino,   sizeof( uint64 ), 1, file ) != 1) ||
+            (fwrite( &mtime, sizeof( uint64 ), 1, file ) != 1) ||
+            (fwrite( &num,   sizeof( uint32 ), 1, file ) != 1);
+
+    for( strl=names_head; (strl!=NULL) && !error; strl=strl->next ) {
+      len   = strlen( strl->str );
+      error = (fwrite( &len, sizeof( uint32 ), 1, file ) != 1) || (fwrite( strl->str, 1, len, file ) != len);
+    }
+
+    if( fclose( file ) != 0 ) {
+      error = TRUE;
+    }
+
+    if( !error ) {
+      error = (rename( tmp, iname ) != 0);
+    }
+    if( error ) {
+      (void)remove( tmp );
+    }
+
+  }
+
+  if( error && !dir_index_warned ) {
+    rv = snprintf( user_msg, USER_MSG_LENGTH, "Unable to write library directory index to cache directory \"%s\"", ppcache_dir );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, WARNING, __FILE__, __LINE__ );
+    dir_index_warned = TRUE;
+  }
+
+  free_safe( tmp, slen );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if the list of file names was read from the library directory index in the cache
+         directory; otherwise, returns FALSE.
+
+ \throws anonymous search_scan_directory
+
+ Gets the names of all files with an extension in the given library directory.  If a cache directory was
+ specified with the -cache option, the names are read from the index of the directory stored there when the
+ directory has not changed; otherwise, the directory is read and its index is updated.
+*/
+static bool search_read_directory(
+            const char* dir,         /*!< Name of library directory */
+  /*@out@*/ str_link**  names_head,  /*!< Pointer to head of list of file names */
+  /*@out@*/ str_link**  names_tail   /*!< Pointer to tail of list of file names */
+) { PROFILE(SEARCH_READ_DIRECTORY);
+
+  bool        retval = FALSE;
+  struct stat st;
+
+  if( (ppcache_dir != NULL) && (stat( dir, &st ) == 0) ) {
+
+    char*  abs_dir;
+    char*  iname = search_dir_index_name( dir, &abs_dir );
+    time_t start = time( NULL );
+
+    if( !(retval = search_read_dir_index( iname, abs_dir, &st, names_head, names_tail )) ) {
+
+      Try {
+        search_scan_directory( dir, names_head, names_tail );
+      } Catch_anonymous {
+        free_safe( iname, (strlen( iname ) + 1) );
+        free_safe( abs_dir, (strlen( abs_dir ) + 1) );
+        Throw 0;
+      }
+
+      /*
+       Only store the index if the directory was last modified before it was read; otherwise, a file added
+       later within the same second would not change the modification time that the index is checked against.
+      */
+      if( st.st_mtime < start ) {
+        search_write_dir_index( iname, abs_dir, &st, *names_head );
+      }
+
+    }
+
+    free_safe( iname, (strlen( iname ) + 1) );
+    free_safe( abs_dir, (strlen( abs_dir ) + 1) );
+
+  } else {
+
+    search_scan_directory( dir, names_head, names_tail );
+
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ Records the position of the given element of the used files list.
+*/
+static void search_add_vfile(
+  str_link* strl  /*!< Pointer to used files list element that was added to the end of the list */
+) { PROFILE(SEARCH_ADD_VFILE);
+
+  if( vfile_num == vfile_alloc ) {
+    unsigned int alloc = (vfile_alloc == 0) ? 64 : (vfile_alloc * 2);
+    vfiles      = (str_link**)realloc_safe_nolimit( vfiles, (sizeof( str_link* ) * vfile_alloc), (sizeof( str_link* ) * alloc) );
+    vfile_alloc = alloc;
+  }
+
+  name_index_add( &vfile_paths, strl->str, vfile_num );
+  vfiles[vfile_num++] = strl;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous search_read_directory
+
+ Replaces each library directory in the used files list with the files in that directory whose extensions
+ were specified (in directory order) and removes duplicate files, keeping each file at the position it was
+ first added.  A file that was specified with -v after it was found in a library directory is no longer
+ treated as a library file.  Then creates the indices used by get_next_vfile to find the next file to parse
+ without scanning the list.
+*/
+static void search_load_files() { PROFILE(SEARCH_LOAD_FILES);
+
+  str_link*     strl     = use_files_head;
+  unsigned int  dirs     = 0;
+  unsigned int  dir_hits = 0;
+  unsigned int* tails;
+  unsigned int  i;
+
+  use_files_head = NULL;
+  use_files_tail = NULL;
+
+  while( strl != NULL ) {
+
+    str_link* next = strl->next;
+    int       elem;
+
+    strl->next = NULL;
+
+    if( (strl->suppl & 0x2) == 0x2 ) {
+
+      str_link* names_head = NULL;
+      str_link* names_tail = NULL;
+      str_link* name;
+
+      Try {
+        if( search_read_directory( strl->str, &names_head, &names_tail ) ) {
+          dir_hits++;
+        }
+      } Catch_anonymous {
+        str_link_delete_list( strl );
+        str_link_delete_list( next );
+        Throw 0;
+      }
+      dirs++;
+
+      for( name=names_head; name!=NULL; name=name->next ) {
+        const char* ext      = strrchr( name->str, '.' ) + 1;
+        str_link*   curr_ext = extensions_head;
+        uint32      num_ext  = 0;
+        while( (curr_ext != NULL) && (num_ext < strl->suppl2) && (strcmp( ext, curr_ext->str ) != 0) ) {
+          curr_ext = curr_ext->next;
+          num_ext++;
+        }
+        if( (curr_ext != NULL) && (num_ext < strl->suppl2) ) {
+          unsigned int tmpchars = strlen( name->str ) + strlen( strl->str ) + 2;
+          char*        tmpfile  = (char*)malloc_safe( tmpchars );
+          unsigned int rv       = snprintf( tmpfile, tmpchars, "%s/%s", strl->str, name->str );
+          assert( rv < tmpchars );
+          if( name_index_find( &vfile_paths, tmpfile ) == -1 ) {
+            str_link* file = str_link_add( tmpfile, &use_files_head, &use_files_tail );
+            file->suppl = 0x1;
+            search_add_vfile( file );
+          } else {
+            free_safe( tmpfile, tmpchars );
+          }
+        }
+      }
+
+      str_link_delete_list( names_head );
+      str_link_delete_list( strl );
+
+    } else if( (elem = name_index_find( &vfile_paths, strl->str )) != -1 ) {
+
+      vfiles[elem]->suppl = 0x0;
+      str_link_delete_list( strl );
+
+    } else {
+
+      if( use_files_head == NULL ) {
+        use_files_head = use_files_tail = strl;
+      } else {
+        use_files_tail->next = strl;
+        use_files_tail       = strl;
+      }
+      search_add_vfile( strl );
+
+    }
+
+    strl = next;
+
+  }
+
+  if( dir_hits > 0 ) {
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Loaded %u of %u library directory file lists from cache directory \"%s\"", dir_hits, dirs, ppcache_dir );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+  }
+
+  /* Find the next non-library file at or after each position */
+  vfile_next_src            = (unsigned int*)malloc_safe_nolimit( sizeof( unsigned int ) * (vfile_num + 1) );
+  vfile_next_src[vfile_num] = vfile_num;
+  for( i=vfile_num; i>0; i-- ) {
+    vfile_next_src[i-1] = ((vfiles[i-1]->suppl & 0x1) == 0x1) ? vfile_next_src[i] : (i - 1);
+  }
+
+  /* Chain together the library files with the same module name in list order */
+  vfile_next_mod = (unsigned int*)malloc_safe_nolimit( sizeof( unsigned int ) * (vfile_num + 1) );
+  tails          = (unsigned int*)malloc_safe_nolimit( sizeof( unsigned int ) * (vfile_num + 1) );
+  for( i=0; i<vfile_num; i++ ) {
+    vfile_next_mod[i] = vfile_num;
+    if( (vfiles[i]->suppl & 0x1) == 0x1 ) {
+      char name[256];
+      int  first;
+      convert_file_to_module( name, 256, vfiles[i]->str );
+      if( (first = name_index_find( &vfile_mods, name )) == -1 ) {
+        name_index_add( &vfile_mods, name, i );
+        tails[i] = i;
+      } else {
+        vfile_next_mod[tails[first]] = i;
+        tails[first]                 = i;
+      }
+    }
+  }
+  free_safe( tails, (sizeof( unsigned int ) * (vfile_num + 1)) );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous Throw search_load_files
+
  Creates root module for module_node tree.  If a module_node points to this node as its parent,
- that node is considered the root node of the tree.
+ that node is considered the root node of the tree.  Also reads the library directories and
+ prepares the list of Verilog files to search for modules.
 */
 void search_init() { PROFILE(SEARCH_INIT);
 
@@ -79,6 +650,9 @@ void search_init() { PROFILE(SEARCH_INIT);
     Throw 0;
   }
 
+  /* Read the library directories and index the files to search */
+  search_load_files();
+
   /* If the global generation type is SystemVerilog support, create the global $root module space */
   if( flag_global_generation == GENERATION_SV ) {
 
@@ -184,20 +758,27 @@ void search_add_include_path(
 /*!
  \param path Name of directory to find unspecified Verilog files
 
- \throws anonymous directory_load
-
- Adds the given library directory path to the list if the pathname is valid.
+ Adds the given library directory path to the list if the pathname is valid.  The directory
+ is read by search_init, using the file extensions that have been specified so far.
 */
 void search_add_directory_path(
   const char* path
 ) { PROFILE(SEARCH_ADD_DIRECTORY_PATH);
 
   if( directory_exists( path ) ) {
+    str_link*       strl;
+    const str_link* curr_ext;
+    uint32          num_ext = 0;
     /* If no library extensions have been specified, assume *.v */
     if( extensions_head == NULL ) {
       (void)str_link_add( strdup_safe( "v" ), &(extensions_head), &(extensions_tail) );
     }
-    directory_load( path, extensions_head, &(use_files_head), &(use_files_tail) );
+    for( curr_ext=extensions_head; curr_ext!=NULL; curr_ext=curr_ext->next ) {
+      num_ext++;
+    }
+    strl         = str_link_add( strdup_safe( path ), &(use_files_head), &(use_files_tail) );
+    strl->suppl  = 0x2;
+    strl->suppl2 = num_ext;
   } else {
     unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Library directory %s does not exist", path );
     assert( rv < USER_MSG_LENGTH );
@@ -219,14 +800,10 @@ void search_add_file(
 
   char* tmp;  /* Temporary filename */
 
+  /* Files that are added more than once are removed by search_init */
   if( file_exists( file ) ) {
-    str_link* strl;
-    if( (strl = str_link_find( file, use_files_head )) == NULL ) {
-      tmp = strdup_safe( file );
-      (void)str_link_add( tmp, &use_files_head, &use_files_tail );
-    } else {
-      strl->suppl = 0x0;
-    }
+    tmp = strdup_safe( file );
+    (void)str_link_add( tmp, &use_files_head, &use_files_tail );
   } else {
     unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "File %s does not exist", file );
     assert( rv < USER_MSG_LENGTH );
@@ -310,6 +887,59 @@ void search_add_extensions(
 
 }
 
+/*!
+ \return Returns pointer to next Verilog file to parse or NULL if no files were found.
+
+ Finds the first file at or after the specified file in the used files list that should be parsed next.
+ This is either a file that is not a library file or a library file whose name (without directory and
+ extension) is the name of the module to search for.  Both are found through the indices created by
+ search_init instead of scanning the list.
+*/
+str_link* get_next_vfile(
+  str_link*   curr,  /*!< Pointer to current file in list */
+  const char* mod    /*!< Name of module searching for */
+) { PROFILE(GET_NEXT_VFILE);
+
+  str_link* next = NULL;  /* Pointer to next Verilog file to parse */
+
+  if( curr != NULL ) {
+
+    int          pos  = name_index_find( &vfile_paths, curr->str );
+    int          lib  = name_index_find( &vfile_mods, mod );
+    unsigned int found;
+
+    assert( pos != -1 );
+
+    found = vfile_next_src[pos];
+
+    /* Find the first library file for this module at or after the current position */
+    while( (lib != -1) && ((unsigned int)lib < found) ) {
+      char name[256];
+      convert_file_to_module( name, 256, vfiles[lib]->str );
+      if( (lib >= pos) && (strcmp( name, mod ) == 0) ) {
+        found = lib;
+      } else {
+        lib = (vfile_next_mod[lib] == vfile_num) ? -1 : (int)vfile_next_mod[lib];
+      }
+    }
+
+    if( found < vfile_num ) {
+      next = vfiles[found];
+    }
+
+  }
+
+  /* Specify that the returned file will be parsed */
+  if( next != NULL ) {
+    next->suppl2 = 1;
+  }
+
+  PROFILE_END;
+
+  return( next );
+
+}
+
 /*!
  This function should be called after all parsing is completed.  
  Deletes all initialized lists.
@@ -321,6 +951,17 @@ void search_free_lists() { PROFILE(SEARCH_FREE_LISTS);
   str_link_delete_list( extensions_head );
   str_link_delete_list( no_score_head );
 
+  name_index_dealloc( &vfile_paths );
+  name_index_dealloc( &vfile_mods );
+  free_safe( vfiles, (sizeof( str_link* ) * vfile_alloc) );
+  free_safe( vfile_next_src, (sizeof( unsigned int ) * (vfile_num + 1)) );
+  free_safe( vfile_next_mod, (sizeof( unsigned int ) * (vfile_num + 1)) );
+  vfiles         = NULL;
+  vfile_num      = 0;
+  vfile_alloc    = 0;
+  vfile_next_src = NULL;
+  vfile_next_mod = NULL;
+
   PROFILE_END;
 
 }
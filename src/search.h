@@ -45,6 +45,12 @@ void search_add_no_score_funit( const char* funit );
 /*! \brief Adds specified extensions to allowed file extension list. */
 void search_add_extensions( const char* ext_list );
 
+/*! \brief Returns next Verilog file to parse. */
+str_link* get_next_vfile(
+  str_link*   curr,
+  const char* mod
+);
+
 /*! \brief Deallocates all used memory for search lists. */
 void search_free_lists();
 
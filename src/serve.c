@@ -0,0 +1,1787 @@
+/*
+ Copyright (c) 2026 agent
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     serve.c
+ \author   agent
+ \date     10/18/2026
+
+ \par
+ The serve command reads a CDD file once, keeps the design resident in memory and answers coverage
+ queries from any number of clients over a local Unix domain socket.  This allows the GUI and scripts
+ to ask many questions of a large design without paying for reading and binding the CDD file for each one.
+
+ \par
+ The protocol is line based.  Each request is a single line containing a command followed by its
+ arguments, separated by whitespace.  Each response starts with a line of the form "OK <number>",
+ followed by the given number of result lines, or is a single line of the form "ERROR <message>".
+ The following requests are understood:
+
+ - funits                                     Lists the name, type and filename of each functional unit
+ - instances                                  Lists the scope and functional unit name of each instance
+ - summary <metric> <kind> <name>             Outputs the hit, excluded and total counts of the given metric
+                                              (assert summaries are only available for modules)
+ - uncovered <metric> <kind> <name>           Lists the uncovered coverage points of the given metric
+ - covered <metric> <kind> <name>             Lists the covered coverage points of the given metric
+ - detail <metric> <kind> <name> <point>      Outputs the verbose coverage information of a single coverage point
+ - excluded <metric> <kind> <name> <point>    Outputs the exclusion value and reason of a single coverage point
+ - stats                                      Outputs the number of requests and cache hits seen by the server
+ - quit                                       Closes the connection of the client
+ - shutdown                                   Stops the server
+
+ \par
+ Where <metric> is one of line, toggle, memory, comb, fsm or assert, <kind> is module or instance and
+ <name> is the name of a functional unit or the full hierarchical scope of an instance.
+
+ \par
+ The detail and excluded requests answer the same questions that the GUI asks to display the verbose coverage of
+ a coverage point and to change its exclusion.  The <point> arguments identify the coverage point as follows:
+
+ - line <line>                                Line number (excluded only)
+ - toggle <signal>                            Signal name
+ - memory <signal>                            Memory name
+ - comb <expr_id> <ulid>                      Expression ID of a statement (as output by the uncovered and covered
+                                              requests) and the underline ID of one of its subexpressions.  The
+                                              detail request also accepts the expression ID alone to output the
+                                              code, underlines and exclusions of the whole statement.
+ - fsm <expr_id> [<from_state> <to_state>]    Expression ID of the output state expression of the FSM, followed
+                                              by a state transition for the excluded request
+ - assert <instance> [<expr_id>]              Name of the assertion instance, followed by the expression ID of
+                                              one of its coverage points for the excluded request
+
+ \par
+ The excluded request outputs a single line containing 1 if the coverage point is excluded or 0 if it is not,
+ followed by the exclusion reason (if one was given).
+
+ \par
+ The loaded CDD is never modified by the server so the response to a query is always the same.  Every
+ successful response is stored in a tree keyed on the request, allowing repeated queries to be answered
+ without recalculating them.  Clients are multiplexed with select() so that the single resident copy of
+ the design is only ever accessed by one request at a time.  Client connections are non-blocking and each
+ response is queued on its client until the client is ready to read it, so a client that stops reading
+ never holds up the others.  No further requests are read from a client while it has queued output.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdarg.h>
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "arc.h"
+#include "assertion.h"
+#include "comb.h"
+#include "db.h"
+#include "defines.h"
+#include "exclude.h"
+#include "expr.h"
+#include "fsm.h"
+#include "func_iter.h"
+#include "func_unit.h"
+#include "instance.h"
+#include "line.h"
+#include "link.h"
+#include "memory.h"
+#include "ovl.h"
+#include "profiler.h"
+#include "report.h"
+#include "serve.h"
+#include "toggle.h"
+#include "tree.h"
+#include "util.h"
+
+
+extern db**         db_list;
+extern unsigned int curr_db;
+extern isuppl       info_suppl;
+extern char         user_msg[USER_MSG_LENGTH];
+extern bool         report_line;
+extern bool         report_toggle;
+extern bool         report_memory;
+extern bool         report_combination;
+extern bool         report_fsm;
+extern bool         report_assertion;
+extern unsigned int report_comb_depth;
+
+/*!
+ Maximum number of characters that a single request line may contain.
+*/
+#define SERVE_MAX_REQUEST  4096
+
+/*!
+ Maximum number of whitespace separated words (including the command) that a single request may contain.
+*/
+#define SERVE_MAX_ARGS  8
+
+/*!
+ Information kept for each client that is currently connected to the server.
+*/
+typedef struct serve_client_s serve_client;
+struct serve_client_s {
+  int          fd;        /*!< File descriptor of the client connection */
+  char*        buf;       /*!< Characters received from the client that do not yet form a complete request */
+  unsigned int buf_size;  /*!< Number of characters stored in buf */
+  char*        out;       /*!< Response characters that have not yet been written to the client */
+  unsigned int out_size;  /*!< Number of characters allocated for out */
+  unsigned int out_sent;  /*!< Number of characters of out that have already been written to the client */
+  bool         closing;   /*!< Set to TRUE if the connection is closed once all queued output is written */
+};
+
+/*!
+ Response to a single request.
+*/
+typedef struct serve_rsp_s serve_rsp;
+struct serve_rsp_s {
+  const char*  error;  /*!< Error message of a failed request (NULL if the request succeeded) */
+  str_link*    head;   /*!< Pointer to head of the list of result lines */
+  str_link*    tail;   /*!< Pointer to tail of the list of result lines */
+  unsigned int num;    /*!< Number of result lines */
+};
+
+/*!
+ Name of CDD file that will be read and served.
+*/
+static char* serve_cdd = NULL;
+
+/*!
+ Name of the Unix domain socket that the server will listen on.  Set to the value of the -s option.
+*/
+static char* serve_socket = NULL;
+
+/*!
+ Tree associating each successfully answered query, keyed on the normalized request, with the index of
+ its response in the serve_cached array.
+*/
+static tnode* serve_cache = NULL;
+
+/*!
+ Array of cached query responses.
+*/
+static serve_rsp** serve_cached = NULL;
+
+/*!
+ Number of elements in the serve_cached array.
+*/
+static unsigned int serve_cached_num = 0;
+
+/*!
+ Number of requests answered by the server.
+*/
+static unsigned int serve_requests = 0;
+
+/*!
+ Number of requests answered from the response cache.
+*/
+static unsigned int serve_cache_hits = 0;
+
+/*!
+ Set to 1 when the server has been asked to stop (by the shutdown request or by a signal).
+*/
+static volatile sig_atomic_t serve_done = 0;
+
+
+/*!
+ Outputs usage information to standard output for serve command.
+*/
+static void serve_usage() {
+
+  printf( "\n" );
+  printf( "Usage:  covered serve (-h | ([<options>] <database_file>)\n" );
+  printf( "\n" );
+  printf( "   -h                           Displays this help information.\n" );
+  printf( "\n" );
+  printf( "   Options:\n" );
+  printf( "      -f <filename>             Name of file containing additional arguments to parse.\n" );
+  printf( "      -s <filename>             Name of the Unix domain socket to listen for queries on.  Default is covered.sock.\n" );
+  printf( "\n" );
+
+}
+
+/*!
+ \return Returns TRUE if the help option was parsed.
+
+ \throws anonymous Throw Throw Throw
+
+ Parses the serve argument list, placing all parsed values into global variables.  If an argument is found
+ that is not valid for the serve operation, an error message is reported to the user and the program
+ terminates immediately.
+*/
+static bool serve_parse_args(
+  int          argc,      /*!< Number of arguments in argument list argv */
+  int          last_arg,  /*!< Index of last parsed argument from list */
+  const char** argv       /*!< Argument list passed to this program */
+) {
+
+  int  i;
+  bool help_found = FALSE;
+
+  i = last_arg + 1;
+
+  while( (i < argc) && !help_found ) {
+
+    if( strncmp( "-h", argv[i], 2 ) == 0 ) {
+
+      serve_usage();
+      help_found = TRUE;
+
+    } else if( strncmp( "-f", argv[i], 2 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        char**       arg_list = NULL;
+        int          arg_num  = 0;
+        unsigned int j;
+        i++;
+        Try {
+          read_command_file( argv[i], &arg_list, &arg_num );
+          help_found = serve_parse_args( arg_num, -1, (const char**)arg_list );
+        } Catch_anonymous {
+          for( j=0; j<arg_num; j++ ) {
+            free_safe( arg_list[j], (strlen( arg_list[j] ) + 1) );
+          }
+          free_safe( arg_list, (sizeof( char* ) * arg_num) );
+          Throw 0;
+        }
+        for( j=0; j<arg_num; j++ ) {
+          free_safe( arg_list[j], (strlen( arg_list[j] ) + 1) );
+        }
+        free_safe( arg_list, (sizeof( char* ) * arg_num) );
+      } else {
+        Throw 0;
+      }
+
+    } else if( strncmp( "-s", argv[i], 2 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        free_safe( serve_socket, ((serve_socket != NULL) ? (strlen( serve_socket ) + 1) : 0) );
+        serve_socket = strdup_safe( argv[i] );
+      } else {
+        Throw 0;
+      }
+
+    } else if( strncmp( "-", argv[i], 1 ) == 0 ) {
+
+      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Unknown serve option (%s) specified.", argv[i] );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, FATAL, __FILE__, __LINE__ );
+      Throw 0;
+
+    } else if( (i + 1) == argc ) {
+
+      if( file_exists( argv[i] ) ) {
+        serve_cdd = strdup_safe( argv[i] );
+      } else {
+        unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Specified CDD file (%s) does not exist", argv[i] );
+        assert( rv < USER_MSG_LENGTH );
+        print_output( user_msg, FATAL, __FILE__, __LINE__ );
+        Throw 0;
+      }
+
+    } else {
+
+      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Unknown serve argument (%s) specified.", argv[i] );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, FATAL, __FILE__, __LINE__ );
+      Throw 0;
+
+    }
+
+    i++;
+
+  }
+
+  /* Make sure that a CDD file was specified */
+  if( !help_found && (last_arg != -1) && (serve_cdd == NULL) ) {
+    print_output( "A CDD file must be specified to serve", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  return( help_found );
+
+}
+
+/*!
+ Signal handler that causes the server to stop after it has finished with the current request.
+*/
+static void serve_handle_signal(
+  int sig  /*!< Signal that was received */
+) {
+
+  serve_done = 1;
+
+}
+
+/*!
+ Appends a line of text to a response, formatted with the given printf-style format string.
+*/
+static void serve_appendf(
+  serve_rsp*  rsp,     /*!< Pointer to the response to add to */
+  const char* format,  /*!< Format string of the line to append (without a newline) */
+  ...
+) { PROFILE(SERVE_APPENDF);
+
+  va_list      ap;
+  unsigned int rv;
+
+  va_start( ap, format );
+  rv = vsnprintf( user_msg, USER_MSG_LENGTH, format, ap );
+  va_end( ap );
+  assert( rv < USER_MSG_LENGTH );
+
+  (void)str_link_add( strdup_safe( user_msg ), &(rsp->head), &(rsp->tail) );
+  rsp->num++;
+
+  PROFILE_END;
+
+}
+
+/*!
+ Adds the scope and functional unit name of the given instance and all of the instances beneath it
+ to the body of a response.  Unnamed scopes and OVL assertion modules are skipped, as they are in the GUI.
+*/
+static void serve_list_instances(
+  funit_inst*   root,       /*!< Pointer to current instance */
+  serve_rsp*    rsp         /*!< Pointer to the response to add to */
+) { PROFILE(SERVE_LIST_INSTANCES);
+
+  funit_inst* curr;
+
+  if( (root->funit != NULL) && !funit_is_unnamed( root->funit ) &&
+      ((info_suppl.part.assert_ovl == 0) || !ovl_is_assertion_module( funit_get_curr_module_safe( root->funit ) )) ) {
+    char scope[4096];
+    scope[0] = '\0';
+    instance_gen_scope( scope, root, FALSE );
+    serve_appendf( rsp, "%s %s", scope, root->funit->name );
+  }
+
+  curr = root->child_head;
+  while( curr != NULL ) {
+    serve_list_instances( curr, rsp );
+    curr = curr->next;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to the functional unit with the given name in the module-merged database, or the
+         functional unit of the instance with the given scope in the instance-merged database.  Returns NULL
+         if no such functional unit exists.
+
+ Looks up the functional unit that a query refers to and sets the current database to the one that it came from.
+*/
+static func_unit* serve_find_funit(
+            const char*   kind,  /*!< Either "module" or "instance" */
+            const char*   name,  /*!< Name of the functional unit or scope of the instance */
+  /*@out@*/ funit_inst**  inst   /*!< Set to the found instance when kind is "instance"; otherwise, set to NULL */
+) { PROFILE(SERVE_FIND_FUNIT);
+
+  func_unit* funit = NULL;
+
+  *inst = NULL;
+
+  if( strcmp( kind, "module" ) == 0 ) {
+
+    funit_link* funitl = db_list[1]->funit_head;
+    while( (funitl != NULL) && ((strcmp( funitl->funit->name, name ) != 0) || funit_is_unnamed( funitl->funit )) ) {
+      funitl = funitl->next;
+    }
+    if( funitl != NULL ) {
+      funit   = funitl->funit;
+      curr_db = 1;
+    }
+
+  } else if( strcmp( kind, "instance" ) == 0 ) {
+
+    char scope[4096];
+    if( strlen( name ) < 4096 ) {
+      strcpy( scope, name );
+      if( ((*inst = inst_link_find_by_scope( scope, db_list[0]->inst_head, FALSE )) != NULL) && ((*inst)->funit != NULL) ) {
+        funit   = (*inst)->funit;
+        curr_db = 0;
+      } else {
+        *inst = NULL;
+      }
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( funit );
+
+}
+
+/*!
+ \return Returns TRUE if the given metric name was valid; otherwise, returns FALSE.
+
+ Adds the hit, excluded and total counts of the given metric to the body of a response.
+*/
+static bool serve_summary(
+  const char*   metric,     /*!< Name of metric to summarize */
+  func_unit*    funit,      /*!< Pointer to functional unit to summarize */
+  funit_inst*   inst,       /*!< Pointer to instance to summarize (NULL if summarizing a module) */
+  serve_rsp*    rsp         /*!< Pointer to the response to add to */
+) { PROFILE(SERVE_SUMMARY);
+
+  bool         retval   = TRUE;
+  unsigned int hit      = 0;
+  unsigned int excluded = 0;
+  unsigned int total    = 0;
+
+  if( strcmp( metric, "line" ) == 0 ) {
+    if( inst != NULL ) {
+      line_get_inst_summary( inst, &hit, &excluded, &total );
+    } else {
+      line_get_funit_summary( funit, &hit, &excluded, &total );
+    }
+  } else if( strcmp( metric, "toggle" ) == 0 ) {
+    if( inst != NULL ) {
+      toggle_get_inst_summary( inst, &hit, &excluded, &total );
+    } else {
+      toggle_get_funit_summary( funit, &hit, &excluded, &total );
+    }
+  } else if( strcmp( metric, "memory" ) == 0 ) {
+    if( inst != NULL ) {
+      memory_get_inst_summary( inst, &hit, &excluded, &total );
+    } else {
+      memory_get_funit_summary( funit, &hit, &excluded, &total );
+    }
+  } else if( strcmp( metric, "comb" ) == 0 ) {
+    if( inst != NULL ) {
+      combination_get_inst_summary( inst, &hit, &excluded, &total );
+    } else {
+      combination_get_funit_summary( funit, &hit, &excluded, &total );
+    }
+  } else if( strcmp( metric, "fsm" ) == 0 ) {
+    int fhit      = 0;
+    int fexcluded = 0;
+    int ftotal    = 0;
+    if( inst != NULL ) {
+      fsm_get_inst_summary( inst, &fhit, &fexcluded, &ftotal );
+    } else {
+      fsm_get_funit_summary( funit, &fhit, &fexcluded, &ftotal );
+    }
+    serve_appendf( rsp, "%d %d %d", fhit, fexcluded, ftotal );
+  } else if( strcmp( metric, "assert" ) == 0 ) {
+    assert( inst == NULL );
+    assertion_get_funit_summary( funit, &hit, &excluded, &total );
+  } else {
+    retval = FALSE;
+  }
+
+  if( retval && (strcmp( metric, "fsm" ) != 0) ) {
+    serve_appendf( rsp, "%u %u %u", hit, excluded, total );
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if the given metric name was valid; otherwise, returns FALSE.
+
+ Adds one line to the body of a response for each covered or uncovered coverage point of the given metric
+ in the given functional unit.  The coverage points are found with the same functions that the GUI uses.
+*/
+static bool serve_collect(
+  const char*   metric,     /*!< Name of metric to collect */
+  int           cov,        /*!< Set to 1 to collect covered points or to 0 to collect uncovered points */
+  func_unit*    funit,      /*!< Pointer to functional unit to collect coverage points from */
+  serve_rsp*    rsp         /*!< Pointer to the response to add to */
+) { PROFILE(SERVE_COLLECT);
+
+  bool retval = TRUE;
+
+  if( strcmp( metric, "line" ) == 0 ) {
+
+    int*  line_nums;
+    int*  excludes;
+    char** reasons;
+    int   line_cnt;
+    int   line_size;
+    int   i;
+
+    line_collect( funit, cov, &line_nums, &excludes, &reasons, &line_cnt, &line_size );
+
+    for( i=0; i<line_cnt; i++ ) {
+      if( reasons[i] != NULL ) {
+        serve_appendf( rsp, "%d %d %s", line_nums[i], excludes[i], reasons[i] );
+        free_safe( reasons[i], (strlen( reasons[i] ) + 1) );
+      } else {
+        serve_appendf( rsp, "%d %d", line_nums[i], excludes[i] );
+      }
+    }
+
+    free_safe( line_nums, (sizeof( int ) * line_size) );
+    free_safe( excludes,  (sizeof( int ) * line_size) );
+    free_safe( reasons,   (sizeof( char* ) * line_size) );
+
+  } else if( (strcmp( metric, "toggle" ) == 0) || (strcmp( metric, "memory" ) == 0) ) {
+
+    vsignal**    sigs            = NULL;
+    unsigned int sig_size        = 0;
+    unsigned int sig_no_rm_index = 1;
+    unsigned int i;
+
+    if( metric[0] == 't' ) {
+      toggle_collect( funit, cov, &sigs, &sig_size, &sig_no_rm_index );
+    } else {
+      memory_collect( funit, cov, &sigs, &sig_size, &sig_no_rm_index );
+    }
+
+    for( i=0; i<sig_size; i++ ) {
+      serve_appendf( rsp, "%s %d %u", sigs[i]->name, sigs[i]->line, sigs[i]->suppl.part.excluded );
+    }
+
+    sig_link_delete_list( sigs, sig_size, sig_no_rm_index, FALSE );
+
+  } else if( strcmp( metric, "comb" ) == 0 ) {
+
+    expression** exprs;
+    int*         excludes;
+    unsigned int exp_cnt;
+    unsigned int i;
+
+    combination_collect( funit, cov, &exprs, &exp_cnt, &excludes );
+
+    for( i=0; i<exp_cnt; i++ ) {
+      serve_appendf( rsp, "%d %d %d", exprs[i]->id, exprs[i]->line, excludes[i] );
+    }
+
+    free_safe( exprs,    (sizeof( expression* ) * exp_cnt) );
+    free_safe( excludes, (sizeof( int* ) * exp_cnt) );
+
+  } else if( strcmp( metric, "fsm" ) == 0 ) {
+
+    unsigned int i;
+
+    /*
+     Mirrors the selection made by fsm_collect, outputting the state and arc counts of each FSM in place of
+     the signals of its output state expression.
+    */
+    for( i=0; i<funit->fsm_size; i++ ) {
+
+      int state_hit    = 0;
+      int state_total  = 0;
+      int arc_hit      = 0;
+      int arc_total    = 0;
+      int arc_excluded = 0;
+      int excluded     = -1;
+
+      arc_get_stats( funit->fsms[i]->table, &state_hit, &state_total, &arc_hit, &arc_total, &arc_excluded );
+
+      if( (arc_total == -1) || (arc_total != arc_hit) ) {
+        excluded = (cov == 0) ? 0 : -1;
+      } else if( (cov == 0) && arc_are_any_excluded( funit->fsms[i]->table ) ) {
+        excluded = 1;
+      } else if( cov == 1 ) {
+        excluded = 0;
+      }
+
+      if( excluded != -1 ) {
+        expression* to_state = funit->fsms[i]->to_state;
+        serve_appendf( rsp, "%d %d %d %d %d %d %d", to_state->id, ((to_state->sig != NULL) ? to_state->sig->line : to_state->line),
+                       state_hit, state_total, arc_hit, arc_total, excluded );
+      }
+
+    }
+
+  } else if( strcmp( metric, "assert" ) == 0 ) {
+
+    char**       inst_names;
+    int*         excludes;
+    unsigned int inst_size;
+    unsigned int i;
+
+    assertion_collect( funit, cov, &inst_names, &excludes, &inst_size );
+
+    for( i=0; i<inst_size; i++ ) {
+      serve_appendf( rsp, "%s %d", inst_names[i], ((excludes != NULL) ? excludes[i] : 0) );
+      free_safe( inst_names[i], (strlen( inst_names[i] ) + 1) );
+    }
+
+    /* The exclusion array is only allocated when gathering uncovered instances */
+    free_safe( inst_names, (sizeof( char* ) * inst_size) );
+    free_safe( excludes, (sizeof( int ) * inst_size) );
+
+  } else {
+
+    retval = FALSE;
+
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if the given string is a decimal integer; otherwise, returns FALSE.
+*/
+static bool serve_parse_int(
+            const char* str,   /*!< String to parse */
+  /*@out@*/ int*        value  /*!< Set to the parsed value */
+) { PROFILE(SERVE_PARSE_INT);
+
+  int  chars_read = 0;
+  bool retval     = (sscanf( str, "%d%n", value, &chars_read ) == 1) && (str[chars_read] == '\0');
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns a pointer to the signal with the given name in the given functional unit if it exists;
+         otherwise, returns NULL.
+*/
+static vsignal* serve_find_signal(
+  func_unit*  funit,  /*!< Pointer to functional unit to search */
+  const char* name    /*!< Name of signal to find */
+) { PROFILE(SERVE_FIND_SIGNAL);
+
+  func_iter fi;
+  vsignal*  sig;
+
+  func_iter_init( &fi, funit, FALSE, TRUE, FALSE );
+  while( ((sig = func_iter_get_next_signal( &fi )) != NULL) && (strcmp( sig->name, name ) != 0) );
+  func_iter_dealloc( &fi );
+
+  PROFILE_END;
+
+  return( sig );
+
+}
+
+/*!
+ \return Returns a pointer to the statement in the given functional unit whose root expression has the given
+         expression ID if it exists; otherwise, returns NULL.
+*/
+static statement* serve_find_statement(
+  func_unit* funit,   /*!< Pointer to functional unit to search */
+  int        expr_id  /*!< Expression ID of the root expression to find */
+) { PROFILE(SERVE_FIND_STATEMENT);
+
+  func_iter  fi;
+  statement* stmt;
+
+  func_iter_init( &fi, funit, TRUE, FALSE, FALSE );
+  while( ((stmt = func_iter_get_next_statement( &fi )) != NULL) && (stmt->exp->id != expr_id) );
+  func_iter_dealloc( &fi );
+
+  PROFILE_END;
+
+  return( stmt );
+
+}
+
+/*!
+ \return Returns a pointer to the OVL assertion instance with the given name beneath the given functional unit if
+         it exists; otherwise, returns NULL.
+*/
+static funit_inst* serve_find_assertion(
+  func_unit*  funit,     /*!< Pointer to functional unit containing the assertion instance */
+  const char* inst_name  /*!< Name of the assertion instance */
+) { PROFILE(SERVE_FIND_ASSERTION);
+
+  funit_inst* child  = NULL;
+  funit_inst* funiti;
+  int         ignore = 0;
+
+  if( (info_suppl.part.assert_ovl == 1) && ((funiti = inst_link_find_by_funit( funit, db_list[curr_db]->inst_head, &ignore )) != NULL) ) {
+    child = funiti->child_head;
+    while( (child != NULL) && (strcmp( child->name, inst_name ) != 0) ) {
+      child = child->next;
+    }
+    if( (child != NULL) && ((child->funit == NULL) || !ovl_is_assertion_module( child->funit )) ) {
+      child = NULL;
+    }
+  }
+
+  PROFILE_END;
+
+  return( child );
+
+}
+
+/*!
+ \return Returns TRUE if the FSM with the given output state expression ID exists (and the given state transition
+         exists, if one is specified); otherwise, returns FALSE.
+
+ Gets the verbose coverage information of the FSM with the given output state expression ID in the same way as
+ the GUI.  If from_state is NULL, all of the information is added to the body of a response; otherwise, only
+ the exclusion value and reason of the state transition from from_state to to_state are added.
+*/
+static bool serve_fsm_coverage(
+  func_unit*  funit,       /*!< Pointer to functional unit containing the FSM */
+  int         expr_id,     /*!< Expression ID of the output state expression of the FSM */
+  const char* from_state,  /*!< From state of the transition to find (or NULL) */
+  const char* to_state,    /*!< To state of the transition to find */
+  serve_rsp*  rsp          /*!< Pointer to the response to add to */
+) { PROFILE(SERVE_FSM_COVERAGE);
+
+  bool         found = FALSE;
+  char**       total_fr_states;
+  unsigned int total_fr_state_num;
+  char**       total_to_states;
+  unsigned int total_to_state_num;
+  char**       hit_fr_states;
+  unsigned int hit_fr_state_num;
+  char**       hit_to_states;
+  unsigned int hit_to_state_num;
+  char**       total_from_arcs;
+  char**       total_to_arcs;
+  int*         total_ids;
+  int*         excludes;
+  char**       reasons;
+  int          total_arc_num;
+  char**       hit_from_arcs;
+  char**       hit_to_arcs;
+  int          hit_arc_num;
+  char**       input_state;
+  unsigned int input_size;
+  char**       output_state;
+  unsigned int output_size;
+  unsigned int i = 0;
+
+  while( (i < funit->fsm_size) && (funit->fsms[i]->to_state->id != expr_id) ) i++;
+
+  if( i < funit->fsm_size ) {
+
+    int j;
+
+    fsm_get_coverage( funit, expr_id, &total_fr_states, &total_fr_state_num, &total_to_states, &total_to_state_num,
+                      &hit_fr_states, &hit_fr_state_num, &hit_to_states, &hit_to_state_num,
+                      &total_from_arcs, &total_to_arcs, &total_ids, &excludes, &reasons, &total_arc_num, &hit_from_arcs, &hit_to_arcs, &hit_arc_num,
+                      &input_state, &input_size, &output_state, &output_size );
+
+    found = (from_state == NULL);
+
+    if( from_state == NULL ) {
+      for( i=0; i<total_fr_state_num; i++ ) {
+        serve_appendf( rsp, "in_state %s", total_fr_states[i] );
+      }
+      for( i=0; i<total_to_state_num; i++ ) {
+        serve_appendf( rsp, "out_state %s", total_to_states[i] );
+      }
+      for( i=0; i<hit_fr_state_num; i++ ) {
+        serve_appendf( rsp, "hit_in_state %s", hit_fr_states[i] );
+      }
+      for( i=0; i<hit_to_state_num; i++ ) {
+        serve_appendf( rsp, "hit_out_state %s", hit_to_states[i] );
+      }
+      for( j=0; j<total_arc_num; j++ ) {
+        if( reasons[j] != NULL ) {
+          serve_appendf( rsp, "arc %s %s %d %s", total_from_arcs[j], total_to_arcs[j], excludes[j], reasons[j] );
+        } else {
+          serve_appendf( rsp, "arc %s %s %d", total_from_arcs[j], total_to_arcs[j], excludes[j] );
+        }
+      }
+      for( j=0; j<hit_arc_num; j++ ) {
+        serve_appendf( rsp, "hit_arc %s %s", hit_from_arcs[j], hit_to_arcs[j] );
+      }
+      if( input_size > 0 ) {
+        serve_appendf( rsp, "in_code %s", input_state[0] );
+      }
+      if( output_size > 0 ) {
+        serve_appendf( rsp, "out_code %s", output_state[0] );
+      }
+    } else {
+      for( j=0; (j<total_arc_num) && !found; j++ ) {
+        if( (strcmp( total_from_arcs[j], from_state ) == 0) && (strcmp( total_to_arcs[j], to_state ) == 0) ) {
+          if( reasons[j] != NULL ) {
+            serve_appendf( rsp, "%d %s", excludes[j], reasons[j] );
+          } else {
+            serve_appendf( rsp, "%d", excludes[j] );
+          }
+          found = TRUE;
+        }
+      }
+    }
+
+    /* Deallocate the coverage information */
+    for( i=0; i<total_fr_state_num; i++ ) {
+      free_safe( total_fr_states[i], (strlen( total_fr_states[i] ) + 1) );
+    }
+    free_safe( total_fr_states, (sizeof( char* ) * total_fr_state_num) );
+    for( i=0; i<total_to_state_num; i++ ) {
+      free_safe( total_to_states[i], (strlen( total_to_states[i] ) + 1) );
+    }
+    free_safe( total_to_states, (sizeof( char* ) * total_to_state_num) );
+    for( i=0; i<hit_fr_state_num; i++ ) {
+      free_safe( hit_fr_states[i], (strlen( hit_fr_states[i] ) + 1) );
+    }
+    free_safe( hit_fr_states, (sizeof( char* ) * hit_fr_state_num) );
+    for( i=0; i<hit_to_state_num; i++ ) {
+      free_safe( hit_to_states[i], (strlen( hit_to_states[i] ) + 1) );
+    }
+    free_safe( hit_to_states, (sizeof( char* ) * hit_to_state_num) );
+    for( j=0; j<total_arc_num; j++ ) {
+      free_safe( total_from_arcs[j], (strlen( total_from_arcs[j] ) + 1) );
+      free_safe( total_to_arcs[j], (strlen( total_to_arcs[j] ) + 1) );
+      free_safe( reasons[j], (strlen( reasons[j] ) + 1) );
+    }
+    free_safe( total_from_arcs, (sizeof( char* ) * total_arc_num) );
+    free_safe( total_to_arcs, (sizeof( char* ) * total_arc_num) );
+    free_safe( total_ids, (sizeof( int ) * total_arc_num) );
+    free_safe( excludes, (sizeof( int ) * total_arc_num) );
+    free_safe( reasons, (sizeof( char* ) * total_arc_num) );
+    for( j=0; j<hit_arc_num; j++ ) {
+      free_safe( hit_from_arcs[j], (strlen( hit_from_arcs[j] ) + 1) );
+      free_safe( hit_to_arcs[j], (strlen( hit_to_arcs[j] ) + 1) );
+    }
+    free_safe( hit_from_arcs, (sizeof( char* ) * hit_arc_num) );
+    free_safe( hit_to_arcs, (sizeof( char* ) * hit_arc_num) );
+    for( i=0; i<input_size; i++ ) {
+      free_safe( input_state[i], (strlen( input_state[i] ) + 1) );
+    }
+    free_safe( input_state, (sizeof( char* ) * input_size) );
+    for( i=0; i<output_size; i++ ) {
+      free_safe( output_state[i], (strlen( output_state[i] ) + 1) );
+    }
+    free_safe( output_state, (sizeof( char* ) * output_size) );
+
+  }
+
+  PROFILE_END;
+
+  return( found );
+
+}
+
+/*!
+ \return Returns NULL if the request was answered; otherwise, returns the error message of the failed request.
+
+ Adds the verbose coverage information of a single coverage point to the body of a response.  The coverage point
+ is specified by the given arguments in the same way as the GUI specifies them:  a signal name for toggle and memory
+ coverage, the expression ID of a statement (and, optionally, the underline ID of one of its subexpressions) for
+ combinational logic coverage, the expression ID of the output state expression for FSM coverage and the name of
+ an assertion instance for assertion coverage.
+*/
+static const char* serve_detail(
+  const char*  metric,  /*!< Name of metric to get the coverage point from */
+  func_unit*   funit,   /*!< Pointer to functional unit containing the coverage point */
+  char**       args,    /*!< Arguments specifying the coverage point */
+  unsigned int num,     /*!< Number of elements in the args array */
+  serve_rsp*   rsp      /*!< Pointer to the response to add to */
+) { PROFILE(SERVE_DETAIL);
+
+  const char* error = NULL;
+  vsignal*    sig;
+  statement*  stmt;
+  funit_inst* child;
+  int         id;
+  int         ulid;
+
+  if( (strcmp( metric, "toggle" ) == 0) && (num == 1) ) {
+
+    if( ((sig = serve_find_signal( funit, args[0] )) == NULL) || (sig->dim == NULL) ) {
+      error = "unknown signal";
+    } else {
+      int   msb, lsb, excluded;
+      char* tog01;
+      char* tog10;
+      char* reason;
+      toggle_get_coverage( funit, args[0], &msb, &lsb, &tog01, &tog10, &excluded, &reason );
+      if( reason != NULL ) {
+        serve_appendf( rsp, "%d %d %s %s %d %s", msb, lsb, tog01, tog10, excluded, reason );
+      } else {
+        serve_appendf( rsp, "%d %d %s %s %d", msb, lsb, tog01, tog10, excluded );
+      }
+      free_safe( tog01, (strlen( tog01 ) + 1) );
+      free_safe( tog10, (strlen( tog10 ) + 1) );
+      free_safe( reason, (strlen( reason ) + 1) );
+    }
+
+  } else if( (strcmp( metric, "memory" ) == 0) && (num == 1) ) {
+
+    if( ((sig = serve_find_signal( funit, args[0] )) == NULL) || (sig->suppl.part.type != SSUPPL_TYPE_MEM) || (sig->udim_num == 0) ) {
+      error = "unknown memory";
+    } else {
+      char* pdim_str;
+      char* pdim_array;
+      char* udim_str;
+      char* memory_info;
+      int   excluded;
+      char* reason;
+      memory_get_coverage( funit, args[0], &pdim_str, &pdim_array, &udim_str, &memory_info, &excluded, &reason );
+      serve_appendf( rsp, "udim %s", udim_str );
+      serve_appendf( rsp, "pdim %s", ((pdim_str != NULL) ? pdim_str : "") );
+      serve_appendf( rsp, "pdim_array %s", pdim_array );
+      serve_appendf( rsp, "info %s", memory_info );
+      if( reason != NULL ) {
+        serve_appendf( rsp, "excluded %d %s", excluded, reason );
+      } else {
+        serve_appendf( rsp, "excluded %d", excluded );
+      }
+      free_safe( pdim_str, (strlen( pdim_str ) + 1) );
+      free_safe( pdim_array, (strlen( pdim_array ) + 1) );
+      free_safe( udim_str, (strlen( udim_str ) + 1) );
+      free_safe( memory_info, (strlen( memory_info ) + 1) );
+      free_safe( reason, (strlen( reason ) + 1) );
+    }
+
+  } else if( (strcmp( metric, "comb" ) == 0) && (num == 1) ) {
+
+    if( !serve_parse_int( args[0], &id ) || ((stmt = serve_find_statement( funit, id )) == NULL) ) {
+      error = "unknown expression";
+    } else {
+      char**       code;
+      int*         uline_groups;
+      unsigned int code_size;
+      char**       ulines;
+      unsigned int uline_size;
+      int*         excludes;
+      char**       reasons;
+      unsigned int exclude_size;
+      unsigned int i;
+      Try {
+        combination_get_expression( id, &code, &uline_groups, &code_size, &ulines, &uline_size, &excludes, &reasons, &exclude_size );
+      } Catch_anonymous {
+        error = "unable to generate expression";
+      }
+      if( error == NULL ) {
+        for( i=0; i<code_size; i++ ) {
+          serve_appendf( rsp, "code %d %s", uline_groups[i], code[i] );
+          free_safe( code[i], (strlen( code[i] ) + 1) );
+        }
+        for( i=0; i<uline_size; i++ ) {
+          serve_appendf( rsp, "uline %s", ulines[i] );
+          free_safe( ulines[i], (strlen( ulines[i] ) + 1) );
+        }
+        for( i=1; i<exclude_size; i++ ) {
+          if( reasons[i] != NULL ) {
+            serve_appendf( rsp, "excluded %u %d %s", i, excludes[i], reasons[i] );
+            free_safe( reasons[i], (strlen( reasons[i] ) + 1) );
+          } else {
+            serve_appendf( rsp, "excluded %u %d", i, excludes[i] );
+          }
+        }
+        if( code_size > 0 ) {
+          free_safe( code, (sizeof( char* ) * code_size) );
+          free_safe( uline_groups, (sizeof( int ) * code_size) );
+        }
+        if( uline_size > 0 ) {
+          free_safe( ulines, (sizeof( char* ) * uline_size) );
+        }
+        if( exclude_size > 0 ) {
+          free_safe( excludes, (sizeof( int ) * exclude_size) );
+          free_safe( reasons, (sizeof( char* ) * exclude_size) );
+        }
+      }
+    }
+
+  } else if( (strcmp( metric, "comb" ) == 0) && (num == 2) ) {
+
+    if( !serve_parse_int( args[0], &id ) || !serve_parse_int( args[1], &ulid ) ||
+        ((stmt = serve_find_statement( funit, id )) == NULL) || (expression_find_uline_id( stmt->exp, ulid ) == NULL) ) {
+      error = "unknown expression";
+    } else {
+      char** info;
+      int    info_size;
+      int    i;
+      combination_get_coverage( id, ulid, &info, &info_size );
+      for( i=0; i<info_size; i++ ) {
+        serve_appendf( rsp, "%s", info[i] );
+        free_safe( info[i], (strlen( info[i] ) + 1) );
+      }
+      if( info_size > 0 ) {
+        free_safe( info, (sizeof( char* ) * info_size) );
+      }
+    }
+
+  } else if( (strcmp( metric, "fsm" ) == 0) && (num == 1) ) {
+
+    if( !serve_parse_int( args[0], &id ) || !serve_fsm_coverage( funit, id, NULL, NULL, rsp ) ) {
+      error = "unknown FSM";
+    }
+
+  } else if( (strcmp( metric, "assert" ) == 0) && (num == 1) ) {
+
+    if( (child = serve_find_assertion( funit, args[0] )) == NULL ) {
+      error = "unknown assertion instance";
+    } else {
+      char*     assert_mod;
+      str_link* cp_head;
+      str_link* cp_tail;
+      str_link* curr_cp;
+      assertion_get_coverage( funit, args[0], &assert_mod, &cp_head, &cp_tail );
+      serve_appendf( rsp, "module %s", assert_mod );
+      free_safe( assert_mod, (strlen( assert_mod ) + 1) );
+      curr_cp = cp_head;
+      while( curr_cp != NULL ) {
+        serve_appendf( rsp, "point %d %d %d {%s} {%s}", curr_cp->suppl, curr_cp->suppl2, curr_cp->suppl3, curr_cp->str,
+                       ((curr_cp->str2 != NULL) ? curr_cp->str2 : "") );
+        curr_cp = curr_cp->next;
+      }
+      str_link_delete_list( cp_head );
+    }
+
+  } else {
+
+    error = "unknown metric or wrong number of arguments";
+
+  }
+
+  PROFILE_END;
+
+  return( error );
+
+}
+
+/*!
+ Adds the exclusion value of a coverage point followed by its exclusion reason (if it has one) to the body of
+ a response.
+*/
+static void serve_append_exclusion(
+  serve_rsp* rsp,       /*!< Pointer to the response to add to */
+  int        excluded,  /*!< Exclusion value of the coverage point */
+  char       type,      /*!< Exclusion type of the coverage point */
+  int        id,        /*!< Exclusion ID of the coverage point */
+  func_unit* funit      /*!< Pointer to functional unit containing the exclusion reason */
+) { PROFILE(SERVE_APPEND_EXCLUSION);
+
+  exclude_reason* er;
+
+  if( (excluded == 1) && ((er = exclude_find_exclude_reason( type, id, funit )) != NULL) ) {
+    serve_appendf( rsp, "%d %s", excluded, er->reason );
+  } else {
+    serve_appendf( rsp, "%d", excluded );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns NULL if the request was answered; otherwise, returns the error message of the failed request.
+
+ Adds the exclusion value and exclusion reason of a single coverage point to the body of a response.  The coverage
+ point is specified by the given arguments in the same way as the GUI specifies them when changing its exclusion:
+ a line number for line coverage, a signal name for toggle and memory coverage, the expression ID of a statement
+ and the underline ID of one of its subexpressions for combinational logic coverage, the expression ID of the
+ output state expression followed by the from and to states of a state transition for FSM coverage and the name
+ of an assertion instance followed by the expression ID of one of its coverage points for assertion coverage.
+*/
+static const char* serve_excluded(
+  const char*  metric,  /*!< Name of metric to get the coverage point from */
+  func_unit*   funit,   /*!< Pointer to functional unit containing the coverage point */
+  char**       args,    /*!< Arguments specifying the coverage point */
+  unsigned int num,     /*!< Number of elements in the args array */
+  serve_rsp*   rsp      /*!< Pointer to the response to add to */
+) { PROFILE(SERVE_EXCLUDED);
+
+  const char* error = NULL;
+  vsignal*    sig;
+  statement*  stmt = NULL;
+  expression* exp;
+  funit_inst* child;
+  int         id;
+  int         ulid;
+
+  if( (strcmp( metric, "line" ) == 0) && (num == 1) ) {
+
+    if( serve_parse_int( args[0], &id ) ) {
+      func_iter fi;
+      func_iter_init( &fi, funit, TRUE, FALSE, FALSE );
+      while( ((stmt = func_iter_get_next_statement( &fi )) != NULL) && (stmt->exp->line != id) );
+      func_iter_dealloc( &fi );
+    }
+    if( stmt == NULL ) {
+      error = "unknown line";
+    } else {
+      serve_append_exclusion( rsp, stmt->suppl.part.excluded, 'L', stmt->exp->id, funit );
+    }
+
+  } else if( ((strcmp( metric, "toggle" ) == 0) || (strcmp( metric, "memory" ) == 0)) && (num == 1) ) {
+
+    if( ((sig = serve_find_signal( funit, args[0] )) == NULL) || ((metric[0] == 'm') && (sig->suppl.part.type != SSUPPL_TYPE_MEM)) ) {
+      error = "unknown signal";
+    } else {
+      serve_append_exclusion( rsp, sig->suppl.part.excluded, ((metric[0] == 't') ? 'T' : 'M'), sig->id, funit );
+    }
+
+  } else if( (strcmp( metric, "comb" ) == 0) && (num == 2) ) {
+
+    if( !serve_parse_int( args[0], &id ) || !serve_parse_int( args[1], &ulid ) ||
+        ((stmt = serve_find_statement( funit, id )) == NULL) || ((exp = expression_find_uline_id( stmt->exp, ulid )) == NULL) ) {
+      error = "unknown expression";
+    } else {
+      serve_append_exclusion( rsp, ESUPPL_EXCLUDED( exp->suppl ), 'E', exp->id, funit_get_curr_module( funit ) );
+    }
+
+  } else if( (strcmp( metric, "fsm" ) == 0) && (num == 3) ) {
+
+    if( !serve_parse_int( args[0], &id ) || !serve_fsm_coverage( funit, id, args[1], args[2], rsp ) ) {
+      error = "unknown state transition";
+    }
+
+  } else if( (strcmp( metric, "assert" ) == 0) && (num == 2) ) {
+
+    if( ((child = serve_find_assertion( funit, args[0] )) == NULL) || !serve_parse_int( args[1], &id ) ||
+        ((stmt = serve_find_statement( child->funit, id )) == NULL) ) {
+      error = "unknown assertion coverage point";
+    } else {
+      serve_append_exclusion( rsp, ESUPPL_EXCLUDED( stmt->exp->suppl ), 'A', stmt->exp->id, child->funit );
+    }
+
+  } else {
+
+    error = "unknown metric or wrong number of arguments";
+
+  }
+
+  PROFILE_END;
+
+  return( error );
+
+}
+
+/*!
+ Deallocates the given response.
+*/
+static void serve_rsp_dealloc(
+  serve_rsp* rsp  /*!< Pointer to response to deallocate */
+) { PROFILE(SERVE_RSP_DEALLOC);
+
+  str_link_delete_list( rsp->head );
+  free_safe( rsp, sizeof( serve_rsp ) );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to the response for the given request.  If *cached is set to TRUE, the response
+         is owned by the response cache; otherwise, it must be deallocated by the caller.
+
+ Parses and answers a single request line.  Successful query responses are stored in the response cache so
+ that the same request can later be answered without being recalculated.
+*/
+static serve_rsp* serve_process_request(
+            const char* req,           /*!< Request line (without newline) */
+  /*@out@*/ bool*       cached,        /*!< Set to TRUE if the returned response is owned by the response cache */
+  /*@out@*/ bool*       close_client   /*!< Set to TRUE if the client connection should be closed */
+) { PROFILE(SERVE_PROCESS_REQUEST);
+
+  char         line[SERVE_MAX_REQUEST];
+  char         key[SERVE_MAX_REQUEST];
+  char*        args[SERVE_MAX_ARGS];
+  unsigned int num   = 0;
+  char*        ptr;
+  const char*  cmd;
+  serve_rsp*   rsp;
+  bool         cache = FALSE;
+  tnode*       node;
+
+  *cached       = FALSE;
+  *close_client = FALSE;
+  serve_requests++;
+
+  /*
+   Split the request into its command and arguments.  The arguments are rejoined with single spaces to form the
+   key of the request in the response cache.
+  */
+  snprintf( line, SERVE_MAX_REQUEST, "%s", req );
+  key[0] = '\0';
+  ptr    = line + strspn( line, " \t" );
+  while( *ptr != '\0' ) {
+    unsigned int len = strcspn( ptr, " \t" );
+    if( num < SERVE_MAX_ARGS ) {
+      args[num] = ptr;
+    }
+    num++;
+    if( key[0] != '\0' ) {
+      strcat( key, " " );
+    }
+    strncat( key, ptr, len );
+    ptr += len;
+    if( *ptr != '\0' ) {
+      *ptr = '\0';
+      ptr++;
+      ptr += strspn( ptr, " \t" );
+    }
+  }
+  cmd = (num > 0) ? args[0] : "";
+
+  /* If we have already answered this request, return the same response */
+  if( (num > 0) && (num <= SERVE_MAX_ARGS) && ((node = tree_find( key, serve_cache )) != NULL) ) {
+
+    serve_cache_hits++;
+    *cached = TRUE;
+    PROFILE_END;
+    return( serve_cached[atoi( node->value )] );
+
+  }
+
+  rsp        = (serve_rsp*)malloc_safe( sizeof( serve_rsp ) );
+  rsp->error = NULL;
+  rsp->head  = NULL;
+  rsp->tail  = NULL;
+  rsp->num   = 0;
+
+  if( num == 0 ) {
+
+    rsp->error = "empty request";
+
+  } else if( num > SERVE_MAX_ARGS ) {
+
+    rsp->error = "too many arguments";
+
+  } else if( (strcmp( cmd, "quit" ) == 0) && (num == 1) ) {
+
+    *close_client = TRUE;
+
+  } else if( (strcmp( cmd, "shutdown" ) == 0) && (num == 1) ) {
+
+    serve_done    = 1;
+    *close_client = TRUE;
+
+  } else if( (strcmp( cmd, "stats" ) == 0) && (num == 1) ) {
+
+    serve_appendf( rsp, "requests %u", serve_requests );
+    serve_appendf( rsp, "cache_hits %u", serve_cache_hits );
+
+  } else if( (strcmp( cmd, "funits" ) == 0) && (num == 1) ) {
+
+    funit_link* funitl = db_list[1]->funit_head;
+    while( funitl != NULL ) {
+      if( !funit_is_unnamed( funitl->funit ) &&
+          ((info_suppl.part.assert_ovl == 0) || !ovl_is_assertion_module( funit_get_curr_module_safe( funitl->funit ) )) ) {
+        serve_appendf( rsp, "%s %s %s", funitl->funit->name, get_funit_type( funitl->funit->suppl.part.type ), funitl->funit->orig_fname );
+      }
+      funitl = funitl->next;
+    }
+    cache = TRUE;
+
+  } else if( (strcmp( cmd, "instances" ) == 0) && (num == 1) ) {
+
+    inst_link* instl = db_list[0]->inst_head;
+    while( instl != NULL ) {
+      serve_list_instances( instl->inst, rsp );
+      instl = instl->next;
+    }
+    cache = TRUE;
+
+  } else if( ((strcmp( cmd, "summary" ) == 0) || (strcmp( cmd, "uncovered" ) == 0) || (strcmp( cmd, "covered" ) == 0)) && (num == 4) ) {
+
+    funit_inst* inst;
+    func_unit*  funit;
+
+    if( (funit = serve_find_funit( args[2], args[3], &inst )) == NULL ) {
+      rsp->error = "unknown module or instance";
+    } else if( cmd[0] == 's' ) {
+      if( (inst != NULL) && (strcmp( args[1], "assert" ) == 0) ) {
+        rsp->error = "assert summaries are only available for modules";
+      } else if( !serve_summary( args[1], funit, inst, rsp ) ) {
+        rsp->error = "unknown metric";
+      }
+    } else if( !serve_collect( args[1], ((cmd[0] == 'c') ? 1 : 0), funit, rsp ) ) {
+      rsp->error = "unknown metric";
+    }
+    curr_db = 0;
+    cache   = (rsp->error == NULL);
+
+  } else if( ((strcmp( cmd, "detail" ) == 0) || (strcmp( cmd, "excluded" ) == 0)) && (num > 4) ) {
+
+    funit_inst* inst;
+    func_unit*  funit;
+
+    if( (funit = serve_find_funit( args[2], args[3], &inst )) == NULL ) {
+      rsp->error = "unknown module or instance";
+    } else if( cmd[0] == 'd' ) {
+      rsp->error = serve_detail( args[1], funit, (args + 4), (num - 4), rsp );
+    } else {
+      rsp->error = serve_excluded( args[1], funit, (args + 4), (num - 4), rsp );
+    }
+    curr_db = 0;
+    cache   = (rsp->error == NULL);
+
+  } else {
+
+    rsp->error = "unknown request or wrong number of arguments";
+
+  }
+
+  /* Store the response in the response cache */
+  if( cache ) {
+    char index[30];
+    snprintf( index, 30, "%u", serve_cached_num );
+    (void)tree_add( key, index, FALSE, &serve_cache );
+    serve_cached = (serve_rsp**)realloc_safe( serve_cached, (sizeof( serve_rsp* ) * serve_cached_num), (sizeof( serve_rsp* ) * (serve_cached_num + 1)) );
+    serve_cached[serve_cached_num] = rsp;
+    serve_cached_num++;
+    *cached = TRUE;
+  }
+
+  PROFILE_END;
+
+  return( rsp );
+
+}
+
+/*!
+ Adds the given characters to the output queued on the given client.
+*/
+static void serve_queue(
+  serve_client* client,  /*!< Pointer to client to queue output on */
+  const char*   str,     /*!< Characters to queue */
+  unsigned int  len      /*!< Number of characters to queue */
+) { PROFILE(SERVE_QUEUE);
+
+  client->out = (char*)realloc_safe( client->out, client->out_size, (client->out_size + len) );
+  memcpy( (client->out + client->out_size), str, len );
+  client->out_size += len;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if the client connection is still usable; otherwise, returns FALSE.
+
+ Writes as much of the output queued on the given client as the client is ready to accept without blocking.
+*/
+static bool serve_write(
+  serve_client* client  /*!< Pointer to client to write queued output to */
+) { PROFILE(SERVE_WRITE);
+
+  bool ok = TRUE;
+
+  while( ok && (client->out_sent < client->out_size) ) {
+    ssize_t n = write( client->fd, (client->out + client->out_sent), (client->out_size - client->out_sent) );
+    if( n > 0 ) {
+      client->out_sent += n;
+    } else if( (n < 0) && (errno == EINTR) ) {
+      continue;
+    } else if( (n < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)) ) {
+      break;
+    } else {
+      ok = FALSE;
+    }
+  }
+
+  /* Release the queue once all of it has been written */
+  if( client->out_sent == client->out_size ) {
+    free_safe( client->out, client->out_size );
+    client->out      = NULL;
+    client->out_size = 0;
+    client->out_sent = 0;
+  }
+
+  PROFILE_END;
+
+  return( ok );
+
+}
+
+/*!
+ Queues the given response on the given client.
+*/
+static void serve_write_rsp(
+  serve_client*    client,  /*!< Pointer to client to queue the response on */
+  const serve_rsp* rsp      /*!< Pointer to response to write */
+) { PROFILE(SERVE_WRITE_RSP);
+
+  char         header[4096];
+  unsigned int used;
+  str_link*    strl;
+
+  if( rsp->error != NULL ) {
+    used = snprintf( header, 4096, "ERROR %s\n", rsp->error );
+  } else {
+    used = snprintf( header, 4096, "OK %u\n", rsp->num );
+  }
+  assert( used < 4096 );
+
+  serve_queue( client, header, used );
+
+  /* Grow the queue once for all of the result lines */
+  used = 0;
+  strl = rsp->head;
+  while( strl != NULL ) {
+    used += strlen( strl->str ) + 1;
+    strl = strl->next;
+  }
+  client->out = (char*)realloc_safe( client->out, client->out_size, (client->out_size + used) );
+
+  strl = rsp->head;
+  while( strl != NULL ) {
+    unsigned int len = strlen( strl->str );
+    memcpy( (client->out + client->out_size), strl->str, len );
+    client->out[client->out_size + len] = '\n';
+    client->out_size += len + 1;
+    strl = strl->next;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if the client connection should remain open; otherwise, returns FALSE.
+
+ Reads any available characters from the given client and queues the answer to each complete request line.
+*/
+static bool serve_handle_client(
+  serve_client* client  /*!< Pointer to client that has characters ready to read */
+) { PROFILE(SERVE_HANDLE_CLIENT);
+
+  char    tmp[4096];
+  ssize_t n;
+  bool    keep = TRUE;
+
+  if( (n = read( client->fd, tmp, 4096 )) <= 0 ) {
+
+    keep = ((n < 0) && ((errno == EINTR) || (errno == EAGAIN) || (errno == EWOULDBLOCK)));
+
+  } else {
+
+    char*        start;
+    char*        nl;
+    unsigned int used;
+
+    client->buf = (char*)realloc_safe( client->buf, ((client->buf_size > 0) ? (client->buf_size + 1) : 0), (client->buf_size + n + 1) );
+    memcpy( (client->buf + client->buf_size), tmp, n );
+    client->buf_size += n;
+    client->buf[client->buf_size] = '\0';
+
+    /* Answer each complete request line */
+    start = client->buf;
+    while( !client->closing && !serve_done && ((nl = strchr( start, '\n' )) != NULL) ) {
+      bool       cached;
+      bool       close_client;
+      serve_rsp* rsp;
+      *nl = '\0';
+      if( (nl > start) && (*(nl - 1) == '\r') ) {
+        *(nl - 1) = '\0';
+      }
+      rsp = serve_process_request( start, &cached, &close_client );
+      serve_write_rsp( client, rsp );
+      client->closing = close_client;
+      if( !cached ) {
+        serve_rsp_dealloc( rsp );
+      }
+      start = nl + 1;
+    }
+
+    /* Keep any partial request for the next read */
+    used = (start - client->buf);
+    if( used > 0 ) {
+      if( used == client->buf_size ) {
+        free_safe( client->buf, (client->buf_size + 1) );
+        client->buf      = NULL;
+        client->buf_size = 0;
+      } else {
+        char* rest = strdup_safe( start );
+        free_safe( client->buf, (client->buf_size + 1) );
+        client->buf      = rest;
+        client->buf_size = strlen( rest );
+      }
+    }
+
+    /* Refuse requests that are too long to be valid */
+    if( !client->closing && (client->buf_size >= SERVE_MAX_REQUEST) ) {
+      serve_queue( client, "ERROR request too long\n", 23 );
+      client->closing = TRUE;
+    }
+
+    /* Write as much of the answers as the client will take now */
+    keep = serve_write( client ) && (!client->closing || (client->out_size > 0));
+
+  }
+
+  PROFILE_END;
+
+  return( keep );
+
+}
+
+/*!
+ Closes the connection of the given client and deallocates its buffers.
+*/
+static void serve_close_client(
+  serve_client* client  /*!< Pointer to client to close */
+) { PROFILE(SERVE_CLOSE_CLIENT);
+
+  close( client->fd );
+  free_safe( client->buf, ((client->buf != NULL) ? (client->buf_size + 1) : 0) );
+  free_safe( client->out, client->out_size );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous Throw Throw Throw
+
+ Creates the Unix domain socket, accepts client connections and answers their requests until the server is
+ asked to shut down.
+*/
+static void serve_run() { PROFILE(SERVE_RUN);
+
+  struct sockaddr_un addr;
+  int                sock;
+  serve_client*      clients    = NULL;
+  unsigned int       client_num = 0;
+  unsigned int       i;
+  unsigned int       rv;
+
+  if( strlen( serve_socket ) >= sizeof( addr.sun_path ) ) {
+    rv = snprintf( user_msg, USER_MSG_LENGTH, "Socket name \"%s\" is too long", serve_socket );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  memset( &addr, 0, sizeof( addr ) );
+  addr.sun_family = AF_UNIX;
+  strcpy( addr.sun_path, serve_socket );
+
+  if( (sock = socket( AF_UNIX, SOCK_STREAM, 0 )) < 0 ) {
+    print_output( "Unable to create socket for the server", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  /* If the socket file already exists, only remove it if no server is listening on it */
+  if( access( serve_socket, F_OK ) == 0 ) {
+    if( connect( sock, (struct sockaddr*)&addr, sizeof( addr ) ) == 0 ) {
+      close( sock );
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "A server is already listening on socket \"%s\"", serve_socket );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+    (void)unlink( serve_socket );
+    close( sock );
+    if( (sock = socket( AF_UNIX, SOCK_STREAM, 0 )) < 0 ) {
+      print_output( "Unable to create socket for the server", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+  }
+
+  if( (bind( sock, (struct sockaddr*)&addr, sizeof( addr ) ) != 0) || (listen( sock, 16 ) != 0) ) {
+    close( sock );
+    rv = snprintf( user_msg, USER_MSG_LENGTH, "Unable to listen on socket \"%s\"", serve_socket );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  rv = snprintf( user_msg, USER_MSG_LENGTH, "Serving CDD file \"%s\" on socket \"%s\"", serve_cdd, serve_socket );
+  assert( rv < USER_MSG_LENGTH );
+  print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
+  while( !serve_done ) {
+
+    fd_set fds;
+    fd_set wfds;
+    int    max_fd = sock;
+
+    /* Only read new requests from clients that have taken all of their previous answers */
+    FD_ZERO( &fds );
+    FD_ZERO( &wfds );
+    FD_SET( sock, &fds );
+    for( i=0; i<client_num; i++ ) {
+      if( clients[i].out_size > 0 ) {
+        FD_SET( clients[i].fd, &wfds );
+      } else {
+        FD_SET( clients[i].fd, &fds );
+      }
+      if( clients[i].fd > max_fd ) {
+        max_fd = clients[i].fd;
+      }
+    }
+
+    if( select( (max_fd + 1), &fds, &wfds, NULL, NULL ) < 0 ) {
+      if( errno == EINTR ) {
+        continue;
+      }
+      print_output( "Unable to wait for client requests", FATAL, __FILE__, __LINE__ );
+      break;
+    }
+
+    /*
+     Write queued output to and answer any requests from the connected clients, dropping clients that have
+     disconnected or were closed once their output was written
+    */
+    i = 0;
+    while( i < client_num ) {
+      bool keep = TRUE;
+      if( FD_ISSET( clients[i].fd, &wfds ) ) {
+        keep = serve_write( &clients[i] ) && (!clients[i].closing || (clients[i].out_size > 0));
+      } else if( FD_ISSET( clients[i].fd, &fds ) ) {
+        keep = serve_handle_client( &clients[i] );
+      }
+      if( !keep ) {
+        serve_close_client( &clients[i] );
+        clients[i] = clients[client_num - 1];
+        clients    = (serve_client*)realloc_safe( clients, (sizeof( serve_client ) * client_num), (sizeof( serve_client ) * (client_num - 1)) );
+        client_num--;
+      } else {
+        i++;
+      }
+    }
+
+    /* Accept any new client */
+    if( FD_ISSET( sock, &fds ) && !serve_done ) {
+      int fd;
+      if( (fd = accept( sock, NULL, NULL )) >= 0 ) {
+        if( fcntl( fd, F_SETFL, (fcntl( fd, F_GETFL, 0 ) | O_NONBLOCK) ) < 0 ) {
+          close( fd );
+        } else {
+          clients = (serve_client*)realloc_safe( clients, (sizeof( serve_client ) * client_num), (sizeof( serve_client ) * (client_num + 1)) );
+          clients[client_num].fd       = fd;
+          clients[client_num].buf      = NULL;
+          clients[client_num].buf_size = 0;
+          clients[client_num].out      = NULL;
+          clients[client_num].out_size = 0;
+          clients[client_num].out_sent = 0;
+          clients[client_num].closing  = FALSE;
+          client_num++;
+        }
+      }
+    }
+
+  }
+
+  /* Write what the remaining clients will take without blocking, disconnect them and remove the socket */
+  for( i=0; i<client_num; i++ ) {
+    (void)serve_write( &clients[i] );
+    serve_close_client( &clients[i] );
+  }
+  free_safe( clients, (sizeof( serve_client ) * client_num) );
+
+  close( sock );
+  (void)unlink( serve_socket );
+
+  rv = snprintf( user_msg, USER_MSG_LENGTH, "Answered %u requests (%u from the response cache)", serve_requests, serve_cache_hits );
+  assert( rv < USER_MSG_LENGTH );
+  print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous Throw
+
+ Performs serve command functionality.
+*/
+void command_serve(
+  int          argc,      /*!< Number of arguments in command-line to parse */
+  int          last_arg,  /*!< Index of last parsed argument from list */
+  const char** argv       /*!< List of arguments from command-line to parse */
+) { PROFILE(COMMAND_SERVE);
+
+  unsigned int rv;
+  unsigned int i;
+  bool         error = FALSE;
+
+  /* Output header information */
+  rv = snprintf( user_msg, USER_MSG_LENGTH, COVERED_HEADER );
+  assert( rv < USER_MSG_LENGTH );
+  print_output( user_msg, HEADER, __FILE__, __LINE__ );
+
+  Try {
+
+    /* Parse serve command-line */
+    if( !serve_parse_args( argc, last_arg, argv ) ) {
+
+      void (*old_int)( int );
+      void (*old_term)( int );
+      void (*old_pipe)( int );
+
+      if( serve_socket == NULL ) {
+        serve_socket = strdup_safe( "covered.sock" );
+      }
+
+      /*
+       Calculate the statistics of all metrics, as any of them may be queried, with the verbose combinational logic
+       depth used by the GUI so that the subexpressions of each expression can be queried
+      */
+      report_line        = TRUE;
+      report_toggle      = TRUE;
+      report_memory      = TRUE;
+      report_combination = TRUE;
+      report_fsm         = TRUE;
+      report_assertion   = TRUE;
+      report_comb_depth  = REPORT_VERBOSE;
+
+      /* Read in database */
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "Reading CDD file \"%s\"", serve_cdd );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
+      report_read_cdd_and_ready( serve_cdd );
+
+      /* Stop cleanly on an interrupt and ignore clients that disconnect in the middle of a response */
+      old_int  = signal( SIGINT,  serve_handle_signal );
+      old_term = signal( SIGTERM, serve_handle_signal );
+      old_pipe = signal( SIGPIPE, SIG_IGN );
+
+      Try {
+        serve_run();
+      } Catch_anonymous {
+        error = TRUE;
+      }
+
+      (void)signal( SIGINT,  old_int );
+      (void)signal( SIGTERM, old_term );
+      (void)signal( SIGPIPE, old_pipe );
+
+    }
+
+  } Catch_anonymous {
+    error = TRUE;
+  }
+
+  /* Close down the database */
+  db_close();
+
+  /* Deallocate other allocated variables */
+  tree_dealloc( serve_cache );
+  for( i=0; i<serve_cached_num; i++ ) {
+    serve_rsp_dealloc( serve_cached[i] );
+  }
+  free_safe( serve_cached, (sizeof( serve_rsp* ) * serve_cached_num) );
+  free_safe( serve_cdd, ((serve_cdd != NULL) ? (strlen( serve_cdd ) + 1) : 0) );
+  free_safe( serve_socket, ((serve_socket != NULL) ? (strlen( serve_socket ) + 1) : 0) );
+
+  if( error ) {
+    Throw 0;
+  }
+
+  PROFILE_END;
+
+}
@@ -320,13 +320,16 @@ void statement_size_elements(
  associated expression trees to the specified output stream.
 */
 void statement_db_write(
-  statement* stmt,       /*!< Pointer to statement to write out value */
-  FILE*      ofile,      /*!< Pointer to output file to write statement line to */
-  bool       ids_issued  /*!< Specifies that IDs were issued just prior to calling this function */
+  statement* stmt,        /*!< Pointer to statement to write out value */
+  FILE*      ofile,       /*!< Pointer to output file to write statement line to */
+  bool       ids_issued,  /*!< Specifies that IDs were issued just prior to calling this function */
+  uint64*    fingerprint  /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(STATEMENT_DB_WRITE);
 
   assert( stmt != NULL );
 
+  *fingerprint = util_hash64_uint32( *fingerprint, DB_TYPE_STATEMENT );
+
   /* Write out contents of this statement last */
   fprintf( ofile, "%d %d %x %d %d %d",
     DB_TYPE_STATEMENT,
@@ -348,26 +351,27 @@ void statement_db_write(
  Traverses specified statement tree, outputting all statements within that tree.
 */
 void statement_db_write_tree(
-  statement* stmt,  /*!< Pointer to root of statement tree to output */
-  FILE*      ofile  /*!< Pointer to output file to write statements to */
+  statement* stmt,        /*!< Pointer to root of statement tree to output */
+  FILE*      ofile,       /*!< Pointer to output file to write statements to */
+  uint64*    fingerprint  /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(STATEMENT_DB_WRITE_TREE);
 
   if( stmt != NULL ) {
 
     /* Traverse down the rest of the statement block */
     if( (stmt->next_true == stmt->next_false) && (stmt->suppl.part.stop_true == 0) ) {
-      statement_db_write_tree( stmt->next_true, ofile );
+      statement_db_write_tree( stmt->next_true, ofile, fingerprint );
     } else {
       if( stmt->suppl.part.stop_false == 0 ) {
-        statement_db_write_tree( stmt->next_false, ofile );
+        statement_db_write_tree( stmt->next_false, ofile, fingerprint );
       }
       if( stmt->suppl.part.stop_true == 0 ) {
-        statement_db_write_tree( stmt->next_true, ofile );
+        statement_db_write_tree( stmt->next_true, ofile, fingerprint );
       }
     }
 
     /* Output ourselves first */
-    statement_db_write( stmt, ofile, TRUE );
+    statement_db_write( stmt, ofile, TRUE, fingerprint );
 
   }
 
@@ -379,24 +383,25 @@ void statement_db_write_tree(
  Traverses the specified statement block, writing all expression trees to specified output file.
 */
 void statement_db_write_expr_tree(
-  statement* stmt,  /*!< Pointer to specified statement tree to display */
-  FILE*      ofile  /*!< Pointer to output file to write */
+  statement* stmt,        /*!< Pointer to specified statement tree to display */
+  FILE*      ofile,       /*!< Pointer to output file to write */
+  uint64*    fingerprint  /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(STATEMENT_DB_WRITE_EXPR_TREE);
 
   if( stmt != NULL ) {
 
     /* Output ourselves first */
-    expression_db_write_tree( stmt->exp, ofile );
+    expression_db_write_tree( stmt->exp, ofile, fingerprint );
 
     /* Traverse down the rest of the statement block */
     if( (stmt->next_true == stmt->next_false) && (stmt->suppl.part.stop_true == 0) ) {
-      statement_db_write_expr_tree( stmt->next_true, ofile );
+      statement_db_write_expr_tree( stmt->next_true, ofile, fingerprint );
     } else {
       if( stmt->suppl.part.stop_false == 0 ) {
-        statement_db_write_expr_tree( stmt->next_false, ofile );
+        statement_db_write_expr_tree( stmt->next_false, ofile, fingerprint );
       }
       if( stmt->suppl.part.stop_true == 0 ) {
-        statement_db_write_expr_tree( stmt->next_true, ofile );
+        statement_db_write_expr_tree( stmt->next_true, ofile, fingerprint );
       }
     }
 
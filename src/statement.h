@@ -42,19 +42,22 @@ void statement_size_elements(
 void statement_db_write(
   statement* stmt,
   FILE*      ofile,
-  bool       ids_issued
+  bool       ids_issued,
+  uint64*    fingerprint
 );
 
 /*! \brief Writes specified statement tree to the specified output file. */
 void statement_db_write_tree(
   statement* stmt,
-  FILE*      ofile
+  FILE*      ofile,
+  uint64*    fingerprint
 );
 
 /*! \brief Writes specified expression trees for given statement block to specified output file. */
 void statement_db_write_expr_tree(
   statement* stmt,
-  FILE*      ofile
+  FILE*      ofile,
+  uint64*    fingerprint
 );
 
 /*! \brief Reads in statement line from specified string and stores statement in specified functional unit. */
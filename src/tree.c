@@ -17,6 +17,11 @@
  \file     tree.c
  \author   Trevor Williams  (phase1geo@gmail.com)
  \date     1/4/2003
+
+ \par
+ The trees created by these functions are binary search trees sorted by key that are kept height-balanced
+ (AVL trees) so that adding, finding and removing a key takes logarithmic time, even when keys are added in
+ sorted order (such as generated define or module names).
 */
 
 #ifdef HAVE_CONFIG_H
@@ -35,11 +40,156 @@
 #include "util.h"
 
 
+/*!
+ \return Returns the height of the subtree rooted at the given node (0 if node is NULL).
+*/
+static int tree_height(
+  /*@null@*/ tnode* node  /*!< Pointer to node to get height of */
+) {
+
+  return( (node == NULL) ? 0 : node->height );
+
+}
+
+/*!
+ Recalculates the height of the given node from the heights of its children.
+*/
+static void tree_update_height(
+  tnode* node  /*!< Pointer to node to update */
+) {
+
+  int lheight = tree_height( node->left );
+  int rheight = tree_height( node->right );
+
+  node->height = ((lheight > rheight) ? lheight : rheight) + 1;
+
+}
+
+/*!
+ Replaces the child pointer that points to old_node in the given parent node (or the root pointer if the parent is
+ NULL) with new_node.
+*/
+static void tree_replace_child(
+  tnode**            root,      /*!< Pointer to root of tree */
+  /*@null@*/ tnode*  parent,    /*!< Pointer to parent of old_node */
+  tnode*             old_node,  /*!< Pointer to child node being replaced */
+  /*@null@*/ tnode*  new_node   /*!< Pointer to node to replace old_node with */
+) {
+
+  if( parent == NULL ) {
+    *root = new_node;
+  } else if( parent->left == old_node ) {
+    parent->left = new_node;
+  } else {
+    assert( parent->right == old_node );
+    parent->right = new_node;
+  }
+
+  if( new_node != NULL ) {
+    new_node->up = parent;
+  }
+
+}
+
+/*!
+ \return Returns a pointer to the node that takes the place of the given node in the tree.
+
+ Rotates the subtree rooted at the given node to the left (its right child becomes the root of the subtree).
+*/
+static tnode* tree_rotate_left(
+  tnode** root,  /*!< Pointer to root of tree */
+  tnode*  node   /*!< Pointer to root of subtree to rotate */
+) {
+
+  tnode* pivot = node->right;
+
+  tree_replace_child( root, node->up, node, pivot );
+
+  node->right = pivot->left;
+  if( node->right != NULL ) {
+    node->right->up = node;
+  }
+
+  pivot->left = node;
+  node->up    = pivot;
+
+  tree_update_height( node );
+  tree_update_height( pivot );
+
+  return( pivot );
+
+}
+
+/*!
+ \return Returns a pointer to the node that takes the place of the given node in the tree.
+
+ Rotates the subtree rooted at the given node to the right (its left child becomes the root of the subtree).
+*/
+static tnode* tree_rotate_right(
+  tnode** root,  /*!< Pointer to root of tree */
+  tnode*  node   /*!< Pointer to root of subtree to rotate */
+) {
+
+  tnode* pivot = node->left;
+
+  tree_replace_child( root, node->up, node, pivot );
+
+  node->left = pivot->right;
+  if( node->left != NULL ) {
+    node->left->up = node;
+  }
+
+  pivot->right = node;
+  node->up     = pivot;
+
+  tree_update_height( node );
+  tree_update_height( pivot );
+
+  return( pivot );
+
+}
+
+/*!
+ Walks from the given node up to the root of the tree, updating the height of each node and rotating any subtree
+ whose children differ in height by more than one.
+*/
+static void tree_rebalance(
+  tnode**           root,  /*!< Pointer to root of tree */
+  /*@null@*/ tnode* node   /*!< Pointer to lowest node whose subtree changed */
+) { PROFILE(TREE_REBALANCE);
+
+  while( node != NULL ) {
+
+    int balance = tree_height( node->left ) - tree_height( node->right );
+
+    if( balance > 1 ) {
+      if( tree_height( node->left->left ) < tree_height( node->left->right ) ) {
+        (void)tree_rotate_left( root, node->left );
+      }
+      node = tree_rotate_right( root, node );
+    } else if( balance < -1 ) {
+      if( tree_height( node->right->right ) < tree_height( node->right->left ) ) {
+        (void)tree_rotate_right( root, node->right );
+      }
+      node = tree_rotate_left( root, node );
+    } else {
+      tree_update_height( node );
+    }
+
+    node = node->up;
+
+  }
+
+  PROFILE_END;
+
+}
+
+
 /*!
  \return Returns pointer to newly created tree node.
  
  Creates new node for this pairing and adds it to the binary tree
- for quick lookup.
+ for quick lookup, rebalancing the tree if needed.
 */
 tnode* tree_add(
   const char* key,       /*!< String containing search key for node retrieval */
@@ -58,8 +208,9 @@ tnode* tree_add(
   node->name  = strdup_safe( key );
   node->value = strdup_safe( value );
   node->left  = NULL;
-  node->right = NULL;
-  node->up    = NULL;
+  node->right  = NULL;
+  node->up     = NULL;
+  node->height = 1;
 
   /* Add node to tree */
   if( *root == NULL ) {
@@ -89,6 +240,7 @@ tnode* tree_add(
           curr->left = node;
           node->up   = curr;
           placed     = TRUE;
+          tree_rebalance( root, curr );
         } else {
           curr = curr->left;
         }
@@ -99,6 +251,7 @@ tnode* tree_add(
           curr->right = node;
           node->up    = curr;
           placed      = TRUE;
+          tree_rebalance( root, curr );
         } else {
           curr        = curr->right;
         }
@@ -153,6 +306,7 @@ void tree_remove(
   
   tnode* node;  /* Pointer to found tree node to remove */
   tnode* tail;  /* Temporary pointer to tail node */
+  tnode* start; /* Pointer to lowest node whose subtree changed */
   
   /* Find undefined identifer string in table */
   node = tree_find( key, *root );
@@ -160,102 +314,37 @@ void tree_remove(
   /* If node is found, restitch the define tree. */
   if( node != NULL ) {
 
-    /* If we are the root node in the tree */
-    if( node->up == NULL ) {
-
-      /* If we have no children */
-      if( (node->left == NULL) && (node->right == NULL) ) {
-
-        *root = NULL;
-
-      } else if( node->left == NULL ) {
+    if( (node->left == NULL) || (node->right == NULL) ) {
 
-        *root = node->right;
-        if( node->right ) {
-          node->right->up = NULL;
-        }
-
-      } else if( node->right == NULL ) {
-
-        assert( node->left != NULL );
-        *root       = node->left;
-        (*root)->up = NULL;
-
-      } else {
-
-        tail = node->left;
-        while( tail->right ) {
-          tail = tail->right;
-        }
-
-        tail->right     = node->right;
-        tail->right->up = tail;
-        *root           = node->left;
-        (*root)->up     = NULL;
-
-      }
-
-    } else if( node->left == NULL ) {
-
-      if( node->up->left == node ) {
-
-        node->up->left = node->right;
-
-      } else {
-
-        assert( node->up->right == node );
-        node->up->right = node->right;
-
-      }
-
-      if( node->right ) {
-        node->right->up = node->up;
-      }
-
-    } else if( node->right == NULL ) {
-
-      assert( node->left != NULL );
-
-      if( node->up->left == node ) {
-
-        node->up->left = node->left;
-
-      } else {
-
-        assert( node->up->right == node );
-        node->up->right = node->left;
-
-      }
-
-      node->left->up = node->up;
+      /* Replace the node with its only child (if any) */
+      start = node->up;
+      tree_replace_child( root, node->up, node, ((node->left != NULL) ? node->left : node->right) );
 
     } else {
 
+      /* Replace the node with the rightmost node of its left subtree */
       tail = node->left;
-      assert( (node->left != NULL) && (node->right != NULL) );
-
       while( tail->right ) {
         tail = tail->right;
       }
 
-      tail->right     = node->right;
-      tail->right->up = tail;
-
-      if( node->up->left == node ) {
-
-        node->up->left = node->left;
-
+      if( tail->up == node ) {
+        start = tail;
       } else {
-
-        assert( node->up->right == node );
-        node->up->right = node->left;
-
+        start = tail->up;
+        tree_replace_child( root, tail->up, tail, tail->left );
+        tail->left     = node->left;
+        tail->left->up = tail;
       }
 
-      node->left->up = node->up;
+      tail->right     = node->right;
+      tail->right->up = tail;
+      tree_replace_child( root, node->up, node, tail );
 
     }
 
+    tree_rebalance( root, start );
+
     free_safe( node->name, (strlen( node->name ) + 1) );
     free_safe( node->value, (strlen( node->value ) + 1) );
     free_safe( node, sizeof( tnode ) );
@@ -1150,98 +1150,6 @@ bool scope_local(
 
 }
 
-/*!
- Takes in a filename (with possible directory information and/or possible extension)
- and transforms it into a filename with the directory and extension information stripped
- off.  Much like the the functionality of the unix command "basename".  Returns the 
- stripped filename in the mname parameter.
-*/
-static void convert_file_to_module(
-  char* mname,  /*!< Name of module extracted */
-  int   len,    /*!< Length of mname string (we cannot exceed this value) */
-  char* fname   /*!< Name of filename to extract module name from */
-) { PROFILE(CONVERT_FILE_TO_MODULE);
-
-  char* ptr;   /* Pointer to current character in filename */
-  char* lptr;  /* Pointer to last character in module name */
-  int   i;     /* Loop iterator */
-
-  /* Set ptr to end of fname string */
-  ptr  = fname + strlen( fname );
-  lptr = ptr;
-
-  /* Continue back until period is found */
-  while( (ptr > fname) && (*ptr != '.') ) {
-    ptr--;
-  }
-
-  if( ptr > fname ) {
-    lptr = ptr;
-  }
-
-  /* Continue on until ptr == fname or we have reached a non-filename character */
-  while( (ptr > fname) && (*ptr != '/') ) {
-    ptr--;
-  }
-
-  /* Construct new name */
-  if( ptr > fname ) {
-    ptr++;
-  }
-
-  assert( (lptr - ptr) < len );
-
-  i = 0;
-  while( ptr < lptr ) {
-    mname[i] = *ptr;
-    ptr++;
-    i++;
-  }
-  mname[i] = '\0';
-
-  PROFILE_END;
-
-}
-
-/*!
- \return Returns pointer to next Verilog file to parse or NULL if no files were found.
-
- Iterates through specified file list, searching for next Verilog file to parse.
- If a file is a library file (suppl field is 'D'), the name of the module to search
- for is compared with the name of the file.
-*/
-str_link* get_next_vfile(
-  str_link*   curr,  /*!< Pointer to current file in list */
-  const char* mod    /*!< Name of module searching for */
-) { PROFILE(GET_NEXT_VFILE);
-
-  str_link* next = NULL;  /* Pointer to next Verilog file to parse */
-  char      name[256];    /* String holder for module name of file */
-
-  while( (curr != NULL) && (next == NULL) ) {
-    if( (curr->suppl & 0x1) != 0x1 ) {
-      next = curr;
-    } else {
-      convert_file_to_module( name, 256, curr->str );
-      if( strcmp( name, mod ) == 0 ) {
-        next = curr;
-      } else {
-        curr = curr->next;
-      }
-    }
-  }
-
-  /* Specify that the returned file will be parsed */
-  if( next != NULL ) {
-    next->suppl2 = 1;
-  }
-
-  PROFILE_END;
-
-  return( next );
-
-}
-
 /*!
  \return Pointer to allocated memory.
 
@@ -1894,3 +1802,391 @@ int calc_num_bits_to_store(
   return( bits );
 
 }
+
+/*!
+ \return Returns the new hash value.
+
+ Folds the given block of data into the specified hash value using the FNV-1a algorithm.  A new hash value
+ should be started with HASH_INIT.
+*/
+uint32 util_hash(
+  uint32       hash,  /*!< Current hash value */
+  const void*  data,  /*!< Pointer to data to fold into hash value */
+  unsigned int size   /*!< Number of bytes in data */
+) { PROFILE(UTIL_HASH);
+
+  const unsigned char* ptr = (const unsigned char*)data;
+  unsigned int         i;
+
+  for( i=0; i<size; i++ ) {
+    hash ^= ptr[i];
+    hash *= 16777619;
+  }
+
+  PROFILE_END;
+
+  return( hash );
+
+}
+
+/*!
+ \return Returns the new hash value.
+
+ Folds the given string (including its terminating NUL character) into the specified hash value.
+*/
+uint32 util_hash_string(
+  uint32      hash,  /*!< Current hash value */
+  const char* str    /*!< String to fold into hash value */
+) { PROFILE(UTIL_HASH_STRING);
+
+  uint32 retval = util_hash( hash, str, (strlen( str ) + 1) );
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns the new hash value.
+
+ Folds the given value into the specified hash value, least significant byte first, so that the resulting hash
+ value does not depend on the byte order of the host.
+*/
+uint32 util_hash_uint32(
+  uint32 hash,  /*!< Current hash value */
+  uint32 value  /*!< Value to fold into hash value */
+) { PROFILE(UTIL_HASH_UINT32);
+
+  unsigned char bytes[4];
+
+  bytes[0] = (unsigned char)(value & 0xff);
+  bytes[1] = (unsigned char)((value >> 8) & 0xff);
+  bytes[2] = (unsigned char)((value >> 16) & 0xff);
+  bytes[3] = (unsigned char)((value >> 24) & 0xff);
+
+  hash = util_hash( hash, bytes, 4 );
+
+  PROFILE_END;
+
+  return( hash );
+
+}
+
+/*!
+ \return Returns the new hash value.
+
+ Folds the given block of data into the specified 64-bit hash value using the FNV-1a algorithm.  A new hash
+ value should be started with HASH64_INIT.
+*/
+uint64 util_hash64(
+  uint64       hash,  /*!< Current hash value */
+  const void*  data,  /*!< Pointer to data to fold into hash value */
+  unsigned int size   /*!< Number of bytes in data */
+) { PROFILE(UTIL_HASH64);
+
+  const unsigned char* ptr = (const unsigned char*)data;
+  unsigned int         i;
+
+  for( i=0; i<size; i++ ) {
+    hash ^= ptr[i];
+    hash *= UINT64(0x100000001b3);
+  }
+
+  PROFILE_END;
+
+  return( hash );
+
+}
+
+/*!
+ \return Returns the new hash value.
+
+ Folds the given string (including its terminating NUL character) into the specified 64-bit hash value.
+*/
+uint64 util_hash64_string(
+  uint64      hash,  /*!< Current hash value */
+  const char* str    /*!< String to fold into hash value */
+) { PROFILE(UTIL_HASH64_STRING);
+
+  uint64 retval = util_hash64( hash, str, (strlen( str ) + 1) );
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns the new hash value.
+
+ Folds the given value into the specified 64-bit hash value, least significant byte first, so that the resulting
+ hash value does not depend on the byte order of the host.
+*/
+uint64 util_hash64_uint32(
+  uint64 hash,  /*!< Current hash value */
+  uint32 value  /*!< Value to fold into hash value */
+) { PROFILE(UTIL_HASH64_UINT32);
+
+  unsigned char bytes[4];
+
+  bytes[0] = (unsigned char)(value & 0xff);
+  bytes[1] = (unsigned char)((value >> 8) & 0xff);
+  bytes[2] = (unsigned char)((value >> 16) & 0xff);
+  bytes[3] = (unsigned char)((value >> 24) & 0xff);
+
+  hash = util_hash64( hash, bytes, 4 );
+
+  PROFILE_END;
+
+  return( hash );
+
+}
+
+/*!
+ Inserts the given printable name and element index into the slots of the specified name index.  The
+ table must have at least one empty slot.
+*/
+static void name_index_insert(
+  name_index*  index,  /*!< Pointer to name index to insert into */
+  char*        name,   /*!< Printable name to store (ownership is passed to the index) */
+  uint32       hash,   /*!< Hash value of the given name */
+  unsigned int elem    /*!< Array index of the element with the given name */
+) { PROFILE(NAME_INDEX_INSERT);
+
+  unsigned int slot = hash & (index->size - 1);
+
+  while( index->names[slot] != NULL ) {
+    slot = (slot + 1) & (index->size - 1);
+  }
+
+  index->names[slot]  = name;
+  index->hashes[slot] = hash;
+  index->elems[slot]  = elem;
+
+  PROFILE_END;
+
+}
+
+/*!
+ Adds the given name to the specified name index, mapping it to the given array element index.  The
+ table is doubled in size when it becomes half full.  Names are stored in their printable form so that
+ escaped and unescaped versions of the same name match, as with scope_compare.
+*/
+void name_index_add(
+  name_index*  index,  /*!< Pointer to name index to add to */
+  const char*  name,   /*!< Signal/instance name to add */
+  unsigned int elem    /*!< Array index of the element with the given name */
+) { PROFILE(NAME_INDEX_ADD);
+
+  char* pname = scope_gen_printable( name );
+
+  /* Grow the table (rehashing all current entries) if it is half full */
+  if( ((index->num + 1) * 2) > index->size ) {
+
+    char**        old_names  = index->names;
+    uint32*       old_hashes = index->hashes;
+    unsigned int* old_elems  = index->elems;
+    unsigned int  old_size   = index->size;
+    unsigned int  i;
+
+    index->size   = (old_size == 0) ? 64 : (old_size * 2);
+    index->names  = (char**)malloc_safe_nolimit( sizeof( char* ) * index->size );
+    index->hashes = (uint32*)malloc_safe_nolimit( sizeof( uint32 ) * index->size );
+    index->elems  = (unsigned int*)malloc_safe_nolimit( sizeof( unsigned int ) * index->size );
+
+    for( i=0; i<index->size; i++ ) {
+      index->names[i] = NULL;
+    }
+
+    for( i=0; i<old_size; i++ ) {
+      if( old_names[i] != NULL ) {
+        name_index_insert( index, old_names[i], old_hashes[i], old_elems[i] );
+      }
+    }
+
+    free_safe( old_names,  (sizeof( char* ) * old_size) );
+    free_safe( old_hashes, (sizeof( uint32 ) * old_size) );
+    free_safe( old_elems,  (sizeof( unsigned int ) * old_size) );
+
+  }
+
+  name_index_insert( index, pname, util_hash_string( HASH_INIT, pname ), elem );
+  index->num++;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the smallest array element index stored for the given name, or -1 if the name is not
+         in the index.
+
+ Looks up the given name in the specified name index.  When the same name was added more than once,
+ the earliest array element is returned so that the result matches a linear search of the array.
+*/
+int name_index_find(
+  const name_index* index,  /*!< Pointer to name index to search */
+  const char*       name    /*!< Signal/instance name to find */
+) { PROFILE(NAME_INDEX_FIND);
+
+  int retval = -1;
+
+  if( index->num > 0 ) {
+
+    char*        pname = scope_gen_printable( name );
+    uint32       hash  = util_hash_string( HASH_INIT, pname );
+    unsigned int slot  = hash & (index->size - 1);
+
+    while( index->names[slot] != NULL ) {
+      if( (index->hashes[slot] == hash) && (strcmp( index->names[slot], pname ) == 0) &&
+          ((retval == -1) || (index->elems[slot] < (unsigned int)retval)) ) {
+        retval = index->elems[slot];
+      }
+      slot = (slot + 1) & (index->size - 1);
+    }
+
+    free_safe( pname, (strlen( pname ) + 1) );
+
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ Deallocates all memory associated with the given name index, leaving it empty.
+*/
+void name_index_dealloc(
+  name_index* index  /*!< Pointer to name index to deallocate */
+) { PROFILE(NAME_INDEX_DEALLOC);
+
+  unsigned int i;
+
+  for( i=0; i<index->size; i++ ) {
+    if( index->names[i] != NULL ) {
+      free_safe( index->names[i], (strlen( index->names[i] ) + 1) );
+    }
+  }
+
+  free_safe( index->names,  (sizeof( char* ) * index->size) );
+  free_safe( index->hashes, (sizeof( uint32 ) * index->size) );
+  free_safe( index->elems,  (sizeof( unsigned int ) * index->size) );
+
+  index->names  = NULL;
+  index->hashes = NULL;
+  index->elems  = NULL;
+  index->size   = 0;
+  index->num    = 0;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to the allocated memory.
+
+ Allocates the given number of bytes from the specified string arena, adding a new block to the arena if the
+ current block cannot hold the request.  The returned memory is suitably aligned for pointers and remains valid
+ until the arena is reset or deallocated; it must not be passed to free_safe.
+*/
+void* str_arena_alloc(
+  str_arena*   arena,  /*!< Pointer to arena to allocate memory from */
+  unsigned int size    /*!< Number of bytes to allocate */
+) { PROFILE(STR_ARENA_ALLOC);
+
+  str_arena_blk* blk = arena->curr;
+  void*          ptr;
+
+  /* Round the size up to keep every allocation pointer-aligned */
+  size = (size + (sizeof( void* ) - 1)) & ~(sizeof( void* ) - 1);
+
+  /* Add a new block to the end of the arena if the current block cannot hold the request */
+  if( (blk == NULL) || ((blk->used + size) > blk->size) ) {
+    str_arena_blk* nblk = (str_arena_blk*)malloc_safe( sizeof( str_arena_blk ) );
+    nblk->size = (size > STR_ARENA_BLK_SIZE) ? size : STR_ARENA_BLK_SIZE;
+    nblk->mem  = (char*)malloc_safe( nblk->size );
+    nblk->used = 0;
+    nblk->next = NULL;
+    if( blk == NULL ) {
+      arena->head = nblk;
+    } else {
+      blk->next = nblk;
+    }
+    blk = nblk;
+  }
+
+  ptr          = blk->mem + blk->used;
+  blk->used   += size;
+  arena->curr  = blk;
+
+  PROFILE_END;
+
+  return( ptr );
+
+}
+
+/*!
+ \return Returns a pointer to the copy of the given string.
+
+ Copies the given string into memory allocated from the specified string arena.
+*/
+char* str_arena_strdup(
+  str_arena*  arena,  /*!< Pointer to arena to allocate memory from */
+  const char* str     /*!< String to copy */
+) { PROFILE(STR_ARENA_STRDUP);
+
+  unsigned int len  = strlen( str ) + 1;
+  char*        copy = (char*)str_arena_alloc( arena, len );
+
+  memcpy( copy, str, len );
+
+  PROFILE_END;
+
+  return( copy );
+
+}
+
+/*!
+ Releases all memory handed out by the given string arena in bulk.  The first block of the arena is kept so
+ that subsequent allocations do not need to allocate memory again; any additional blocks are deallocated.
+*/
+void str_arena_reset(
+  str_arena* arena  /*!< Pointer to arena to reset */
+) { PROFILE(STR_ARENA_RESET);
+
+  if( arena->head != NULL ) {
+    while( arena->head->next != NULL ) {
+      str_arena_blk* tmp = arena->head->next;
+      arena->head->next = tmp->next;
+      free_safe( tmp->mem, tmp->size );
+      free_safe( tmp, sizeof( str_arena_blk ) );
+    }
+    arena->head->used = 0;
+  }
+  arena->curr = arena->head;
+
+  PROFILE_END;
+
+}
+
+/*!
+ Deallocates all blocks of the given string arena, leaving the arena empty.
+*/
+void str_arena_dealloc(
+  str_arena* arena  /*!< Pointer to arena to deallocate */
+) { PROFILE(STR_ARENA_DEALLOC);
+
+  while( arena->head != NULL ) {
+    str_arena_blk* tmp = arena->head;
+    arena->head = tmp->next;
+    free_safe( tmp->mem, tmp->size );
+    free_safe( tmp, sizeof( str_arena_blk ) );
+  }
+  arena->curr = NULL;
+
+  PROFILE_END;
+
+}
@@ -196,12 +196,6 @@ bool scope_local(
   const char* scope
 );
 
-/*! \brief Returns next Verilog file to parse. */
-str_link* get_next_vfile(
-  str_link*   curr,
-  const char* mod
-);
-
 /*! \brief Performs safe malloc call. */
 /*@only@*/ void* malloc_safe1(
   size_t       size,
@@ -354,5 +348,83 @@ int calc_num_bits_to_store(
   int values
 );
 
+/*! \brief Folds the given block of data into the specified hash value. */
+uint32 util_hash(
+  uint32       hash,
+  const void*  data,
+  unsigned int size
+);
+
+/*! \brief Folds the given string into the specified hash value. */
+uint32 util_hash_string(
+  uint32      hash,
+  const char* str
+);
+
+/*! \brief Folds the given 32-bit value into the specified hash value. */
+uint32 util_hash_uint32(
+  uint32 hash,
+  uint32 value
+);
+
+/*! \brief Folds the given block of data into the specified 64-bit hash value. */
+uint64 util_hash64(
+  uint64       hash,
+  const void*  data,
+  unsigned int size
+);
+
+/*! \brief Folds the given string into the specified 64-bit hash value. */
+uint64 util_hash64_string(
+  uint64      hash,
+  const char* str
+);
+
+/*! \brief Folds the given 32-bit value into the specified 64-bit hash value. */
+uint64 util_hash64_uint32(
+  uint64 hash,
+  uint32 value
+);
+
+/*! \brief Adds the given name to the specified name index. */
+void name_index_add(
+  name_index*  index,
+  const char*  name,
+  unsigned int elem
+);
+
+/*! \brief Finds the array element index of the given name in the specified name index. */
+int name_index_find(
+  const name_index* index,
+  const char*       name
+);
+
+/*! \brief Deallocates all memory associated with the given name index. */
+void name_index_dealloc(
+  name_index* index
+);
+
+/*! \brief Allocates memory from the given string arena. */
+void* str_arena_alloc(
+  str_arena*   arena,
+  unsigned int size
+);
+
+/*! \brief Copies the given string into memory allocated from the given string arena. */
+char* str_arena_strdup(
+  str_arena*  arena,
+  const char* str
+);
+
+/*! \brief Releases all memory handed out by the given string arena for reuse. */
+void str_arena_reset(
+  str_arena* arena
+);
+
+/*! \brief Deallocates all memory blocks of the given string arena. */
+void str_arena_dealloc(
+  str_arena* arena
+);
+
 #endif
 
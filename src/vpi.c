@@ -33,6 +33,7 @@
 #include "binding.h"
 #include "db.h"
 #include "defines.h"
+#include "func_unit.h"
 #include "instance.h"
 #include "link.h"
 #include "obfuscate.h"
@@ -493,7 +494,7 @@ void covered_create_value_change_cb(
 
   /* Only add the signal if it is in our database and needs to be assigned from the simulator */
   if( (curr_instance->funit != NULL) &&
-      (((((vsig = sig_link_find( name, curr_instance->funit->sigs, curr_instance->funit->sig_size )) != NULL) ||
+      (((((vsig = funit_find_local_signal( name, curr_instance->funit )) != NULL) ||
          scope_find_signal( name, curr_instance->funit, &vsig, &found_funit, 0 )) &&
         (((vsig != NULL) && (vsig->suppl.part.assigned == 0)) || info_suppl.part.inlined)) ||
        (info_suppl.part.inlined &&
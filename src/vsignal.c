@@ -243,8 +243,9 @@ vsignal* vsignal_duplicate(
  for this design.
 */
 void vsignal_db_write(
-  vsignal* sig,  /*!< Signal to write to file */
-  FILE*    file  /*!< Name of file to display vsignal contents to */
+  vsignal* sig,         /*!< Signal to write to file */
+  FILE*    file,        /*!< Name of file to display vsignal contents to */
+  uint64*  fingerprint  /*!< Pointer to the design fingerprint of the CDD file being written */
 ) { PROFILE(VSIGNAL_DB_WRITE);
 
   unsigned int i;  /* Loop iterator */
@@ -255,6 +256,12 @@ void vsignal_db_write(
       (sig->value->width <= MAX_BIT_WIDTH) &&
       (sig->suppl.part.type != SSUPPL_TYPE_GENVAR) ) {
 
+    /* Fold the name, width and dimensions of the signal into the design fingerprint */
+    *fingerprint = util_hash64_uint32( *fingerprint, DB_TYPE_SIGNAL );
+    *fingerprint = util_hash64_string( *fingerprint, sig->name );
+    *fingerprint = util_hash64_uint32( *fingerprint, sig->value->width );
+    *fingerprint = util_hash64_uint32( *fingerprint, ((sig->pdim_num << 16) | sig->udim_num) );
+
     /* Display identification and value information first */
     fprintf( file, "%d %s %d %d %x %u %u",
       DB_TYPE_SIGNAL,
@@ -442,6 +449,58 @@ void vsignal_db_merge(
 
 }
 
+/*!
+ \throws anonymous vector_db_merge Throw
+
+ Parses specified line for vsignal information and merges only its coverage information (the exclusion bit and
+ the vector) into the base vsignal.  The vsignal is known to come from a CDD file created from the same design, so
+ its name and dimensions are not compared.
+*/
+void vsignal_db_merge_coverage(
+  vsignal* base,  /*!< Signal to store result of merge into */
+  char**   line   /*!< Pointer to line of CDD file to parse */
+) { PROFILE(VSIGNAL_DB_MERGE_COVERAGE);
+
+  ssuppl       suppl;       /* Supplemental signal information */
+  unsigned int pdim_num;    /* Number of packed dimensions */
+  unsigned int udim_num;    /* Number of unpacked dimensions */
+  int          chars_read;  /* Number of characters read from line */
+  unsigned int i;           /* Loop iterator */
+
+  assert( base != NULL );
+
+  if( sscanf( *line, "%*s %*d %*d %x %u %u%n", &(suppl.all), &pdim_num, &udim_num, &chars_read ) == 3 ) {
+
+    *line = *line + chars_read;
+
+    /* Make sure that the exclude bit is merged */
+    base->suppl.part.excluded |= suppl.part.excluded;
+
+    /* Skip the dimensions */
+    for( i=0; i<(pdim_num + udim_num); i++ ) {
+      chars_read = 0;
+      (void)sscanf( *line, " %*d %*d%n", &chars_read );
+      if( chars_read == 0 ) {
+        print_output( "Unable to parse vsignal in database file.  Unable to merge.", FATAL, __FILE__, __LINE__ );
+        Throw 0;
+      }
+      *line = *line + chars_read;
+    }
+
+    /* Read in vector information */
+    vector_db_merge( base->value, line, TRUE );
+
+  } else {
+
+    print_output( "Unable to parse vsignal in database file.  Unable to merge.", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  Merges two vsignals, placing the result into the base vsignal.  This function is used to calculate
  module coverage for the GUI.
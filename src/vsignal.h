@@ -50,7 +50,8 @@ vsignal* vsignal_duplicate(
 /*! \brief Outputs this vsignal information to specified file. */
 void vsignal_db_write(
   vsignal* sig,
-  FILE*    file
+  FILE*    file,
+  uint64*  fingerprint
 );
 
 /*! \brief Reads vsignal information from specified file. */
@@ -66,6 +67,12 @@ void vsignal_db_merge(
   bool     same
 );
 
+/*! \brief Reads and merges only the coverage information of a vsignal from the same design into base. */
+void vsignal_db_merge_coverage(
+  vsignal* base,
+  char**   line
+);
+
 /*! \brief Merges two vsignals, placing the result into the base vsignal. */
 void vsignal_merge(
   vsignal* base,